@@ -1,5 +1,6 @@
 #pragma once
 
+#include "EngineProcedures.h"
 #include "RegPolynomials.h"
 #include "SimVars.h"
 #include "Tables.h"
@@ -8,7 +9,10 @@
 
 #include "ini_type_conversion.h"
 
+// the host harness in src/fadecsim keeps the configuration in its build directory
+#ifndef FILENAME_FADEC_CONF_DIRECTORY
 #define FILENAME_FADEC_CONF_DIRECTORY "\\work\\AircraftStates\\"
+#endif
 #define FILENAME_FADEC_CONF_FILE_EXTENSION ".ini"
 #define CONFIGURATION_SECTION_FUEL "FUEL"
 
@@ -25,67 +29,46 @@ struct Configuration {
   double fuelRight = fuelLeft;
   double fuelLeftAux = 228;
   double fuelRightAux = fuelLeftAux;
+
+  bool operator==(const Configuration&) const = default;
 };
 
-class EngineControl {
+class EngineControl : public EngineProcedures<SimVars, SimVars::ENGINE_COUNT> {
  private:
-  SimVars* simVars;
-  EngineRatios* ratios;
-  Polynomial* poly;
   Timer timerLeft;
   Timer timerRight;
   Timer timerFuel;
 
+  // The fuel configuration file is written behind the fuel model: storeFuelInConfiguration() keeps the quantities in
+  // memory and writeConfiguration() writes them once they settled for CONFIGURATION_SETTLE_TIME, at the latest after
+  // CONFIGURATION_MAX_DELAY, and when the FADEC terminates.
+  Configuration savedConfiguration;
+  Configuration pendingConfiguration;
+  bool isConfigurationPending = false;
+  Timer timerConfigurationChanged;
+  Timer timerConfigurationPending;
+  const double CONFIGURATION_SETTLE_TIME = 5000;  // ms
+  const double CONFIGURATION_MAX_DELAY = 60000;   // ms
+
   std::string confFilename = FILENAME_FADEC_CONF_DIRECTORY;
 
-  bool simPaused;
   double animationDeltaTime;
-  double timer;
-  double ambientTemp;
-  double ambientPressure;
-  double simOnGround;
   double devState;
 
   int engine;
   int egtImbalance;
   int ffImbalance;
   int n2Imbalance;
-  double engineState;
-  double engineStarter;
-  double engineIgniter;
 
   double packs;
   double nai;
   double wai;
 
-  double simCN1;
-  double simN1;
-  double simN2;
-  double thrust;
-  double simN2LeftPre;
-  double simN2RightPre;
-  double deltaN2;
-  double thermalEnergy1;
-  double thermalEnergy2;
-  double oilTemperature;
-  double oilTemperatureLeftPre;
-  double oilTemperatureRightPre;
-  double oilTemperatureMax;
-  double idleN1;
-  double idleN2;
-  double idleFF;
-  double idleEGT;
   double idleOil;
-  double mach;
-  double pressAltitude;
-  double correctedEGT;
-  double correctedFuelFlow;
-  double cFbwFF;
   double imbalance;
   int engineImbalanced;
   double paramImbalance;
 
-  const double LBS_TO_KGS = 0.4535934;
   const double KGS_TO_LBS = 1 / 0.4535934;
   const double FUEL_THRESHOLD = 661;  // lbs/sec
 
@@ -100,25 +83,12 @@ class EngineControl {
   double transitionFactor = 0;
   double transitionStartTime = 0;
 
-  /// <summary>
-  /// Generate Idle/ Initial Engine Parameters (non-imbalanced)
-  /// </summary>
-  void generateIdleParameters(double pressAltitude, double mach, double ambientTemp, double ambientPressure) {
-    double idleCN1;
-    double idleCFF;
-
-    idleCN1 = iCN1(pressAltitude, mach, ambientTemp);
-    idleN1 = idleCN1 * sqrt(ratios->theta2(0, ambientTemp));
-    idleN2 = iCN2(pressAltitude, mach) * sqrt(ratios->theta(ambientTemp));
-    idleCFF = poly->correctedFuelFlow(idleCN1, 0, pressAltitude);                                               // lbs/hr
-    idleFF = idleCFF * LBS_TO_KGS * ratios->delta2(0, ambientPressure) * sqrt(ratios->theta2(0, ambientTemp));  // Kg/hr
-    idleEGT = poly->correctedEGT(idleCN1, idleCFF, 0, pressAltitude) * ratios->theta2(0, ambientTemp);
-
-    simVars->setEngineIdleN1(idleN1);
-    simVars->setEngineIdleN2(idleN2);
-    simVars->setEngineIdleFF(idleFF);
-    simVars->setEngineIdleEGT(idleEGT);
-  }
+  // flex rating of the shared thrust limits, flex temperatures at or below the limit point are ignored
+  static constexpr FlexRating FLEX_RATING = FlexRating::AboveLimitPoint;
+  // SimConnect data of this cycle, published with one call per data definition
+  SimObjectDataSnapshot<8> payloadStations{DataTypesID::PayloadStations};
+  SimObjectDataSnapshot<3> fuelMainTanks{DataTypesID::FuelMainTanks};
+  SimObjectDataSnapshot<2> fuelAuxTanks{DataTypesID::FuelAuxTanks};
 
   double initOil(int minOil, int maxOil) {
     double idleOil = (rand() % (maxOil - minOil + 1) + minOil) / 10;
@@ -176,485 +146,41 @@ class EngineControl {
   }
 
   /// <summary>
-  /// Engine State Machine
-  /// 0 - Engine OFF, 1 - Engine ON, 2 - Engine Starting, 3 - Engine Re-starting & 4 - Engine Shutting
-  /// </summary>
-  void engineStateMachine(int engine,
-                          double engineIgniter,
-                          double engineStarter,
-                          double simN2,
-                          double idleN2,
-                          double pressAltitude,
-                          double ambientTemp,
-                          double deltaTimeDiff) {
-    int resetTimer = 0;
-    double egtFbw = 0;
-
-    switch (engine) {
-      case 1:
-        engineState = simVars->getEngine1State();
-        egtFbw = simVars->getEngine1EGT();
-        break;
-      case 2:
-        engineState = simVars->getEngine2State();
-        egtFbw = simVars->getEngine2EGT();
-        break;
-    }
-    // Present State PAUSED
-    if (deltaTimeDiff == 0 && engineState < 10) {
-      engineState = engineState + 10;
-      simPaused = true;
-    } else if (deltaTimeDiff == 0 && engineState >= 10) {
-      simPaused = true;
-    } else {
-      simPaused = false;
-
-      // Present State OFF
-      if (engineState == 0 || engineState == 10) {
-        if (engineIgniter == 1 && engineStarter == 1 && simN2 > 20) {
-          engineState = 1;
-        } else if (engineIgniter == 2 && engineStarter == 1) {
-          engineState = 2;
-        } else {
-          engineState = 0;
-        }
-      }
-
-      // Present State ON
-      if (engineState == 1 || engineState == 11) {
-        if (engineStarter == 1) {
-          engineState = 1;
-        } else {
-          engineState = 4;
-        }
-      }
-
-      // Present State Starting.
-      if (engineState == 2 || engineState == 12) {
-        if (engineStarter == 1 && simN2 >= (idleN2 - 0.1)) {
-          engineState = 1;
-          resetTimer = 1;
-        } else if (engineStarter == 0) {
-          engineState = 4;
-          resetTimer = 1;
-        } else {
-          engineState = 2;
-        }
-      }
-
-      // Present State Re-Starting.
-      if (engineState == 3 || engineState == 13) {
-        if (engineStarter == 1 && simN2 >= (idleN2 - 0.1)) {
-          engineState = 1;
-          resetTimer = 1;
-        } else if (engineStarter == 0) {
-          engineState = 4;
-          resetTimer = 1;
-        } else {
-          engineState = 3;
-        }
-      }
-
-      // Present State Shutting
-      if (engineState == 4 || engineState == 14) {
-        if (engineIgniter == 2 && engineStarter == 1) {
-          engineState = 3;
-          resetTimer = 1;
-        } else if (engineStarter == 0 && simN2 < 0.05 && egtFbw <= ambientTemp) {
-          engineState = 0;
-          resetTimer = 1;
-        } else if (engineStarter == 1 && simN2 > 50) {
-          engineState = 3;
-          resetTimer = 1;
-        } else {
-          engineState = 4;
-        }
-      }
-    }
-
-    switch (engine) {
-      case 1:
-        simVars->setEngine1State(engineState);
-        if (resetTimer == 1) {
-          simVars->setEngine1Timer(0);
-        }
-        break;
-      case 2:
-        simVars->setEngine2State(engineState);
-        if (resetTimer == 1) {
-          simVars->setEngine2Timer(0);
-        }
-        break;
-    }
-  }
-
-  /// <summary>
-  /// Engine Start Procedure
-  /// </summary>TIT
-  void engineStartProcedure(int engine,
-                            double engineState,
-                            double imbalance,
-                            double deltaTime,
-                            double timer,
-                            double simN2,
-                            double pressAltitude,
-                            double ambientTemp) {
-    double startCN2Left;
-    double startCN2Right;
-    double preN2Fbw;
-    double newN2Fbw;
-    double preEgtFbw;
-    double startEgtFbw;
-    double shutdownEgtFbw;
-
-    n2Imbalance = 0;
-    ffImbalance = 0;
-    egtImbalance = 0;
-    idleN2 = simVars->getEngineIdleN2();
-    idleN1 = simVars->getEngineIdleN1();
-    idleFF = simVars->getEngineIdleFF();
-    idleEGT = simVars->getEngineIdleEGT();
-
-    // Engine imbalance
-    engineImbalanced = imbalanceExtractor(imbalance, 1);
-
-    // Checking engine imbalance
-    if (engineImbalanced == engine) {
-      ffImbalance = imbalanceExtractor(imbalance, 3);
-      egtImbalance = imbalanceExtractor(imbalance, 2);
-      n2Imbalance = imbalanceExtractor(imbalance, 4) / 100;
-    }
-
-    if (engine == 1) {
-      // Delay between Engine Master ON and Start Valve Open
-      if (timer < 1.7) {
-        if (simOnGround == 1) {
-          simVars->setFuelUsedLeft(0);
-        }
-        simVars->setEngine1Timer(timer + deltaTime);
-        startCN2Left = 0;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::StartCN2Left, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &startCN2Left);
-      } else {
-        preN2Fbw = simVars->getEngine1N2();
-        preEgtFbw = simVars->getEngine1EGT();
-        newN2Fbw = poly->startN2(simN2, preN2Fbw, idleN2 - n2Imbalance);
-        startEgtFbw = poly->startEGT(newN2Fbw, idleN2 - n2Imbalance, ambientTemp, idleEGT - egtImbalance);
-        shutdownEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-
-        simVars->setEngine1N2(newN2Fbw);
-        simVars->setEngine1N1(poly->startN1(newN2Fbw, idleN2 - n2Imbalance, idleN1));
-        simVars->setEngine1FF(poly->startFF(newN2Fbw, idleN2 - n2Imbalance, idleFF - ffImbalance));
-
-        if (engineState == 3) {
-          if (abs(startEgtFbw - preEgtFbw) <= 1.5) {
-            simVars->setEngine1EGT(startEgtFbw);
-            simVars->setEngine1State(2);
-          } else if (startEgtFbw > preEgtFbw) {
-            simVars->setEngine1EGT(preEgtFbw + (0.75 * deltaTime * (idleN2 - newN2Fbw)));
-          } else {
-            simVars->setEngine1EGT(shutdownEgtFbw);
-          }
-        } else {
-          simVars->setEngine1EGT(startEgtFbw);
-        }
-
-        oilTemperature = poly->startOilTemp(newN2Fbw, idleN2, ambientTemp);
-        oilTemperatureLeftPre = oilTemperature;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempLeft, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &oilTemperature);
-      }
-    } else {
-      if (timer < 1.7) {
-        if (simOnGround == 1) {
-          simVars->setFuelUsedRight(0);
-        }
-        simVars->setEngine2Timer(timer + deltaTime);
-        startCN2Right = 0;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::StartCN2Right, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &startCN2Right);
-      } else {
-        preN2Fbw = simVars->getEngine2N2();
-        preEgtFbw = simVars->getEngine2EGT();
-        newN2Fbw = poly->startN2(simN2, preN2Fbw, idleN2 - n2Imbalance);
-        startEgtFbw = poly->startEGT(newN2Fbw, idleN2 - n2Imbalance, ambientTemp, idleEGT - egtImbalance);
-        shutdownEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-
-        simVars->setEngine2N2(newN2Fbw);
-        simVars->setEngine2N1(poly->startN1(newN2Fbw, idleN2 - n2Imbalance, idleN1));
-        simVars->setEngine2FF(poly->startFF(newN2Fbw, idleN2 - n2Imbalance, idleFF - ffImbalance));
-
-        if (engineState == 3) {
-          if (abs(startEgtFbw - preEgtFbw) <= 1.5) {
-            simVars->setEngine2EGT(startEgtFbw);
-            simVars->setEngine2State(2);
-          } else if (startEgtFbw > preEgtFbw) {
-            simVars->setEngine2EGT(preEgtFbw + (0.75 * deltaTime * (idleN2 - newN2Fbw)));
-          } else {
-            simVars->setEngine2EGT(shutdownEgtFbw);
-          }
-        } else {
-          simVars->setEngine2EGT(startEgtFbw);
-        }
-
-        oilTemperature = poly->startOilTemp(newN2Fbw, idleN2, ambientTemp);
-        oilTemperatureRightPre = oilTemperature;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempRight, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &oilTemperature);
-      }
-    }
-  }
-
-  /// <summary>
-  /// Engine Shutdown Procedure - TEMPORAL SOLUTION
-  /// </summary>
-  void engineShutdownProcedure(int engine, double ambientTemp, double simN1, double deltaTime, double timer) {
-    double preN1Fbw;
-    double preN2Fbw;
-    double preEgtFbw;
-    double newN1Fbw;
-    double newN2Fbw;
-    double newEgtFbw;
-
-    if (engine == 1) {
-      if (timer < 1.8) {
-        simVars->setEngine1Timer(timer + deltaTime);
-      } else {
-        preN1Fbw = simVars->getEngine1N1();
-        preN2Fbw = simVars->getEngine1N2();
-        preEgtFbw = simVars->getEngine1EGT();
-        newN1Fbw = poly->shutdownN1(preN1Fbw, deltaTime);
-        if (simN1 < 5 && simN1 > newN1Fbw) {  // Takes care of windmilling
-          newN1Fbw = simN1;
-        }
-        newN2Fbw = poly->shutdownN2(preN2Fbw, deltaTime);
-        newEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-        simVars->setEngine1N1(newN1Fbw);
-        simVars->setEngine1N2(newN2Fbw);
-        simVars->setEngine1EGT(newEgtFbw);
-      }
-
-    } else {
-      if (timer < 1.8) {
-        simVars->setEngine2Timer(timer + deltaTime);
-      } else {
-        preN1Fbw = simVars->getEngine2N1();
-        preN2Fbw = simVars->getEngine2N2();
-        preEgtFbw = simVars->getEngine2EGT();
-        newN1Fbw = poly->shutdownN1(preN1Fbw, deltaTime);
-        if (simN1 < 5 && simN1 > newN1Fbw) {  // Takes care of windmilling
-          newN1Fbw = simN1;
-        }
-        newN2Fbw = poly->shutdownN2(preN2Fbw, deltaTime);
-        newEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-        simVars->setEngine2N1(newN1Fbw);
-        simVars->setEngine2N2(newN2Fbw);
-        simVars->setEngine2EGT(newEgtFbw);
-      }
-    }
-  }
-  /// <summary>
-  /// FBW Engine RPM (N1 and N2)
-  /// Updates Engine N1 and N2 with our own algorithm for start-up and shutdown
-  /// </summary>
-  void updatePrimaryParameters(int engine, double imbalance, double simN1, double simN2) {
-    // Engine imbalance
-    engineImbalanced = imbalanceExtractor(imbalance, 1);
-    paramImbalance = imbalanceExtractor(imbalance, 4) / 100;
-
-    // Checking engine imbalance
-    if (engineImbalanced != engine) {
-      paramImbalance = 0;
-    }
-
-    if (engine == 1) {
-      simVars->setEngine1N1(simN1);
-      simVars->setEngine1N2(simN2 - paramImbalance);
-    } else {
-      simVars->setEngine2N1(simN1);
-      simVars->setEngine2N2(simN2 - paramImbalance);
-    }
-  }
-
-  /// <summary>
-  /// FBW Exhaust Gas Temperature (in degree Celsius)
-  /// Updates EGT with realistic values visualized in the ECAM
+  /// Decodes the imbalance of the engines from the Coded Digital Word
   /// </summary>
-  void updateEGT(int engine,
-                 double imbalance,
-                 double deltaTime,
-                 double simOnGround,
-                 double engineState,
-                 double simCN1,
-                 double cFbwFF,
-                 double mach,
-                 double pressAltitude,
-                 double ambientTemp) {
-    double egtFbwPreviousEng1;
-    double egtFbwActualEng1;
-    double egtFbwPreviousEng2;
-    double egtFbwActualEng2;
-
-    // Engine imbalance timer
-    engineImbalanced = imbalanceExtractor(imbalance, 1);
-    paramImbalance = imbalanceExtractor(imbalance, 2);
-
-    correctedEGT = poly->correctedEGT(simCN1, cFbwFF, mach, pressAltitude);
-
-    // Checking engine imbalance
-    if (engineImbalanced != engine) {
-      paramImbalance = 0;
-    }
-
-    if (engine == 1) {
-      if (simOnGround == 1 && engineState == 0) {
-        simVars->setEngine1EGT(ambientTemp);
-      } else {
-        egtFbwPreviousEng1 = simVars->getEngine1EGT();
-        egtFbwActualEng1 = (correctedEGT * ratios->theta2(mach, ambientTemp)) - paramImbalance;
-        egtFbwActualEng1 = egtFbwActualEng1 + (egtFbwPreviousEng1 - egtFbwActualEng1) * expFBW(-0.1 * deltaTime);
-        simVars->setEngine1EGT(egtFbwActualEng1);
-      }
-    } else {
-      if (simOnGround == 1 && engineState == 0) {
-        simVars->setEngine2EGT(ambientTemp);
-      } else {
-        egtFbwPreviousEng2 = simVars->getEngine2EGT();
-        egtFbwActualEng2 = (correctedEGT * ratios->theta2(mach, ambientTemp)) - paramImbalance;
-        egtFbwActualEng2 = egtFbwActualEng2 + (egtFbwPreviousEng2 - egtFbwActualEng2) * expFBW(-0.1 * deltaTime);
-        simVars->setEngine2EGT(egtFbwActualEng2);
+  EngineImbalance<SimVars::ENGINE_COUNT> getEngineImbalance(double imbalance) {
+    EngineImbalance<SimVars::ENGINE_COUNT> engineImbalance;
+    int imbalancedEngine = imbalanceExtractor(imbalance, 1);
+
+    for (int lane = 0; lane < SimVars::ENGINE_COUNT; lane++) {
+      if (imbalancedEngine == lane + 1) {
+        engineImbalance.egt[lane] = imbalanceExtractor(imbalance, 2);
+        engineImbalance.ff[lane] = imbalanceExtractor(imbalance, 3);
+        engineImbalance.n2[lane] = imbalanceExtractor(imbalance, 4) / 100;
+        engineImbalance.oilPressure[lane] = imbalanceExtractor(imbalance, 6) / 10;
       }
     }
+    engineImbalance.oilPressureIdle = imbalanceExtractor(imbalance, 7) - 6;
+    return engineImbalance;
   }
 
   /// <summary>
-  /// FBW Fuel FLow (in Kg/h)
-  /// Updates Fuel Flow with realistic values
+  /// Starts the SimConnect data of this cycle from the values of the sim
   /// </summary>
-  double
-  updateFF(int engine, double imbalance, double simCN1, double mach, double pressAltitude, double ambientTemp, double ambientPressure) {
-    double outFlow = 0;
-
-    // Engine imbalance
-    engineImbalanced = imbalanceExtractor(imbalance, 1);
-    paramImbalance = imbalanceExtractor(imbalance, 3);
-
-    correctedFuelFlow = poly->correctedFuelFlow(simCN1, mach, pressAltitude);  // in lbs/hr.
-
-    // Checking engine imbalance
-    if (engineImbalanced != engine || correctedFuelFlow < 1) {
-      paramImbalance = 0;
-    }
-
-    // Checking Fuel Logic and final Fuel Flow
-    if (correctedFuelFlow < 1) {
-      outFlow = 0;
-    } else {
-      outFlow = (correctedFuelFlow * LBS_TO_KGS * ratios->delta2(mach, ambientPressure) * sqrt(ratios->theta2(mach, ambientTemp))) -
-                paramImbalance;
-    }
-
-    if (engine == 1) {
-      simVars->setEngine1FF(outFlow);
-    } else {
-      simVars->setEngine2FF(outFlow);
-    }
-
-    return correctedFuelFlow;
+  void readSimObjectData() {
+    readEngineSimObjectData();
+    fuelMainTanks.setCurrent({simVars->getTankLeftQuantity(), simVars->getTankRightQuantity(), simVars->getTankCenterQuantity()});
+    fuelAuxTanks.setCurrent({simVars->getTankLeftAuxQuantity(), simVars->getTankRightAuxQuantity()});
   }
 
   /// <summary>
-  /// FBW Oil Qty, Pressure and Temperature (in Quarts, PSI and degree Celsius)
-  /// Updates Oil with realistic values visualized in the SD
+  /// Publishes the SimConnect data that was set in this cycle and differs from the sim
   /// </summary>
-  void updateOil(int engine, double imbalance, double thrust, double simN2, double deltaN2, double deltaTime, double ambientTemp) {
-    double steadyTemperature;
-    double thermalEnergy;
-    double oilTemperaturePre;
-    double oilQtyActual;
-    double oilTotalActual;
-    double oilQtyObjective;
-    double oilBurn;
-    double oilIdleRandom;
-    double oilPressure;
-
-    //--------------------------------------------
-    // Engine Reading
-    //--------------------------------------------
-    if (engine == 1) {
-      steadyTemperature = simVars->getEngine1EGT();
-      thermalEnergy = thermalEnergy1;
-      oilTemperaturePre = oilTemperatureLeftPre;
-      oilQtyActual = simVars->getEngine1Oil();
-      oilTotalActual = simVars->getEngine1TotalOil();
-    } else {
-      steadyTemperature = simVars->getEngine2EGT();
-      thermalEnergy = thermalEnergy2;
-      oilTemperaturePre = oilTemperatureRightPre;
-      oilQtyActual = simVars->getEngine2Oil();
-      oilTotalActual = simVars->getEngine2TotalOil();
-    }
-
-    //--------------------------------------------
-    // Oil Temperature
-    //--------------------------------------------
-    if (simOnGround == 1 && engineState == 0 && ambientTemp > oilTemperaturePre - 10) {
-      oilTemperature = ambientTemp;
-    } else {
-      if (steadyTemperature > oilTemperatureMax) {
-        steadyTemperature = oilTemperatureMax;
-      }
-      thermalEnergy = (0.995 * thermalEnergy) + (deltaN2 / deltaTime);
-      oilTemperature = poly->oilTemperature(thermalEnergy, oilTemperaturePre, steadyTemperature, deltaTime);
-    }
-
-    //--------------------------------------------
-    // Oil Quantity
-    //--------------------------------------------
-    // Calculating Oil Qty as a function of thrust
-    oilQtyObjective = oilTotalActual * (1 - poly->oilGulpPct(thrust));
-    oilQtyActual = oilQtyActual - (oilTemperature - oilTemperaturePre);
-
-    // Oil burnt taken into account for tank and total oil
-    oilBurn = (0.00011111 * deltaTime);
-    oilQtyActual = oilQtyActual - oilBurn;
-    oilTotalActual = oilTotalActual - oilBurn;
-
-    //--------------------------------------------
-    // Oil Pressure
-    //--------------------------------------------
-    // Engine imbalance
-    engineImbalanced = imbalanceExtractor(imbalance, 1);
-    paramImbalance = imbalanceExtractor(imbalance, 6) / 10;
-    oilIdleRandom = imbalanceExtractor(imbalance, 7) - 6;
-
-    // Checking engine imbalance
-    if (engineImbalanced != engine) {
-      paramImbalance = 0;
-    }
-
-    oilPressure = poly->oilPressure(simN2) - paramImbalance + oilIdleRandom;
-
-    //--------------------------------------------
-    // Engine Writing
-    //--------------------------------------------
-    if (engine == 1) {
-      thermalEnergy1 = thermalEnergy;
-      oilTemperatureLeftPre = oilTemperature;
-      simVars->setEngine1Oil(oilQtyActual);
-      simVars->setEngine1TotalOil(oilTotalActual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempLeft, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &oilTemperature);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilPsiLeft, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &oilPressure);
-    } else {
-      thermalEnergy2 = thermalEnergy;
-      oilTemperatureRightPre = oilTemperature;
-      simVars->setEngine2Oil(oilQtyActual);
-      simVars->setEngine2TotalOil(oilTotalActual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempRight, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &oilTemperature);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilPsiRight, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &oilPressure);
-    }
+  void writeSimObjectData() {
+    payloadStations.writeAll(hSimConnect);
+    fuelMainTanks.writeAll(hSimConnect);
+    fuelAuxTanks.writeAll(hSimConnect);
+    writeEngineSimObjectData();
   }
 
   /// <summary>
@@ -691,22 +217,10 @@ class EngineControl {
     double cargoTotalWeightDesired = (cargoFwdContainerDesired + cargoAftContainerDesired + cargoAftBaggageDesired + cargoAftBulkDesired);
 
     if (abs(payloadTotalWeight - paxTotalWeightActual + cargoTotalWeightActual) > 5) {
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::PayloadStation1, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &paxRows1to6Actual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::PayloadStation2, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &paxRows7to13Actual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::PayloadStation3, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &paxRows14to21Actual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::PayloadStation4, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &paxRows22to29Actual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::PayloadStation5, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &cargoFwdContainerActual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::PayloadStation6, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &cargoAftContainerActual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::PayloadStation7, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &cargoAftBaggageActual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::PayloadStation8, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &cargoAftBulkActual);
+      // the stations of the sim differ from the payload of the EFB and are published even if they were published before
+      payloadStations.invalidate();
+      payloadStations.set({paxRows1to6Actual, paxRows7to13Actual, paxRows14to21Actual, paxRows22to29Actual, cargoFwdContainerActual,
+                           cargoAftContainerActual, cargoAftBaggageActual, cargoAftBulkActual});
     }
   }
 
@@ -726,14 +240,14 @@ class EngineControl {
     double pumpStateLeft = simVars->getPumpStateLeft();
     double pumpStateRight = simVars->getPumpStateRight();
 
-    double engine1PreFF = simVars->getEngine1PreFF();  // KG/H
-    double engine2PreFF = simVars->getEngine2PreFF();  // KG/H
-    double engine1FF = simVars->getEngine1FF();        // KG/H
-    double engine2FF = simVars->getEngine2FF();        // KG/H
+    double engine1PreFF = simVars->getEnginePreFF(1);  // KG/H
+    double engine2PreFF = simVars->getEnginePreFF(2);  // KG/H
+    double engine1FF = simVars->getEngineFF(1);        // KG/H
+    double engine2FF = simVars->getEngineFF(2);        // KG/H
 
     double fuelWeightGallon = simVars->getFuelWeightGallon();
-    double fuelUsedLeft = simVars->getFuelUsedLeft();    // Kg
-    double fuelUsedRight = simVars->getFuelUsedRight();  // Kg
+    double fuelUsedLeft = simVars->getFuelUsed(1);    // Kg
+    double fuelUsedRight = simVars->getFuelUsed(2);  // Kg
 
     double fuelLeftPre = simVars->getFuelLeftPre();                                   // LBS
     double fuelRightPre = simVars->getFuelRightPre();                                 // LBS
@@ -757,8 +271,8 @@ class EngineControl {
     double fuelTotalPre = fuelLeftPre + fuelRightPre + fuelAuxLeftPre + fuelAuxRightPre + fuelCenterPre;          // LBS
     double deltaFuelRate = abs(fuelTotalActual - fuelTotalPre) / (fuelWeightGallon * deltaTime);                  // LBS/ sec
 
-    double engine1State = simVars->getEngine1State();
-    double engine2State = simVars->getEngine2State();
+    double engine1State = simVars->getEngineState(1);
+    double engine2State = simVars->getEngineState(2);
 
     // Check Development State for UI
     devState = simVars->getDeveloperState();
@@ -824,13 +338,8 @@ class EngineControl {
         fuelLeftAux = (fuelAuxLeftPre / fuelWeightGallon);    // USG
         fuelRightAux = (fuelAuxRightPre / fuelWeightGallon);  // USG
 
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelCenterMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &fuelCenter);
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelLeftMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelLeft);
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelRightMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelRight);
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelLeftAux, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelLeftAux);
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelRightAux, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &fuelRightAux);
+        fuelMainTanks.set({fuelLeft, fuelRight, fuelCenter});
+        fuelAuxTanks.set({fuelLeftAux, fuelRightAux});
       }
     } else if (!uiFuelTamper && refuelStartedByUser == 1) {  // Detects refueling from the EFB
       simVars->setFuelLeftPre(leftQuantity);                 // in LBS
@@ -846,7 +355,7 @@ class EngineControl {
         // Cycle Fuel Burn for Engine 1
         m = (engine1FF - engine1PreFF) / deltaTime;
         b = engine1PreFF;
-        fuelBurn1 = (m * pow(deltaTime, 2) / 2) + (b * deltaTime);  // KG
+        fuelBurn1 = (m * deltaTime * deltaTime / 2) + (b * deltaTime);  // KG
 
         // Fuel Used Accumulators - Engine 1
         fuelUsedLeft += fuelBurn1;
@@ -870,7 +379,7 @@ class EngineControl {
         // Cycle Fuel Burn for Engine 2
         m = (engine2FF - engine2PreFF) / deltaTime;
         b = engine2PreFF;
-        fuelBurn2 = (m * pow(deltaTime, 2) / 2) + (b * deltaTime);  // KG
+        fuelBurn2 = (m * deltaTime * deltaTime / 2) + (b * deltaTime);  // KG
 
         // Fuel Used Accumulators - Engine 2
         fuelUsedRight += fuelBurn2;
@@ -916,10 +425,10 @@ class EngineControl {
       }
 
       // Setting new pre-cycle conditions
-      simVars->setEngine1PreFF(engine1FF);
-      simVars->setEngine2PreFF(engine2FF);
-      simVars->setFuelUsedLeft(fuelUsedLeft);         // in KG
-      simVars->setFuelUsedRight(fuelUsedRight);       // in KG
+      simVars->setEnginePreFF(1, engine1FF);
+      simVars->setEnginePreFF(2, engine2FF);
+      simVars->setFuelUsed(1, fuelUsedLeft);         // in KG
+      simVars->setFuelUsed(2, fuelUsedRight);       // in KG
       simVars->setFuelAuxLeftPre(leftAuxQuantity);    // in LBS
       simVars->setFuelAuxRightPre(rightAuxQuantity);  // in LBS
       simVars->setFuelCenterPre(fuelCenter);          // in LBS
@@ -931,9 +440,7 @@ class EngineControl {
       fuelRight = (fuelRight / fuelWeightGallon);    // USG
       fuelCenter = (fuelCenter / fuelWeightGallon);  // USG
 
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelCenterMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelCenter);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelLeftMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelLeft);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelRightMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelRight);
+      fuelMainTanks.set({fuelLeft, fuelRight, fuelCenter});
     }
 
     // Will save the current fuel quantities if on the ground AND engines being shutdown
@@ -948,9 +455,10 @@ class EngineControl {
       configuration.fuelLeftAux = simVars->getFuelAuxLeftPre() / simVars->getFuelWeightGallon();
       configuration.fuelRightAux = simVars->getFuelAuxRightPre() / simVars->getFuelWeightGallon();
 
-      saveFuelInConfiguration(configuration);
+      storeFuelInConfiguration(configuration);
       timerFuel.reset();
     }
+    writeConfiguration(false);
   }
 
   void updateThrustLimits(double simulationTime,
@@ -975,14 +483,14 @@ class EngineControl {
     double flex = 0;
 
     // Write all N1 Limits
-    to = limitN1(0, min(16600.0, pressAltitude), ambientTemp, ambientPressure, 0, packs, nai, wai);
-    ga = limitN1(1, min(16600.0, pressAltitude), ambientTemp, ambientPressure, 0, packs, nai, wai);
+    to = limitN1<FLEX_RATING>(0, min(16600.0, pressAltitude), ambientTemp, ambientPressure, 0, packs, nai, wai);
+    ga = limitN1<FLEX_RATING>(1, min(16600.0, pressAltitude), ambientTemp, ambientPressure, 0, packs, nai, wai);
     if (flexTemp > 0) {
-      flex_to = limitN1(0, min(16600.0, pressAltitude), ambientTemp, ambientPressure, flexTemp, packs, nai, wai);
-      flex_ga = limitN1(1, min(16600.0, pressAltitude), ambientTemp, ambientPressure, flexTemp, packs, nai, wai);
+      flex_to = limitN1<FLEX_RATING>(0, min(16600.0, pressAltitude), ambientTemp, ambientPressure, flexTemp, packs, nai, wai);
+      flex_ga = limitN1<FLEX_RATING>(1, min(16600.0, pressAltitude), ambientTemp, ambientPressure, flexTemp, packs, nai, wai);
     }
-    clb = limitN1(2, pressAltitude, ambientTemp, ambientPressure, 0, packs, nai, wai);
-    mct = limitN1(3, pressAltitude, ambientTemp, ambientPressure, 0, packs, nai, wai);
+    clb = limitN1<FLEX_RATING>(2, pressAltitude, ambientTemp, ambientPressure, 0, packs, nai, wai);
+    mct = limitN1<FLEX_RATING>(3, pressAltitude, ambientTemp, ambientPressure, 0, packs, nai, wai);
 
     // transition between TO and GA limit -----------------------------------------------------------------------------
     double machFactorLow = max(0.0, min(1.0, (mach - 0.04) / 0.04));
@@ -1059,6 +567,13 @@ class EngineControl {
   }
 
  public:
+  EngineControl()
+      : EngineProcedures({{DataTypesID::StartCN2Left, DataTypesID::StartCN2Right},
+                          DataTypesID::OilTemperatures,
+                          DataTypesID::OilTempLeft,
+                          DataTypesID::OilPressures,
+                          DataTypesID::OilPsiLeft}) {}
+
   /// <summary>
   /// Initialize the FADEC and Fuel model
   /// </summary>
@@ -1070,13 +585,12 @@ class EngineControl {
     simVars = new SimVars();
     double engTime = 0;
     ambientTemp = simVars->getAmbientTemperature();
-    simN2LeftPre = simVars->getN2(1);
-    simN2RightPre = simVars->getN2(2);
 
     confFilename += acftRegistration;
     confFilename += FILENAME_FADEC_CONF_FILE_EXTENSION;
 
     Configuration configuration = getConfigurationFromFile();
+    savedConfiguration = configuration;
 
     // One-off Engine imbalance
     generateEngineImbalance(1);
@@ -1088,7 +602,7 @@ class EngineControl {
       paramImbalance = 0;
     }
 
-    for (engine = 1; engine <= 2; engine++) {
+    for (engine = 1; engine <= SimVars::ENGINE_COUNT; engine++) {
       // Obtain Engine Time
       engTime = simVars->getEngineTime(engine) + engTime;
 
@@ -1103,45 +617,12 @@ class EngineControl {
       idleOil = initOil(140, 200);
 
       // Setting initial Oil
-      if (engine == 1) {
-        simVars->setEngine1TotalOil(idleOil - paramImbalance);
-      } else {
-        simVars->setEngine2TotalOil(idleOil - paramImbalance);
-      }
+      simVars->setEngineTotalOil(engine, idleOil - paramImbalance);
     }
 
-    // Setting initial Oil Temperature
-    thermalEnergy1 = 0;
-    thermalEnergy2 = 0;
+    // Setting initial Oil Temperature and Engine State
     oilTemperatureMax = imbalanceExtractor(imbalance, 8);
-    simOnGround = simVars->getSimOnGround();
-    double engine1Combustion = simVars->getEngineCombustion(1);
-    double engine2Combustion = simVars->getEngineCombustion(2);
-
-    if (simOnGround == 1 && engine1Combustion == 1 && engine2Combustion == 1) {
-      oilTemperatureLeftPre = 75;
-      oilTemperatureRightPre = 75;
-    } else if (simOnGround == 0 && engine1Combustion == 1 && engine2Combustion == 1) {
-      oilTemperatureLeftPre = 85;
-      oilTemperatureRightPre = 85;
-
-    } else {
-      oilTemperatureLeftPre = ambientTemp;
-      oilTemperatureRightPre = ambientTemp;
-    }
-
-    SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempLeft, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                  &oilTemperatureLeftPre);
-    SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempRight, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                  &oilTemperatureRightPre);
-
-    // Initialize Engine State
-    simVars->setEngine1State(10);
-    simVars->setEngine2State(10);
-
-    // Resetting Engine Timers
-    simVars->setEngine1Timer(0);
-    simVars->setEngine2Timer(0);
+    initializeEngines();
 
     // Initialize Fuel Tanks
     simVars->setFuelLeftPre(configuration.fuelLeft * simVars->getFuelWeightGallon());          // in LBS
@@ -1160,6 +641,9 @@ class EngineControl {
     simVars->setThrustLimitFlex(0);
     simVars->setThrustLimitClimb(0);
     simVars->setThrustLimitMct(0);
+
+    // Publish the initial values
+    simVars->writeAll();
   }
 
   /// <summary>
@@ -1170,6 +654,10 @@ class EngineControl {
     double prevAnimationDeltaTime;
     double simN1highest = 0;
 
+    // Read the LVars and SimVars of this cycle once
+    simVars->readAll();
+    readSimObjectData();
+
     // animationDeltaTimes being used to detect a Paused situation
     prevAnimationDeltaTime = animationDeltaTime;
     animationDeltaTime = simVars->getAnimDeltaTime();
@@ -1196,47 +684,11 @@ class EngineControl {
     generateIdleParameters(pressAltitude, mach, ambientTemp, ambientPressure);
 
     // Timer timer;
-    for (engine = 1; engine <= 2; engine++) {
-      engineStarter = simVars->getEngineStarter(engine);
-      engineIgniter = simVars->getEngineIgniter(engine);
-      simCN1 = simVars->getCN1(engine);
-      simN1 = simVars->getN1(engine);
-      simN2 = simVars->getN2(engine);
-      thrust = simVars->getThrust(engine);
-
-      // Set & Check Engine Status for this Cycle
-      engineStateMachine(engine, engineIgniter, engineStarter, simN2, idleN2, pressAltitude, ambientTemp,
-                         animationDeltaTime - prevAnimationDeltaTime);
-      if (engine == 1) {
-        engineState = simVars->getEngine1State();
-        deltaN2 = simN2 - simN2LeftPre;
-        simN2LeftPre = simN2;
-        timer = simVars->getEngine1Timer();
-      } else {
-        engineState = simVars->getEngine2State();
-        deltaN2 = simN2 - simN2RightPre;
-        simN2RightPre = simN2;
-        timer = simVars->getEngine2Timer();
-      }
+    updateEngines(getEngineImbalance(imbalance), deltaTime, animationDeltaTime - prevAnimationDeltaTime);
 
-      switch (int(engineState)) {
-        case 2:
-        case 3:
-          engineStartProcedure(engine, engineState, imbalance, deltaTime, timer, simN2, pressAltitude, ambientTemp);
-          break;
-        case 4:
-          engineShutdownProcedure(engine, ambientTemp, simN1, deltaTime, timer);
-          cFbwFF = updateFF(engine, imbalance, simCN1, mach, pressAltitude, ambientTemp, ambientPressure);
-          break;
-        default:
-          updatePrimaryParameters(engine, imbalance, simN1, simN2);
-          cFbwFF = updateFF(engine, imbalance, simCN1, mach, pressAltitude, ambientTemp, ambientPressure);
-          updateEGT(engine, imbalance, deltaTime, simOnGround, engineState, simCN1, cFbwFF, mach, pressAltitude, ambientTemp);
-          // updateOil(engine, imbalance, thrust, simN2, deltaN2, deltaTime, ambientTemp);
-      }
-
-      // set highest N1 from either engine
-      simN1highest = max(simN1highest, simN1);
+    // set highest N1 from all engines
+    for (int lane = 0; lane < SimVars::ENGINE_COUNT; lane++) {
+      simN1highest = max(simN1highest, engines.simN1[lane]);
     }
 
     // If Development State is 1, UI Payload will be enabled
@@ -1247,10 +699,17 @@ class EngineControl {
     updateFuel(deltaTime);
 
     updateThrustLimits(simulationTime, pressAltitude, ambientTemp, ambientPressure, mach, simN1highest, packs, nai, wai);
+
+    // Publish the changed LVars and SimConnect data of this cycle
+    simVars->writeAll();
+    writeSimObjectData();
     // timer.elapsed();
   }
 
-  void terminate() {}
+  /// <summary>
+  /// Writes the fuel configuration that is still pending
+  /// </summary>
+  void terminate() { writeConfiguration(true); }
 
   Configuration getConfigurationFromFile() {
     Configuration configuration;
@@ -1279,6 +738,39 @@ class EngineControl {
     };
   }
 
+  /// <summary>
+  /// Keeps the fuel configuration in memory if it changed, writeConfiguration() writes it to the file
+  /// </summary>
+  void storeFuelInConfiguration(const Configuration& configuration) {
+    if (configuration == (isConfigurationPending ? pendingConfiguration : savedConfiguration)) {
+      return;
+    }
+
+    if (!isConfigurationPending) {
+      timerConfigurationPending.reset();
+    }
+    pendingConfiguration = configuration;
+    isConfigurationPending = true;
+    timerConfigurationChanged.reset();
+  }
+
+  /// <summary>
+  /// Writes the pending fuel configuration once it settled or was pending for too long, or right away if forced
+  /// </summary>
+  void writeConfiguration(bool force) {
+    if (!isConfigurationPending) {
+      return;
+    }
+    if (!force && timerConfigurationChanged.elapsed() < CONFIGURATION_SETTLE_TIME &&
+        timerConfigurationPending.elapsed() < CONFIGURATION_MAX_DELAY) {
+      return;
+    }
+
+    saveFuelInConfiguration(pendingConfiguration);
+    savedConfiguration = pendingConfiguration;
+    isConfigurationPending = false;
+  }
+
   void saveFuelInConfiguration(Configuration configuration) {
     mINI::INIStructure stInitStructure;
     mINI::INIFile iniFile(confFilename);
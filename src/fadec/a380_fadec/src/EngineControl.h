@@ -1,5 +1,6 @@
 #pragma once
 
+#include "EngineProcedures.h"
 #include "RegPolynomials.h"
 #include "SimVars.h"
 #include "Tables.h"
@@ -8,7 +9,10 @@
 
 #include "ini_type_conversion.h"
 
+// the host harness in src/fadecsim keeps the configuration in its build directory
+#ifndef FILENAME_FADEC_CONF_DIRECTORY
 #define FILENAME_FADEC_CONF_DIRECTORY "\\work\\AircraftStates\\"
+#endif
 #define FILENAME_FADEC_CONF_FILE_EXTENSION ".ini"
 #define CONFIGURATION_SECTION_FUEL "FUEL"
 
@@ -25,69 +29,42 @@ struct Configuration {
   double fuelRight = fuelLeft;
   double fuelLeftAux = 228;
   double fuelRightAux = fuelLeftAux;
+
+  bool operator==(const Configuration&) const = default;
 };
 
-class EngineControl {
+class EngineControl : public EngineProcedures<SimVars, SimVars::ENGINE_COUNT> {
  private:
-  SimVars* simVars;
-  EngineRatios* ratios;
-  Polynomial* poly;
   Timer timerEngine1;
   Timer timerEngine2;
   Timer timerEngine3;
   Timer timerEngine4;
   Timer timerFuel;
 
+  // The fuel configuration file is written behind the fuel model: storeFuelInConfiguration() keeps the quantities in
+  // memory and writeConfiguration() writes them once they settled for CONFIGURATION_SETTLE_TIME, at the latest after
+  // CONFIGURATION_MAX_DELAY, and when the FADEC terminates.
+  Configuration savedConfiguration;
+  Configuration pendingConfiguration;
+  bool isConfigurationPending = false;
+  Timer timerConfigurationChanged;
+  Timer timerConfigurationPending;
+  const double CONFIGURATION_SETTLE_TIME = 5000;  // ms
+  const double CONFIGURATION_MAX_DELAY = 60000;   // ms
+
   std::string confFilename = FILENAME_FADEC_CONF_DIRECTORY;
 
-  bool simPaused;
   double animationDeltaTime;
-  double timer;
-  double ambientTemp;
-  double ambientPressure;
-  double simOnGround;
   double devState;
 
   int engine;
-  double engineState;
-  double engineStarter;
-  double engineIgniter;
 
   double packs;
   double nai;
   double wai;
 
-  double simCN1;
-  double simN1;
-  double simN2;
-  double thrust;
-  double simN2Engine1Pre;
-  double simN2Engine2Pre;
-  double simN2Engine3Pre;
-  double simN2Engine4Pre;
-  double deltaN2;
-  double thermalEnergy1;
-  double thermalEnergy2;
-  double thermalEnergy3;
-  double thermalEnergy4;
-  double oilTemperature;
-  double oilTemperatureEngine1Pre;
-  double oilTemperatureEngine2Pre;
-  double oilTemperatureEngine3Pre;
-  double oilTemperatureEngine4Pre;
-  double oilTemperatureMax;
-  double idleN1;
-  double idleN2;
-  double idleFF;
-  double idleEGT;
   double idleOil;
-  double mach;
-  double pressAltitude;
-  double correctedEGT;
-  double correctedFuelFlow;
-  double cFbwFF;
 
-  const double LBS_TO_KGS = 0.4535934;
   const double KGS_TO_LBS = 1 / 0.4535934;
   const double FUEL_THRESHOLD = 661;  // lbs/sec
 
@@ -102,25 +79,12 @@ class EngineControl {
   double transitionFactor = 0;
   double transitionStartTime = 0;
 
-  /// <summary>
-  /// Generate Idle/ Initial Engine Parameters (non-imbalanced)
-  /// </summary>
-  void generateIdleParameters(double pressAltitude, double mach, double ambientTemp, double ambientPressure) {
-    double idleCN1;
-    double idleCFF;
-
-    idleCN1 = iCN1(pressAltitude, mach, ambientTemp);
-    idleN1 = idleCN1 * sqrt(ratios->theta2(0, ambientTemp));
-    idleN2 = iCN2(pressAltitude, mach) * sqrt(ratios->theta(ambientTemp));
-    idleCFF = poly->correctedFuelFlow(idleCN1, 0, pressAltitude);                                               // lbs/hr
-    idleFF = idleCFF * LBS_TO_KGS * ratios->delta2(0, ambientPressure) * sqrt(ratios->theta2(0, ambientTemp));  // Kg/hr
-    idleEGT = poly->correctedEGT(idleCN1, idleCFF, 0, pressAltitude) * ratios->theta2(0, ambientTemp);
-
-    simVars->setEngineIdleN1(idleN1);
-    simVars->setEngineIdleN2(idleN2);
-    simVars->setEngineIdleFF(idleFF);
-    simVars->setEngineIdleEGT(idleEGT);
-  }
+  // flex rating of the shared thrust limits, flex temperatures are rated down to the corner point
+  static constexpr FlexRating FLEX_RATING = FlexRating::FullRange;
+  // SimConnect data of this cycle, published with one call per data definition
+  SimObjectDataSnapshot<8> payloadStations{DataTypesID::PayloadStations};
+  SimObjectDataSnapshot<3> fuelMainTanks{DataTypesID::FuelMainTanks};
+  SimObjectDataSnapshot<2> fuelAuxTanks{DataTypesID::FuelAuxTanks};
 
   double initOil(int minOil, int maxOil) {
     double idleOil = (rand() % (maxOil - minOil + 1) + minOil) / 10;
@@ -128,625 +92,22 @@ class EngineControl {
   }
 
   /// <summary>
-  /// Engine State Machine
-  /// 0 - Engine OFF, 1 - Engine ON, 2 - Engine Starting, 3 - Engine Re-starting & 4 - Engine Shutting
+  /// Starts the SimConnect data of this cycle from the values of the sim
   /// </summary>
-  void engineStateMachine(int engine,
-                          double engineIgniter,
-                          double engineStarter,
-                          double simN2,
-                          double idleN2,
-                          double pressAltitude,
-                          double ambientTemp,
-                          double deltaTimeDiff) {
-    int resetTimer = 0;
-    double egtFbw = 0;
-
-    switch (engine) {
-      case 1:
-        engineState = simVars->getEngine1State();
-        egtFbw = simVars->getEngine1EGT();
-        break;
-      case 2:
-        engineState = simVars->getEngine2State();
-        egtFbw = simVars->getEngine2EGT();
-        break;
-      case 3:
-        engineState = simVars->getEngine3State();
-        egtFbw = simVars->getEngine3EGT();
-        break;
-      case 4:
-        engineState = simVars->getEngine4State();
-        egtFbw = simVars->getEngine4EGT();
-        break;
-    }
-    // Present State PAUSED
-    if (deltaTimeDiff == 0 && engineState < 10) {
-      engineState = engineState + 10;
-      simPaused = true;
-    } else if (deltaTimeDiff == 0 && engineState >= 10) {
-      simPaused = true;
-    } else {
-      simPaused = false;
-
-      // Present State OFF
-      if (engineState == 0 || engineState == 10) {
-        if (engineIgniter == 1 && engineStarter == 1 && simN2 > 20) {
-          engineState = 1;
-        } else if (engineIgniter == 2 && engineStarter == 1) {
-          engineState = 2;
-        } else {
-          engineState = 0;
-        }
-      }
-
-      // Present State ON
-      if (engineState == 1 || engineState == 11) {
-        if (engineStarter == 1) {
-          engineState = 1;
-        } else {
-          engineState = 4;
-        }
-      }
-
-      // Present State Starting.
-      if (engineState == 2 || engineState == 12) {
-        if (engineStarter == 1 && simN2 >= (idleN2 - 0.1)) {
-          engineState = 1;
-          resetTimer = 1;
-        } else if (engineStarter == 0) {
-          engineState = 4;
-          resetTimer = 1;
-        } else {
-          engineState = 2;
-        }
-      }
-
-      // Present State Re-Starting.
-      if (engineState == 3 || engineState == 13) {
-        if (engineStarter == 1 && simN2 >= (idleN2 - 0.1)) {
-          engineState = 1;
-          resetTimer = 1;
-        } else if (engineStarter == 0) {
-          engineState = 4;
-          resetTimer = 1;
-        } else {
-          engineState = 3;
-        }
-      }
-
-      // Present State Shutting
-      if (engineState == 4 || engineState == 14) {
-        if (engineIgniter == 2 && engineStarter == 1) {
-          engineState = 3;
-          resetTimer = 1;
-        } else if (engineStarter == 0 && simN2 < 0.05 && egtFbw <= ambientTemp) {
-          engineState = 0;
-          resetTimer = 1;
-        } else if (engineStarter == 1 && simN2 > 50) {
-          engineState = 3;
-          resetTimer = 1;
-        } else {
-          engineState = 4;
-        }
-      }
-    }
-
-    switch (engine) {
-      case 1:
-        simVars->setEngine1State(engineState);
-        if (resetTimer == 1) {
-          simVars->setEngine1Timer(0);
-        }
-        break;
-      case 2:
-        simVars->setEngine2State(engineState);
-        if (resetTimer == 1) {
-          simVars->setEngine2Timer(0);
-        }
-        break;
-      case 3:
-        simVars->setEngine3State(engineState);
-        if (resetTimer == 1) {
-          simVars->setEngine3Timer(0);
-        }
-        break;
-      case 4:
-        simVars->setEngine4State(engineState);
-        if (resetTimer == 1) {
-          simVars->setEngine4Timer(0);
-        }
-        break;
-    }
-  }
-
-  /// <summary>
-  /// Engine Start Procedure
-  /// </summary>TIT
-  void engineStartProcedure(int engine,
-                            double engineState,
-                            double deltaTime,
-                            double timer,
-                            double simN2,
-                            double pressAltitude,
-                            double ambientTemp) {
-    double startCN2Engine1;
-    double startCN2Engine2;
-    double startCN2Engine3;
-    double startCN2Engine4;
-    double preN2Fbw;
-    double newN2Fbw;
-    double preEgtFbw;
-    double startEgtFbw;
-    double shutdownEgtFbw;
-
-    idleN2 = simVars->getEngineIdleN2();
-    idleN1 = simVars->getEngineIdleN1();
-    idleFF = simVars->getEngineIdleFF();
-    idleEGT = simVars->getEngineIdleEGT();
-
-    if (engine == 1) {
-      // Delay between Engine Master ON and Start Valve Open
-      if (timer < 1.7) {
-        if (simOnGround == 1) {
-          simVars->setFuelUsedEngine1(0);
-        }
-        simVars->setEngine1Timer(timer + deltaTime);
-        startCN2Engine1 = 0;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::StartCN2Engine1, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &startCN2Engine1);
-      } else {
-        preN2Fbw = simVars->getEngine1N2();
-        preEgtFbw = simVars->getEngine1EGT();
-        newN2Fbw = poly->startN2(simN2, preN2Fbw, idleN2);
-        startEgtFbw = poly->startEGT(newN2Fbw, idleN2, ambientTemp, idleEGT);
-        shutdownEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-
-        simVars->setEngine1N2(newN2Fbw);
-        simVars->setEngine1N1(poly->startN1(newN2Fbw, idleN2, idleN1));
-        simVars->setEngine1FF(poly->startFF(newN2Fbw, idleN2, idleFF));
-
-        if (engineState == 3) {
-          if (abs(startEgtFbw - preEgtFbw) <= 1.5) {
-            simVars->setEngine1EGT(startEgtFbw);
-            simVars->setEngine1State(2);
-          } else if (startEgtFbw > preEgtFbw) {
-            simVars->setEngine1EGT(preEgtFbw + (0.75 * deltaTime * (idleN2 - newN2Fbw)));
-          } else {
-            simVars->setEngine1EGT(shutdownEgtFbw);
-          }
-        } else {
-          simVars->setEngine1EGT(startEgtFbw);
-        }
-
-        oilTemperature = poly->startOilTemp(newN2Fbw, idleN2, ambientTemp);
-        oilTemperatureEngine1Pre = oilTemperature;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine1, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &oilTemperature);
-      }
-    } else if (engine == 2) {
-      if (timer < 1.7) {
-        if (simOnGround == 1) {
-          simVars->setFuelUsedEngine2(0);
-        }
-        simVars->setEngine2Timer(timer + deltaTime);
-        startCN2Engine2 = 0;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::StartCN2Engine2, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &startCN2Engine2);
-      } else {
-        preN2Fbw = simVars->getEngine2N2();
-        preEgtFbw = simVars->getEngine2EGT();
-        newN2Fbw = poly->startN2(simN2, preN2Fbw, idleN2);
-        startEgtFbw = poly->startEGT(newN2Fbw, idleN2, ambientTemp, idleEGT);
-        shutdownEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-
-        simVars->setEngine2N2(newN2Fbw);
-        simVars->setEngine2N1(poly->startN1(newN2Fbw, idleN2, idleN1));
-        simVars->setEngine2FF(poly->startFF(newN2Fbw, idleN2, idleFF));
-
-        if (engineState == 3) {
-          if (abs(startEgtFbw - preEgtFbw) <= 1.5) {
-            simVars->setEngine2EGT(startEgtFbw);
-            simVars->setEngine2State(2);
-          } else if (startEgtFbw > preEgtFbw) {
-            simVars->setEngine2EGT(preEgtFbw + (0.75 * deltaTime * (idleN2 - newN2Fbw)));
-          } else {
-            simVars->setEngine2EGT(shutdownEgtFbw);
-          }
-        } else {
-          simVars->setEngine2EGT(startEgtFbw);
-        }
-
-        oilTemperature = poly->startOilTemp(newN2Fbw, idleN2, ambientTemp);
-        oilTemperatureEngine2Pre = oilTemperature;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine2, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &oilTemperature);
-      }
-    } else if (engine == 3) {
-      if (timer < 1.7) {
-        if (simOnGround == 1) {
-          simVars->setFuelUsedEngine3(0);
-        }
-        simVars->setEngine3Timer(timer + deltaTime);
-        startCN2Engine3 = 0;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::StartCN2Engine3, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &startCN2Engine3);
-      } else {
-        preN2Fbw = simVars->getEngine3N2();
-        preEgtFbw = simVars->getEngine3EGT();
-        newN2Fbw = poly->startN2(simN2, preN2Fbw, idleN2);
-        startEgtFbw = poly->startEGT(newN2Fbw, idleN2, ambientTemp, idleEGT);
-        shutdownEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-
-        simVars->setEngine3N2(newN2Fbw);
-        simVars->setEngine3N1(poly->startN1(newN2Fbw, idleN2, idleN1));
-        simVars->setEngine3FF(poly->startFF(newN2Fbw, idleN2, idleFF));
-
-        if (engineState == 3) {
-          if (abs(startEgtFbw - preEgtFbw) <= 1.5) {
-            simVars->setEngine3EGT(startEgtFbw);
-            simVars->setEngine3State(2);
-          } else if (startEgtFbw > preEgtFbw) {
-            simVars->setEngine3EGT(preEgtFbw + (0.75 * deltaTime * (idleN2 - newN2Fbw)));
-          } else {
-            simVars->setEngine3EGT(shutdownEgtFbw);
-          }
-        } else {
-          simVars->setEngine3EGT(startEgtFbw);
-        }
-
-        oilTemperature = poly->startOilTemp(newN2Fbw, idleN2, ambientTemp);
-        oilTemperatureEngine3Pre = oilTemperature;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine3, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &oilTemperature);
-      }
-    } else {
-      if (timer < 1.7) {
-        if (simOnGround == 1) {
-          simVars->setFuelUsedEngine4(0);
-        }
-        simVars->setEngine4Timer(timer + deltaTime);
-        startCN2Engine4 = 0;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::StartCN2Engine4, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &startCN2Engine4);
-      } else {
-        preN2Fbw = simVars->getEngine4N2();
-        preEgtFbw = simVars->getEngine4EGT();
-        newN2Fbw = poly->startN2(simN2, preN2Fbw, idleN2);
-        startEgtFbw = poly->startEGT(newN2Fbw, idleN2, ambientTemp, idleEGT);
-        shutdownEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-
-        simVars->setEngine4N2(newN2Fbw);
-        simVars->setEngine4N1(poly->startN1(newN2Fbw, idleN2, idleN1));
-        simVars->setEngine4FF(poly->startFF(newN2Fbw, idleN2, idleFF));
-
-        if (engineState == 3) {
-          if (abs(startEgtFbw - preEgtFbw) <= 1.5) {
-            simVars->setEngine4EGT(startEgtFbw);
-            simVars->setEngine4State(2);
-          } else if (startEgtFbw > preEgtFbw) {
-            simVars->setEngine4EGT(preEgtFbw + (0.75 * deltaTime * (idleN2 - newN2Fbw)));
-          } else {
-            simVars->setEngine4EGT(shutdownEgtFbw);
-          }
-        } else {
-          simVars->setEngine4EGT(startEgtFbw);
-        }
-
-        oilTemperature = poly->startOilTemp(newN2Fbw, idleN2, ambientTemp);
-        oilTemperatureEngine4Pre = oilTemperature;
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine4, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &oilTemperature);
-      }
-    }
+  void readSimObjectData() {
+    readEngineSimObjectData();
+    fuelMainTanks.setCurrent({simVars->getTankLeftQuantity(), simVars->getTankRightQuantity(), simVars->getTankCenterQuantity()});
+    fuelAuxTanks.setCurrent({simVars->getTankLeftAuxQuantity(), simVars->getTankRightAuxQuantity()});
   }
 
   /// <summary>
-  /// Engine Shutdown Procedure - TEMPORAL SOLUTION
+  /// Publishes the SimConnect data that was set in this cycle and differs from the sim
   /// </summary>
-  void engineShutdownProcedure(int engine, double ambientTemp, double simN1, double deltaTime, double timer) {
-    double preN1Fbw;
-    double preN2Fbw;
-    double preEgtFbw;
-    double newN1Fbw;
-    double newN2Fbw;
-    double newEgtFbw;
-
-    if (engine == 1) {
-      if (timer < 1.8) {
-        simVars->setEngine1Timer(timer + deltaTime);
-      } else {
-        preN1Fbw = simVars->getEngine1N1();
-        preN2Fbw = simVars->getEngine1N2();
-        preEgtFbw = simVars->getEngine1EGT();
-        newN1Fbw = poly->shutdownN1(preN1Fbw, deltaTime);
-        if (simN1 < 5 && simN1 > newN1Fbw) {  // Takes care of windmilling
-          newN1Fbw = simN1;
-        }
-        newN2Fbw = poly->shutdownN2(preN2Fbw, deltaTime);
-        newEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-        simVars->setEngine1N1(newN1Fbw);
-        simVars->setEngine1N2(newN2Fbw);
-        simVars->setEngine1EGT(newEgtFbw);
-      }
-    } else if (engine == 2) {
-      if (timer < 1.8) {
-        simVars->setEngine2Timer(timer + deltaTime);
-      } else {
-        preN1Fbw = simVars->getEngine2N1();
-        preN2Fbw = simVars->getEngine2N2();
-        preEgtFbw = simVars->getEngine2EGT();
-        newN1Fbw = poly->shutdownN1(preN1Fbw, deltaTime);
-        if (simN1 < 5 && simN1 > newN1Fbw) {  // Takes care of windmilling
-          newN1Fbw = simN1;
-        }
-        newN2Fbw = poly->shutdownN2(preN2Fbw, deltaTime);
-        newEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-        simVars->setEngine2N1(newN1Fbw);
-        simVars->setEngine2N2(newN2Fbw);
-        simVars->setEngine2EGT(newEgtFbw);
-      }
-    } else if (engine == 3) {
-      if (timer < 1.8) {
-        simVars->setEngine3Timer(timer + deltaTime);
-      } else {
-        preN1Fbw = simVars->getEngine3N1();
-        preN2Fbw = simVars->getEngine3N2();
-        preEgtFbw = simVars->getEngine3EGT();
-        newN1Fbw = poly->shutdownN1(preN1Fbw, deltaTime);
-        if (simN1 < 5 && simN1 > newN1Fbw) {  // Takes care of windmilling
-          newN1Fbw = simN1;
-        }
-        newN2Fbw = poly->shutdownN2(preN2Fbw, deltaTime);
-        newEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-        simVars->setEngine3N1(newN1Fbw);
-        simVars->setEngine3N2(newN2Fbw);
-        simVars->setEngine3EGT(newEgtFbw);
-      }
-    } else {
-      if (timer < 1.8) {
-        simVars->setEngine4Timer(timer + deltaTime);
-      } else {
-        preN1Fbw = simVars->getEngine4N1();
-        preN2Fbw = simVars->getEngine4N2();
-        preEgtFbw = simVars->getEngine4EGT();
-        newN1Fbw = poly->shutdownN1(preN1Fbw, deltaTime);
-        if (simN1 < 5 && simN1 > newN1Fbw) {  // Takes care of windmilling
-          newN1Fbw = simN1;
-        }
-        newN2Fbw = poly->shutdownN2(preN2Fbw, deltaTime);
-        newEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
-        simVars->setEngine4N1(newN1Fbw);
-        simVars->setEngine4N2(newN2Fbw);
-        simVars->setEngine4EGT(newEgtFbw);
-      }
-    }
-  }
-  /// <summary>
-  /// FBW Engine RPM (N1 and N2)
-  /// Updates Engine N1 and N2 with our own algorithm for start-up and shutdown
-  /// </summary>
-  void updatePrimaryParameters(int engine, double simN1, double simN2) {
-
-    if (engine == 1) {
-      simVars->setEngine1N1(simN1);
-      simVars->setEngine1N2(simN2);
-    } else if (engine == 2) {
-      simVars->setEngine2N1(simN1);
-      simVars->setEngine2N2(simN2);
-    } else if (engine == 3) {
-      simVars->setEngine3N1(simN1);
-      simVars->setEngine3N2(simN2);
-    } else {
-      simVars->setEngine4N1(simN1);
-      simVars->setEngine4N2(simN2);
-    }
-  }
-
-  /// <summary>
-  /// FBW Exhaust Gas Temperature (in degree Celsius)
-  /// Updates EGT with realistic values visualized in the ECAM
-  /// </summary>
-  void updateEGT(int engine,
-                 double deltaTime,
-                 double simOnGround,
-                 double engineState,
-                 double simCN1,
-                 double cFbwFF,
-                 double mach,
-                 double pressAltitude,
-                 double ambientTemp) {
-    double egtFbwPreviousEng1;
-    double egtFbwActualEng1;
-    double egtFbwPreviousEng2;
-    double egtFbwActualEng2;
-    double egtFbwPreviousEng3;
-    double egtFbwActualEng3;
-    double egtFbwPreviousEng4;
-    double egtFbwActualEng4;
-
-    correctedEGT = poly->correctedEGT(simCN1, cFbwFF, mach, pressAltitude);
-
-    if (engine == 1) {
-      if (simOnGround == 1 && engineState == 0) {
-        simVars->setEngine1EGT(ambientTemp);
-      } else {
-        egtFbwPreviousEng1 = simVars->getEngine1EGT();
-        egtFbwActualEng1 = (correctedEGT * ratios->theta2(mach, ambientTemp));
-        egtFbwActualEng1 = egtFbwActualEng1 + (egtFbwPreviousEng1 - egtFbwActualEng1) * expFBW(-0.1 * deltaTime);
-        simVars->setEngine1EGT(egtFbwActualEng1);
-      }
-    } else if (engine == 2) {
-      if (simOnGround == 1 && engineState == 0) {
-        simVars->setEngine2EGT(ambientTemp);
-      } else {
-        egtFbwPreviousEng2 = simVars->getEngine2EGT();
-        egtFbwActualEng2 = (correctedEGT * ratios->theta2(mach, ambientTemp));
-        egtFbwActualEng2 = egtFbwActualEng2 + (egtFbwPreviousEng2 - egtFbwActualEng2) * expFBW(-0.1 * deltaTime);
-        simVars->setEngine2EGT(egtFbwActualEng2);
-      }
-    } else if (engine == 3) {
-      if (simOnGround == 1 && engineState == 0) {
-        simVars->setEngine3EGT(ambientTemp);
-      } else {
-        egtFbwPreviousEng3 = simVars->getEngine3EGT();
-        egtFbwActualEng3 = (correctedEGT * ratios->theta2(mach, ambientTemp));
-        egtFbwActualEng3 = egtFbwActualEng3 + (egtFbwPreviousEng3 - egtFbwActualEng3) * expFBW(-0.1 * deltaTime);
-        simVars->setEngine3EGT(egtFbwActualEng3);
-      }
-    } else {
-      if (simOnGround == 1 && engineState == 0) {
-        simVars->setEngine4EGT(ambientTemp);
-      } else {
-        egtFbwPreviousEng4 = simVars->getEngine3EGT();
-        egtFbwActualEng4 = (correctedEGT * ratios->theta2(mach, ambientTemp));
-        egtFbwActualEng4 = egtFbwActualEng4 + (egtFbwPreviousEng4 - egtFbwActualEng4) * expFBW(-0.1 * deltaTime);
-        simVars->setEngine4EGT(egtFbwActualEng4);
-      }
-    }
-  }
-
-  /// <summary>
-  /// FBW Fuel FLow (in Kg/h)
-  /// Updates Fuel Flow with realistic values
-  /// </summary>
-  double updateFF(int engine, double simCN1, double mach, double pressAltitude, double ambientTemp, double ambientPressure) {
-    double outFlow = 0;
-
-    correctedFuelFlow = poly->correctedFuelFlow(simCN1, mach, pressAltitude);  // in lbs/hr.
-
-    // Checking Fuel Logic and final Fuel Flow
-    if (correctedFuelFlow < 1) {
-      outFlow = 0;
-    } else {
-      outFlow = (correctedFuelFlow * LBS_TO_KGS * ratios->delta2(mach, ambientPressure) * sqrt(ratios->theta2(mach, ambientTemp)));
-    }
-
-    if (engine == 1) {
-      simVars->setEngine1FF(outFlow);
-    } else if (engine == 2) {
-      simVars->setEngine2FF(outFlow);
-    } else if (engine == 3) {
-      simVars->setEngine3FF(outFlow);
-    } else {
-      simVars->setEngine4FF(outFlow);
-    }
-
-    return correctedFuelFlow;
-  }
-
-  /// <summary>
-  /// FBW Oil Qty, Pressure and Temperature (in Quarts, PSI and degree Celsius)
-  /// Updates Oil with realistic values visualized in the SD
-  /// </summary>
-  void updateOil(int engine, double thrust, double simN2, double deltaN2, double deltaTime, double ambientTemp) {
-    double steadyTemperature;
-    double thermalEnergy;
-    double oilTemperaturePre;
-    double oilQtyActual;
-    double oilTotalActual;
-    double oilQtyObjective;
-    double oilBurn;
-    double oilPressureIdle;
-    double oilPressure;
-
-    //--------------------------------------------
-    // Engine Reading
-    //--------------------------------------------
-    if (engine == 1) {
-      steadyTemperature = simVars->getEngine1EGT();
-      thermalEnergy = thermalEnergy1;
-      oilTemperaturePre = oilTemperatureEngine1Pre;
-      oilQtyActual = simVars->getEngine1Oil();
-      oilTotalActual = simVars->getEngine1TotalOil();
-    } else if (engine == 2) {
-      steadyTemperature = simVars->getEngine2EGT();
-      thermalEnergy = thermalEnergy2;
-      oilTemperaturePre = oilTemperatureEngine2Pre;
-      oilQtyActual = simVars->getEngine2Oil();
-      oilTotalActual = simVars->getEngine2TotalOil();
-    } else if (engine == 3) {
-      steadyTemperature = simVars->getEngine3EGT();
-      thermalEnergy = thermalEnergy3;
-      oilTemperaturePre = oilTemperatureEngine3Pre;
-      oilQtyActual = simVars->getEngine3Oil();
-      oilTotalActual = simVars->getEngine3TotalOil();
-    } else {
-      steadyTemperature = simVars->getEngine4EGT();
-      thermalEnergy = thermalEnergy4;
-      oilTemperaturePre = oilTemperatureEngine4Pre;
-      oilQtyActual = simVars->getEngine4Oil();
-      oilTotalActual = simVars->getEngine4TotalOil();
-    }
-
-    //--------------------------------------------
-    // Oil Temperature
-    //--------------------------------------------
-    if (simOnGround == 1 && engineState == 0 && ambientTemp > oilTemperaturePre - 10) {
-      oilTemperature = ambientTemp;
-    } else {
-      if (steadyTemperature > oilTemperatureMax) {
-        steadyTemperature = oilTemperatureMax;
-      }
-      thermalEnergy = (0.995 * thermalEnergy) + (deltaN2 / deltaTime);
-      oilTemperature = poly->oilTemperature(thermalEnergy, oilTemperaturePre, steadyTemperature, deltaTime);
-    }
-
-    //--------------------------------------------
-    // Oil Quantity
-    //--------------------------------------------
-    // Calculating Oil Qty as a function of thrust
-    oilQtyObjective = oilTotalActual * (1 - poly->oilGulpPct(thrust));
-    oilQtyActual = oilQtyActual - (oilTemperature - oilTemperaturePre);
-
-    // Oil burnt taken into account for tank and total oil
-    oilBurn = (0.00011111 * deltaTime);
-    oilQtyActual = oilQtyActual - oilBurn;
-    oilTotalActual = oilTotalActual - oilBurn;
-
-    //--------------------------------------------
-    // Oil Pressure
-    //--------------------------------------------
-    oilPressureIdle = 0;
-
-    oilPressure = poly->oilPressure(simN2) + oilPressureIdle;
-
-    //--------------------------------------------
-    // Engine Writing
-    //--------------------------------------------
-    if (engine == 1) {
-      thermalEnergy1 = thermalEnergy;
-      oilTemperatureEngine1Pre = oilTemperature;
-      simVars->setEngine1Oil(oilQtyActual);
-      simVars->setEngine1TotalOil(oilTotalActual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine1, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &oilTemperature);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilPsiEngine1, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &oilPressure);
-    } else if (engine == 2) {
-      thermalEnergy2 = thermalEnergy;
-      oilTemperatureEngine2Pre = oilTemperature;
-      simVars->setEngine2Oil(oilQtyActual);
-      simVars->setEngine2TotalOil(oilTotalActual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine2, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &oilTemperature);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilPsiEngine2, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &oilPressure);
-    } else if (engine == 3) {
-      thermalEnergy3 = thermalEnergy;
-      oilTemperatureEngine3Pre = oilTemperature;
-      simVars->setEngine3Oil(oilQtyActual);
-      simVars->setEngine3TotalOil(oilTotalActual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine3, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &oilTemperature);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilPsiEngine3, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &oilPressure);
-    } else {
-      thermalEnergy4 = thermalEnergy;
-      oilTemperatureEngine4Pre = oilTemperature;
-      simVars->setEngine4Oil(oilQtyActual);
-      simVars->setEngine4TotalOil(oilTotalActual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine4, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &oilTemperature);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilPsiEngine4, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &oilPressure);
-    }
+  void writeSimObjectData() {
+    payloadStations.writeAll(hSimConnect);
+    fuelMainTanks.writeAll(hSimConnect);
+    fuelAuxTanks.writeAll(hSimConnect);
+    writeEngineSimObjectData();
   }
 
   /// <summary>
@@ -783,22 +144,10 @@ class EngineControl {
     double cargoTotalWeightDesired = (cargoFwdContainerDesired + cargoAftContainerDesired + cargoAftBaggageDesired + cargoAftBulkDesired);
 
     if (abs(payloadTotalWeight - paxTotalWeightActual + cargoTotalWeightActual) > 5) {
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::PayloadStation1, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &paxRows1to6Actual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::PayloadStation2, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &paxRows7to13Actual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::PayloadStation3, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &paxRows14to21Actual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::PayloadStation4, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &paxRows22to29Actual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::PayloadStation5, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &cargoFwdContainerActual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::PayloadStation6, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &cargoAftContainerActual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::PayloadStation7, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &cargoAftBaggageActual);
-      SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::PayloadStation8, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                    &cargoAftBulkActual);
+      // the stations of the sim differ from the payload of the EFB and are published even if they were published before
+      payloadStations.invalidate();
+      payloadStations.set({paxRows1to6Actual, paxRows7to13Actual, paxRows14to21Actual, paxRows22to29Actual, cargoFwdContainerActual,
+                           cargoAftContainerActual, cargoAftBaggageActual, cargoAftBulkActual});
     }
   }
 
@@ -822,20 +171,20 @@ class EngineControl {
     double pumpStateEngine3 = simVars->getPumpStateEngine3();
     double pumpStateEngine4 = simVars->getPumpStateEngine4();
 
-    double engine1PreFF = simVars->getEngine1PreFF();  // KG/H
-    double engine2PreFF = simVars->getEngine2PreFF();  // KG/H
-    double engine3PreFF = simVars->getEngine3PreFF();  // KG/H
-    double engine4PreFF = simVars->getEngine4PreFF();  // KG/H
-    double engine1FF = simVars->getEngine1FF();        // KG/H
-    double engine2FF = simVars->getEngine2FF();        // KG/H
-    double engine3FF = simVars->getEngine3FF();        // KG/H
-    double engine4FF = simVars->getEngine4FF();        // KG/H
+    double engine1PreFF = simVars->getEnginePreFF(1);  // KG/H
+    double engine2PreFF = simVars->getEnginePreFF(2);  // KG/H
+    double engine3PreFF = simVars->getEnginePreFF(3);  // KG/H
+    double engine4PreFF = simVars->getEnginePreFF(4);  // KG/H
+    double engine1FF = simVars->getEngineFF(1);        // KG/H
+    double engine2FF = simVars->getEngineFF(2);        // KG/H
+    double engine3FF = simVars->getEngineFF(3);        // KG/H
+    double engine4FF = simVars->getEngineFF(4);        // KG/H
 
     double fuelWeightGallon = simVars->getFuelWeightGallon();
-    double fuelUsedEngine1 = simVars->getFuelUsedEngine1();    // Kg
-    double fuelUsedEngine2 = simVars->getFuelUsedEngine2();  // Kg
-    double fuelUsedEngine3 = simVars->getFuelUsedEngine3();    // Kg
-    double fuelUsedEngine4 = simVars->getFuelUsedEngine4();    // Kg
+    double fuelUsedEngine1 = simVars->getFuelUsed(1);    // Kg
+    double fuelUsedEngine2 = simVars->getFuelUsed(2);  // Kg
+    double fuelUsedEngine3 = simVars->getFuelUsed(3);    // Kg
+    double fuelUsedEngine4 = simVars->getFuelUsed(4);    // Kg
 
     double fuelLeftPre = simVars->getFuelLeftPre();                                   // LBS
     double fuelRightPre = simVars->getFuelRightPre();                                 // LBS
@@ -859,10 +208,10 @@ class EngineControl {
     double fuelTotalPre = fuelLeftPre + fuelRightPre + fuelAuxLeftPre + fuelAuxRightPre + fuelCenterPre;          // LBS
     double deltaFuelRate = abs(fuelTotalActual - fuelTotalPre) / (fuelWeightGallon * deltaTime);                  // LBS/ sec
 
-    double engine1State = simVars->getEngine1State();
-    double engine2State = simVars->getEngine2State();
-    double engine3State = simVars->getEngine3State();
-    double engine4State = simVars->getEngine4State();
+    double engine1State = simVars->getEngineState(1);
+    double engine2State = simVars->getEngineState(2);
+    double engine3State = simVars->getEngineState(3);
+    double engine4State = simVars->getEngineState(4);
 
     // Check Development State for UI
     devState = simVars->getDeveloperState();
@@ -968,13 +317,8 @@ class EngineControl {
         fuelLeftAux = (fuelAuxLeftPre / fuelWeightGallon);    // USG
         fuelRightAux = (fuelAuxRightPre / fuelWeightGallon);  // USG
 
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelCenterMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &fuelCenter);
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelLeftMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelLeft);
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelRightMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelRight);
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelLeftAux, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelLeftAux);
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelRightAux, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &fuelRightAux);
+        fuelMainTanks.set({fuelLeft, fuelRight, fuelCenter});
+        fuelAuxTanks.set({fuelLeftAux, fuelRightAux});
       }
     } else if (!uiFuelTamper && refuelStartedByUser == 1) {  // Detects refueling from the EFB
       simVars->setFuelLeftPre(leftQuantity);                 // in LBS
@@ -990,7 +334,7 @@ class EngineControl {
         // Cycle Fuel Burn for Engine 1
         m = (engine1FF - engine1PreFF) / deltaTime;
         b = engine1PreFF;
-        fuelBurn1 = (m * pow(deltaTime, 2) / 2) + (b * deltaTime);  // KG
+        fuelBurn1 = (m * deltaTime * deltaTime / 2) + (b * deltaTime);  // KG
 
         // Fuel Used Accumulators - Engine 1
         fuelUsedEngine1 += fuelBurn1;
@@ -1014,7 +358,7 @@ class EngineControl {
         // Cycle Fuel Burn for Engine 2
         m = (engine2FF - engine2PreFF) / deltaTime;
         b = engine2PreFF;
-        fuelBurn2 = (m * pow(deltaTime, 2) / 2) + (b * deltaTime);  // KG
+        fuelBurn2 = (m * deltaTime * deltaTime / 2) + (b * deltaTime);  // KG
 
         // Fuel Used Accumulators - Engine 2
         fuelUsedEngine2 += fuelBurn2;
@@ -1038,7 +382,7 @@ class EngineControl {
         // Cycle Fuel Burn for Engine 3
         m = (engine3FF - engine3PreFF) / deltaTime;
         b = engine3PreFF;
-        fuelBurn3 = (m * pow(deltaTime, 2) / 2) + (b * deltaTime);  // KG
+        fuelBurn3 = (m * deltaTime * deltaTime / 2) + (b * deltaTime);  // KG
 
         // Fuel Used Accumulators - Engine 3
         fuelUsedEngine3 += fuelBurn3;
@@ -1062,7 +406,7 @@ class EngineControl {
         // Cycle Fuel Burn for Engine 4
         m = (engine4FF - engine4PreFF) / deltaTime;
         b = engine4PreFF;
-        fuelBurn4 = (m * pow(deltaTime, 2) / 2) + (b * deltaTime);  // KG
+        fuelBurn4 = (m * deltaTime * deltaTime / 2) + (b * deltaTime);  // KG
 
         // Fuel Used Accumulators - Engine 4
         fuelUsedEngine4 += fuelBurn4;
@@ -1115,14 +459,14 @@ class EngineControl {
       }
 
       // Setting new pre-cycle conditions
-      simVars->setEngine1PreFF(engine1FF);
-      simVars->setEngine2PreFF(engine2FF);
-      simVars->setEngine3PreFF(engine3FF);
-      simVars->setEngine4PreFF(engine4FF);
-      simVars->setFuelUsedEngine1(fuelUsedEngine1);       // in KG
-      simVars->setFuelUsedEngine2(fuelUsedEngine2);       // in KG
-      simVars->setFuelUsedEngine3(fuelUsedEngine3);       // in KG
-      simVars->setFuelUsedEngine4(fuelUsedEngine4);       // in KG
+      simVars->setEnginePreFF(1, engine1FF);
+      simVars->setEnginePreFF(2, engine2FF);
+      simVars->setEnginePreFF(3, engine3FF);
+      simVars->setEnginePreFF(4, engine4FF);
+      simVars->setFuelUsed(1, fuelUsedEngine1);       // in KG
+      simVars->setFuelUsed(2, fuelUsedEngine2);       // in KG
+      simVars->setFuelUsed(3, fuelUsedEngine3);       // in KG
+      simVars->setFuelUsed(4, fuelUsedEngine4);       // in KG
       simVars->setFuelAuxLeftPre(leftAuxQuantity);    // in LBS
       simVars->setFuelAuxRightPre(rightAuxQuantity);  // in LBS
       simVars->setFuelCenterPre(fuelCenter);          // in LBS
@@ -1134,10 +478,7 @@ class EngineControl {
       fuelRight = (fuelRight / fuelWeightGallon);    // USG
       fuelCenter = (fuelCenter / fuelWeightGallon);  // USG
       if (devState != 2) {
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelCenterMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                      &fuelCenter);
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelLeftMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelLeft);
-        SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::FuelRightMain, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &fuelRight);
+        fuelMainTanks.set({fuelLeft, fuelRight, fuelCenter});
       }
     }
 
@@ -1154,9 +495,10 @@ class EngineControl {
       configuration.fuelLeftAux = simVars->getFuelAuxLeftPre() / simVars->getFuelWeightGallon();
       configuration.fuelRightAux = simVars->getFuelAuxRightPre() / simVars->getFuelWeightGallon();
 
-      saveFuelInConfiguration(configuration);
+      storeFuelInConfiguration(configuration);
       timerFuel.reset();
     }
+    writeConfiguration(false);
   }
 
   void updateThrustLimits(double simulationTime,
@@ -1181,14 +523,14 @@ class EngineControl {
     double flex = 0;
 
     // Write all N1 Limits
-    to = limitN1(0, min(16600.0, pressAltitude), ambientTemp, ambientPressure, 0, packs, nai, wai);
-    ga = limitN1(1, min(16600.0, pressAltitude), ambientTemp, ambientPressure, 0, packs, nai, wai);
+    to = limitN1<FLEX_RATING>(0, min(16600.0, pressAltitude), ambientTemp, ambientPressure, 0, packs, nai, wai);
+    ga = limitN1<FLEX_RATING>(1, min(16600.0, pressAltitude), ambientTemp, ambientPressure, 0, packs, nai, wai);
     if (flexTemp > 0) {
-      flex_to = limitN1(0, min(16600.0, pressAltitude), ambientTemp, ambientPressure, flexTemp, packs, nai, wai);
-      flex_ga = limitN1(1, min(16600.0, pressAltitude), ambientTemp, ambientPressure, flexTemp, packs, nai, wai);
+      flex_to = limitN1<FLEX_RATING>(0, min(16600.0, pressAltitude), ambientTemp, ambientPressure, flexTemp, packs, nai, wai);
+      flex_ga = limitN1<FLEX_RATING>(1, min(16600.0, pressAltitude), ambientTemp, ambientPressure, flexTemp, packs, nai, wai);
     }
-    clb = limitN1(2, pressAltitude, ambientTemp, ambientPressure, 0, packs, nai, wai);
-    mct = limitN1(3, pressAltitude, ambientTemp, ambientPressure, 0, packs, nai, wai);
+    clb = limitN1<FLEX_RATING>(2, pressAltitude, ambientTemp, ambientPressure, 0, packs, nai, wai);
+    mct = limitN1<FLEX_RATING>(3, pressAltitude, ambientTemp, ambientPressure, 0, packs, nai, wai);
 
     // transition between TO and GA limit -----------------------------------------------------------------------------
     double machFactorLow = max(0.0, min(1.0, (mach - 0.04) / 0.04));
@@ -1265,6 +607,14 @@ class EngineControl {
   }
 
  public:
+  EngineControl()
+      : EngineProcedures({{DataTypesID::StartCN2Engine1, DataTypesID::StartCN2Engine2, DataTypesID::StartCN2Engine3,
+                           DataTypesID::StartCN2Engine4},
+                          DataTypesID::OilTemperatures,
+                          DataTypesID::OilTempEngine1,
+                          DataTypesID::OilPressures,
+                          DataTypesID::OilPsiEngine1}) {}
+
   /// <summary>
   /// Initialize the FADEC and Fuel model
   /// </summary>
@@ -1276,17 +626,14 @@ class EngineControl {
     simVars = new SimVars();
     double engTime = 0;
     ambientTemp = simVars->getAmbientTemperature();
-    simN2Engine1Pre = simVars->getN2(1);
-    simN2Engine2Pre = simVars->getN2(2);
-    simN2Engine3Pre = simVars->getN2(3);
-    simN2Engine4Pre = simVars->getN2(4);
 
     confFilename += acftRegistration;
     confFilename += FILENAME_FADEC_CONF_FILE_EXTENSION;
 
     Configuration configuration = getConfigurationFromFile();
+    savedConfiguration = configuration;
 
-    for (engine = 1; engine <= 4; engine++) {
+    for (engine = 1; engine <= SimVars::ENGINE_COUNT; engine++) {
       // Obtain Engine Time
       engTime = simVars->getEngineTime(engine) + engTime;
 
@@ -1294,66 +641,12 @@ class EngineControl {
       idleOil = initOil(140, 200);
 
       // Setting initial Oil
-      if (engine == 1) {
-        simVars->setEngine1TotalOil(idleOil);
-      } else if (engine == 2) {
-        simVars->setEngine2TotalOil(idleOil);
-      } else if (engine == 3) {
-        simVars->setEngine3TotalOil(idleOil);
-      } else {
-        simVars->setEngine4TotalOil(idleOil);
-      }
+      simVars->setEngineTotalOil(engine, idleOil);
     }
 
-    // Setting initial Oil Temperature
-    thermalEnergy1 = 0;
-    thermalEnergy2 = 0;
-    thermalEnergy3 = 0;
-    thermalEnergy4 = 0;
+    // Setting initial Oil Temperature and Engine State
     oilTemperatureMax = 85;
-    simOnGround = simVars->getSimOnGround();
-    double engine1Combustion = simVars->getEngineCombustion(1);
-    double engine2Combustion = simVars->getEngineCombustion(2);
-    double engine3Combustion = simVars->getEngineCombustion(3);
-    double engine4Combustion = simVars->getEngineCombustion(4);
-
-    if (simOnGround == 1 && engine1Combustion == 1 && engine2Combustion == 1 && engine3Combustion == 1 && engine4Combustion == 1) {
-      oilTemperatureEngine1Pre = 75;
-      oilTemperatureEngine2Pre = 75;
-      oilTemperatureEngine3Pre = 75;
-      oilTemperatureEngine4Pre = 75;
-    } else if (simOnGround == 0 && engine1Combustion == 1 && engine2Combustion == 1 && engine3Combustion == 1 && engine4Combustion == 1) {
-      oilTemperatureEngine1Pre = 85;
-      oilTemperatureEngine2Pre = 85;
-      oilTemperatureEngine3Pre = 85;
-      oilTemperatureEngine4Pre = 85;
-    } else {
-      oilTemperatureEngine1Pre = ambientTemp;
-      oilTemperatureEngine2Pre = ambientTemp;
-      oilTemperatureEngine3Pre = ambientTemp;
-      oilTemperatureEngine4Pre = ambientTemp;
-    }
-
-    SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine1, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                  &oilTemperatureEngine1Pre);
-    SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine2, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                  &oilTemperatureEngine2Pre);
-    SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine3, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                  &oilTemperatureEngine3Pre);
-    SimConnect_SetDataOnSimObject(hSimConnect, DataTypesID::OilTempEngine4, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
-                                  &oilTemperatureEngine4Pre);
-
-    // Initialize Engine State
-    simVars->setEngine1State(10);
-    simVars->setEngine2State(10);
-    simVars->setEngine3State(10);
-    simVars->setEngine4State(10);
-
-    // Resetting Engine Timers
-    simVars->setEngine1Timer(0);
-    simVars->setEngine2Timer(0);
-    simVars->setEngine3Timer(0);
-    simVars->setEngine4Timer(0);
+    initializeEngines();
 
     // Initialize Fuel Tanks
     simVars->setFuelLeftPre(configuration.fuelLeft * simVars->getFuelWeightGallon());          // in LBS
@@ -1374,6 +667,9 @@ class EngineControl {
     simVars->setThrustLimitFlex(0);
     simVars->setThrustLimitClimb(0);
     simVars->setThrustLimitMct(0);
+
+    // Publish the initial values
+    simVars->writeAll();
   }
 
   /// <summary>
@@ -1384,6 +680,10 @@ class EngineControl {
     double prevAnimationDeltaTime;
     double simN1highest = 0;
 
+    // Read the LVars and SimVars of this cycle once
+    simVars->readAll();
+    readSimObjectData();
+
     // animationDeltaTimes being used to detect a Paused situation
     prevAnimationDeltaTime = animationDeltaTime;
     animationDeltaTime = simVars->getAnimDeltaTime();
@@ -1407,58 +707,12 @@ class EngineControl {
     wai = simVars->getWAI();
 
     // Timer timer;
-    for (engine = 1; engine <= 4; engine++) {
-      engineStarter = simVars->getEngineStarter(engine);
-      engineIgniter = simVars->getEngineIgniter(engine);
-      simCN1 = simVars->getCN1(engine);
-      simN1 = simVars->getN1(engine);
-      simN2 = simVars->getN2(engine);
-      thrust = simVars->getThrust(engine);
-
-      // Set & Check Engine Status for this Cycle
-      engineStateMachine(engine, engineIgniter, engineStarter, simN2, idleN2, pressAltitude, ambientTemp,
-                         animationDeltaTime - prevAnimationDeltaTime);
-      if (engine == 1) {
-        engineState = simVars->getEngine1State();
-        deltaN2 = simN2 - simN2Engine1Pre;
-        simN2Engine1Pre = simN2;
-        timer = simVars->getEngine1Timer();
-      } else if (engine == 2) {
-        engineState = simVars->getEngine2State();
-        deltaN2 = simN2 - simN2Engine2Pre;
-        simN2Engine2Pre = simN2;
-        timer = simVars->getEngine2Timer();
-      } else if (engine == 3) {
-        engineState = simVars->getEngine3State();
-        deltaN2 = simN2 - simN2Engine3Pre;
-        simN2Engine3Pre = simN2;
-        timer = simVars->getEngine3Timer();
-      } else {
-        engineState = simVars->getEngine4State();
-        deltaN2 = simN2 - simN2Engine4Pre;
-        simN2Engine4Pre = simN2;
-        timer = simVars->getEngine4Timer();
-      }
-
-
-      switch (int(engineState)) {
-        case 2:
-        case 3:
-          engineStartProcedure(engine, engineState, deltaTime, timer, simN2, pressAltitude, ambientTemp);
-          break;
-        case 4:
-          engineShutdownProcedure(engine, ambientTemp, simN1, deltaTime, timer);
-          cFbwFF = updateFF(engine, simCN1, mach, pressAltitude, ambientTemp, ambientPressure);
-          break;
-        default:
-          updatePrimaryParameters(engine, simN1, simN2);
-          cFbwFF = updateFF(engine, simCN1, mach, pressAltitude, ambientTemp, ambientPressure);
-          updateEGT(engine, deltaTime, simOnGround, engineState, simCN1, cFbwFF, mach, pressAltitude, ambientTemp);
-          // updateOil(engine, imbalance, thrust, simN2, deltaN2, deltaTime, ambientTemp);
-      }
+    // the engines of the A380 have no imbalance
+    updateEngines({}, deltaTime, animationDeltaTime - prevAnimationDeltaTime);
 
-      // set highest N1 from either engine
-      simN1highest = max(simN1highest, simN1);
+    // set highest N1 from all engines
+    for (int lane = 0; lane < SimVars::ENGINE_COUNT; lane++) {
+      simN1highest = max(simN1highest, engines.simN1[lane]);
     }
 
     // If Development State is 1, UI Payload will be enabled
@@ -1469,10 +723,17 @@ class EngineControl {
     updateFuel(deltaTime);
 
     updateThrustLimits(simulationTime, pressAltitude, ambientTemp, ambientPressure, mach, simN1highest, packs, nai, wai);
+
+    // Publish the changed LVars and SimConnect data of this cycle
+    simVars->writeAll();
+    writeSimObjectData();
     // timer.elapsed();
   }
 
-  void terminate() {}
+  /// <summary>
+  /// Writes the fuel configuration that is still pending
+  /// </summary>
+  void terminate() { writeConfiguration(true); }
 
   Configuration getConfigurationFromFile() {
     Configuration configuration;
@@ -1501,6 +762,39 @@ class EngineControl {
     };
   }
 
+  /// <summary>
+  /// Keeps the fuel configuration in memory if it changed, writeConfiguration() writes it to the file
+  /// </summary>
+  void storeFuelInConfiguration(const Configuration& configuration) {
+    if (configuration == (isConfigurationPending ? pendingConfiguration : savedConfiguration)) {
+      return;
+    }
+
+    if (!isConfigurationPending) {
+      timerConfigurationPending.reset();
+    }
+    pendingConfiguration = configuration;
+    isConfigurationPending = true;
+    timerConfigurationChanged.reset();
+  }
+
+  /// <summary>
+  /// Writes the pending fuel configuration once it settled or was pending for too long, or right away if forced
+  /// </summary>
+  void writeConfiguration(bool force) {
+    if (!isConfigurationPending) {
+      return;
+    }
+    if (!force && timerConfigurationChanged.elapsed() < CONFIGURATION_SETTLE_TIME &&
+        timerConfigurationPending.elapsed() < CONFIGURATION_MAX_DELAY) {
+      return;
+    }
+
+    saveFuelInConfiguration(pendingConfiguration);
+    savedConfiguration = pendingConfiguration;
+    isConfigurationPending = false;
+  }
+
   void saveFuelInConfiguration(Configuration configuration) {
     mINI::INIStructure stInitStructure;
     mINI::INIFile iniFile(confFilename);
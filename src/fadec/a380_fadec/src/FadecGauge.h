@@ -48,30 +48,38 @@ class FadecGauge {
     if (SUCCEEDED(SimConnect_Open(&hSimConnect, "FadecGauge", nullptr, 0, 0, 0))) {
       std::cout << "FADEC: SimConnect connected." << std::endl;
 
-      // SimConnect Payload Definitions
-      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::PayloadStation1, "PAYLOAD STATION WEIGHT:1", "Pounds");
-      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::PayloadStation2, "PAYLOAD STATION WEIGHT:2", "Pounds");
-      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::PayloadStation3, "PAYLOAD STATION WEIGHT:3", "Pounds");
-      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::PayloadStation4, "PAYLOAD STATION WEIGHT:4", "Pounds");
-      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::PayloadStation5, "PAYLOAD STATION WEIGHT:5", "Pounds");
-      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::PayloadStation6, "PAYLOAD STATION WEIGHT:6", "Pounds");
-      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::PayloadStation7, "PAYLOAD STATION WEIGHT:7", "Pounds");
-      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::PayloadStation8, "PAYLOAD STATION WEIGHT:8", "Pounds");
-
-      // SimConnect Tanker Definitions
-      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::FuelLeftMain, "FUEL TANK LEFT MAIN QUANTITY", "Gallons");
-      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::FuelRightMain, "FUEL TANK RIGHT MAIN QUANTITY", "Gallons");
-      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::FuelCenterMain, "FUEL TANK CENTER QUANTITY", "Gallons");
-      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::FuelLeftAux, "FUEL TANK LEFT AUX QUANTITY", "Gallons");
-      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::FuelRightAux, "FUEL TANK RIGHT AUX QUANTITY", "Gallons");
-
-      // SimConnect Oil Temperature Definitions
+      // SimConnect Payload Definitions, one data definition for all stations
+      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::PayloadStations, "PAYLOAD STATION WEIGHT:1", "Pounds");
+      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::PayloadStations, "PAYLOAD STATION WEIGHT:2", "Pounds");
+      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::PayloadStations, "PAYLOAD STATION WEIGHT:3", "Pounds");
+      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::PayloadStations, "PAYLOAD STATION WEIGHT:4", "Pounds");
+      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::PayloadStations, "PAYLOAD STATION WEIGHT:5", "Pounds");
+      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::PayloadStations, "PAYLOAD STATION WEIGHT:6", "Pounds");
+      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::PayloadStations, "PAYLOAD STATION WEIGHT:7", "Pounds");
+      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::PayloadStations, "PAYLOAD STATION WEIGHT:8", "Pounds");
+
+      // SimConnect Tanker Definitions, the main tanks (left, right, center) and the aux tanks (left, right)
+      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::FuelMainTanks, "FUEL TANK LEFT MAIN QUANTITY", "Gallons");
+      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::FuelMainTanks, "FUEL TANK RIGHT MAIN QUANTITY", "Gallons");
+      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::FuelMainTanks, "FUEL TANK CENTER QUANTITY", "Gallons");
+      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::FuelAuxTanks, "FUEL TANK LEFT AUX QUANTITY", "Gallons");
+      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::FuelAuxTanks, "FUEL TANK RIGHT AUX QUANTITY", "Gallons");
+
+      // SimConnect Oil Temperature Definitions, one for all engines and one per engine
+      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::OilTemperatures, "GENERAL ENG OIL TEMPERATURE:1", "Celsius");
+      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::OilTemperatures, "GENERAL ENG OIL TEMPERATURE:2", "Celsius");
+      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::OilTemperatures, "GENERAL ENG OIL TEMPERATURE:3", "Celsius");
+      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::OilTemperatures, "GENERAL ENG OIL TEMPERATURE:4", "Celsius");
       SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::OilTempEngine1, "GENERAL ENG OIL TEMPERATURE:1", "Celsius");
       SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::OilTempEngine2, "GENERAL ENG OIL TEMPERATURE:2", "Celsius");
       SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::OilTempEngine3, "GENERAL ENG OIL TEMPERATURE:3", "Celsius");
       SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::OilTempEngine4, "GENERAL ENG OIL TEMPERATURE:4", "Celsius");
 
-      // SimConnect Oil Pressure Definitions
+      // SimConnect Oil Pressure Definitions, one for all engines and one per engine
+      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::OilPressures, "GENERAL ENG OIL PRESSURE:1", "Psi");
+      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::OilPressures, "GENERAL ENG OIL PRESSURE:2", "Psi");
+      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::OilPressures, "GENERAL ENG OIL PRESSURE:3", "Psi");
+      SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::OilPressures, "GENERAL ENG OIL PRESSURE:4", "Psi");
       SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::OilPsiEngine1, "GENERAL ENG OIL PRESSURE:1", "Psi");
       SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::OilPsiEngine2, "GENERAL ENG OIL PRESSURE:2", "Psi");
       SimConnect_AddToDataDefinition(hSimConnect, DataTypesID::OilPsiEngine3, "GENERAL ENG OIL PRESSURE:3", "Psi");
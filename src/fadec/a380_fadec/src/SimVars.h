@@ -1,22 +1,16 @@
 #pragma once
 
+#include "VariableSnapshot.h"
+
 /// <summary>
 /// SimConnect data types to send to Sim Updated
 /// </summary>
 enum DataTypesID {
-  PayloadStation1,
-  PayloadStation2,
-  PayloadStation3,
-  PayloadStation4,
-  PayloadStation5,
-  PayloadStation6,
-  PayloadStation7,
-  PayloadStation8,
-  FuelLeftMain,
-  FuelRightMain,
-  FuelCenterMain,
-  FuelLeftAux,
-  FuelRightAux,
+  PayloadStations,
+  FuelMainTanks,
+  FuelAuxTanks,
+  OilTemperatures,
+  OilPressures,
   OilTempEngine1,
   OilTempEngine2,
   OilTempEngine3,
@@ -72,6 +66,9 @@ class SimVars {
  public:
   Units* m_Units;
 
+  // Number of engines, the engine SimVars and LVars are indexed from 1 to ENGINE_COUNT
+  static constexpr int ENGINE_COUNT = 4;
+
   /// <summary>
   /// Collection of SimVars for the A32NX
   /// </summary>
@@ -117,240 +114,211 @@ class SimVars {
   ENUM NacelleAntiIce = get_aircraft_var_enum("ENG ANTI ICE");
   ENUM WingAntiIce = get_aircraft_var_enum("STRUCTURAL DEICE SWITCH");
 
+  /// <summary>
+  /// Snapshot of the SimVars read every frame
+  /// </summary>
+  SimVarSnapshot simVarSnapshot;
+  SimVarSnapshot::Handle CorrectedN1Handle;
+  SimVarSnapshot::Handle N1Handle;
+  SimVarSnapshot::Handle N2Handle;
+  SimVarSnapshot::Handle ThrustHandle;
+  SimVarSnapshot::Handle AirSpeedMachHandle;
+  SimVarSnapshot::Handle PressureAltitudeHandle;
+  SimVarSnapshot::Handle AmbientTempHandle;
+  SimVarSnapshot::Handle AmbientPressureHandle;
+  SimVarSnapshot::Handle SimOnGroundHandle;
+  SimVarSnapshot::Handle TankLeftAuxQuantityHandle;
+  SimVarSnapshot::Handle TankRightAuxQuantityHandle;
+  SimVarSnapshot::Handle TankLeftQuantityHandle;
+  SimVarSnapshot::Handle TankRightQuantityHandle;
+  SimVarSnapshot::Handle TankCenterQuantityHandle;
+  SimVarSnapshot::Handle FuelTotalQuantityHandle;
+  SimVarSnapshot::Handle EmptyWeightHandle;
+  SimVarSnapshot::Handle TotalWeightHandle;
+  SimVarSnapshot::Handle FuelWeightGallonHandle;
+  SimVarSnapshot::Handle EngineStarterHandle;
+  SimVarSnapshot::Handle EngineIgniterHandle;
+  SimVarSnapshot::Handle AnimDeltaTimeHandle;
+  SimVarSnapshot::Handle NacelleAntiIceHandle;
+  SimVarSnapshot::Handle OilTempHandle;
+  SimVarSnapshot::Handle OilPsiHandle;
+  SimVarSnapshot::Handle WingAntiIceHandle;
+
   /// <summary>
   /// Collection of LVars for the A32NX
   /// </summary>
-  ID DevVar;
-  ID FlexTemp;
-  ID Engine1N2;
-  ID Engine2N2;
-  ID Engine3N2;
-  ID Engine4N2;
-  ID Engine1N1;
-  ID Engine2N1;
-  ID Engine3N1;
-  ID Engine4N1;
-  ID EngineIdleN1;
-  ID EngineIdleN2;
+  LVarSnapshot lvarSnapshot;
+  LVarSnapshot::Handle DevVar;
+  LVarSnapshot::Handle FlexTemp;
+  LVarSnapshot::Handle EngineN2;
+  LVarSnapshot::Handle EngineN1;
+  LVarSnapshot::Handle EngineIdleN1;
+  LVarSnapshot::Handle EngineIdleN2;
   ID EngineIdleN3;
   ID EngineIdleN4;
-  ID EngineIdleFF;
-  ID EngineIdleEGT;
-  ID Engine1EGT;
-  ID Engine2EGT;
-  ID Engine3EGT;
-  ID Engine4EGT;
-  ID Engine1Oil;
-  ID Engine2Oil;
-  ID Engine3Oil;
-  ID Engine4Oil;
-  ID Engine1TotalOil;
-  ID Engine2TotalOil;
-  ID Engine3TotalOil;
-  ID Engine4TotalOil;
-  ID Engine1FF;
-  ID Engine2FF;
-  ID Engine3FF;
-  ID Engine4FF;
-  ID Engine1PreFF;
-  ID Engine2PreFF;
-  ID Engine3PreFF;
-  ID Engine4PreFF;
+  LVarSnapshot::Handle EngineIdleFF;
+  LVarSnapshot::Handle EngineIdleEGT;
+  LVarSnapshot::Handle EngineEGT;
+  LVarSnapshot::Handle EngineOil;
+  LVarSnapshot::Handle EngineTotalOil;
+  LVarSnapshot::Handle EngineFF;
+  LVarSnapshot::Handle EnginePreFF;
   ID EngineCycleTime;
-  ID EngineImbalance;
-  ID FuelUsedEngine1;
-  ID FuelUsedEngine2;
-  ID FuelUsedEngine3;
-  ID FuelUsedEngine4;
-  ID FuelLeftPre;
-  ID FuelRightPre;
-  ID FuelAuxLeftPre;
-  ID FuelAuxRightPre;
-  ID FuelCenterPre;
-  ID RefuelRate;
-  ID RefuelStartedByUser;
+  LVarSnapshot::Handle EngineImbalance;
+  LVarSnapshot::Handle FuelUsed;
+  LVarSnapshot::Handle FuelLeftPre;
+  LVarSnapshot::Handle FuelRightPre;
+  LVarSnapshot::Handle FuelAuxLeftPre;
+  LVarSnapshot::Handle FuelAuxRightPre;
+  LVarSnapshot::Handle FuelCenterPre;
+  LVarSnapshot::Handle RefuelRate;
+  LVarSnapshot::Handle RefuelStartedByUser;
   ID FuelOverflowLeft;
   ID FuelOverflowRight;
-  ID Engine1State;
-  ID Engine2State;
-  ID Engine3State;
-  ID Engine4State;
-  ID Engine1Timer;
-  ID Engine2Timer;
-  ID Engine3Timer;
-  ID Engine4Timer;
-  ID PumpStateEngine1;
-  ID PumpStateEngine2;
-  ID PumpStateEngine3;
-  ID PumpStateEngine4;
-  ID ConversionFactor;
-  ID PerPaxWeight;
-  ID PaxRows1to6Actual;
-  ID PaxRows7to13Actual;
-  ID PaxRows14to21Actual;
-  ID PaxRows22to29Actual;
-  ID PaxRows1to6Desired;
-  ID PaxRows7to13Desired;
-  ID PaxRows14to21Desired;
-  ID PaxRows22to29Desired;
-  ID CargoFwdContainerActual;
-  ID CargoAftContainerActual;
-  ID CargoAftBaggageActual;
-  ID CargoAftBulkActual;
-  ID CargoFwdContainerDesired;
-  ID CargoAftContainerDesired;
-  ID CargoAftBaggageDesired;
-  ID CargoAftBulkDesired;
-  ID ThrustLimitType;
-  ID ThrustLimitIdle;
-  ID ThrustLimitToga;
-  ID ThrustLimitFlex;
-  ID ThrustLimitClimb;
-  ID ThrustLimitMct;
-  ID PacksState1;
-  ID PacksState2;
+  LVarSnapshot::Handle EngineState;
+  LVarSnapshot::Handle EngineTimer;
+  LVarSnapshot::Handle PumpStateEngine1;
+  LVarSnapshot::Handle PumpStateEngine2;
+  LVarSnapshot::Handle PumpStateEngine3;
+  LVarSnapshot::Handle PumpStateEngine4;
+  LVarSnapshot::Handle ConversionFactor;
+  LVarSnapshot::Handle PerPaxWeight;
+  LVarSnapshot::Handle PaxRows1to6Actual;
+  LVarSnapshot::Handle PaxRows7to13Actual;
+  LVarSnapshot::Handle PaxRows14to21Actual;
+  LVarSnapshot::Handle PaxRows22to29Actual;
+  LVarSnapshot::Handle PaxRows1to6Desired;
+  LVarSnapshot::Handle PaxRows7to13Desired;
+  LVarSnapshot::Handle PaxRows14to21Desired;
+  LVarSnapshot::Handle PaxRows22to29Desired;
+  LVarSnapshot::Handle CargoFwdContainerActual;
+  LVarSnapshot::Handle CargoAftContainerActual;
+  LVarSnapshot::Handle CargoAftBaggageActual;
+  LVarSnapshot::Handle CargoAftBulkActual;
+  LVarSnapshot::Handle CargoFwdContainerDesired;
+  LVarSnapshot::Handle CargoAftContainerDesired;
+  LVarSnapshot::Handle CargoAftBaggageDesired;
+  LVarSnapshot::Handle CargoAftBulkDesired;
+  LVarSnapshot::Handle ThrustLimitType;
+  LVarSnapshot::Handle ThrustLimitIdle;
+  LVarSnapshot::Handle ThrustLimitToga;
+  LVarSnapshot::Handle ThrustLimitFlex;
+  LVarSnapshot::Handle ThrustLimitClimb;
+  LVarSnapshot::Handle ThrustLimitMct;
+  LVarSnapshot::Handle PacksState1;
+  LVarSnapshot::Handle PacksState2;
 
   SimVars() { this->initializeVars(); }
 
   void initializeVars() {
-    DevVar = register_named_variable("A32NX_DEVELOPER_STATE");
-    FlexTemp = register_named_variable("A32NX_TO_FLEX_TEMP");
-    Engine1N2 = register_named_variable("A32NX_ENGINE_N2:1");
-    Engine2N2 = register_named_variable("A32NX_ENGINE_N2:2");
-    Engine3N2 = register_named_variable("A32NX_ENGINE_N2:3");
-    Engine4N2 = register_named_variable("A32NX_ENGINE_N2:4");
-    Engine1N1 = register_named_variable("A32NX_ENGINE_N1:1");
-    Engine2N1 = register_named_variable("A32NX_ENGINE_N1:2");
-    Engine3N1 = register_named_variable("A32NX_ENGINE_N1:3");
-    Engine4N1 = register_named_variable("A32NX_ENGINE_N1:4");
-    EngineIdleN1 = register_named_variable("A32NX_ENGINE_IDLE_N1");
-    EngineIdleN2 = register_named_variable("A32NX_ENGINE_IDLE_N2");
-    EngineIdleFF = register_named_variable("A32NX_ENGINE_IDLE_FF");
-    EngineIdleEGT = register_named_variable("A32NX_ENGINE_IDLE_EGT");
-    Engine1EGT = register_named_variable("A32NX_ENGINE_EGT:1");
-    Engine2EGT = register_named_variable("A32NX_ENGINE_EGT:2");
-    Engine3EGT = register_named_variable("A32NX_ENGINE_EGT:3");
-    Engine4EGT = register_named_variable("A32NX_ENGINE_EGT:4");
-    Engine1Oil = register_named_variable("A32NX_ENGINE_TANK_OIL:1");
-    Engine2Oil = register_named_variable("A32NX_ENGINE_TANK_OIL:2");
-    Engine3Oil = register_named_variable("A32NX_ENGINE_TANK_OIL:3");
-    Engine4Oil = register_named_variable("A32NX_ENGINE_TANK_OIL:4");
-    Engine1TotalOil = register_named_variable("A32NX_ENGINE_TOTAL_OIL:1");
-    Engine2TotalOil = register_named_variable("A32NX_ENGINE_TOTAL_OIL:2");
-    Engine3TotalOil = register_named_variable("A32NX_ENGINE_TOTAL_OIL:3");
-    Engine4TotalOil = register_named_variable("A32NX_ENGINE_TOTAL_OIL:4");
-    Engine1FF = register_named_variable("A32NX_ENGINE_FF:1");
-    Engine2FF = register_named_variable("A32NX_ENGINE_FF:2");
-    Engine3FF = register_named_variable("A32NX_ENGINE_FF:3");
-    Engine4FF = register_named_variable("A32NX_ENGINE_FF:4");
-    Engine1PreFF = register_named_variable("A32NX_ENGINE_PRE_FF:1");
-    Engine2PreFF = register_named_variable("A32NX_ENGINE_PRE_FF:2");
-    Engine3PreFF = register_named_variable("A32NX_ENGINE_PRE_FF:3");
-    Engine4PreFF = register_named_variable("A32NX_ENGINE_PRE_FF:4");
-    EngineImbalance = register_named_variable("A32NX_ENGINE_IMBALANCE");
-    FuelUsedEngine1 = register_named_variable("A32NX_FUEL_USED:1");
-    FuelUsedEngine2 = register_named_variable("A32NX_FUEL_USED:2");
-    FuelUsedEngine3 = register_named_variable("A32NX_FUEL_USED:3");
-    FuelUsedEngine4 = register_named_variable("A32NX_FUEL_USED:4");
-    FuelLeftPre = register_named_variable("A32NX_FUEL_LEFT_PRE");
-    FuelRightPre = register_named_variable("A32NX_FUEL_RIGHT_PRE");
-    FuelAuxLeftPre = register_named_variable("A32NX_FUEL_AUX_LEFT_PRE");
-    FuelAuxRightPre = register_named_variable("A32NX_FUEL_AUX_RIGHT_PRE");
-    FuelCenterPre = register_named_variable("A32NX_FUEL_CENTER_PRE");
-    RefuelRate = register_named_variable("A32NX_EFB_REFUEL_RATE_SETTING");
-    RefuelStartedByUser = register_named_variable("A32NX_REFUEL_STARTED_BY_USR");
-    Engine1State = register_named_variable("A32NX_ENGINE_STATE:1");
-    Engine2State = register_named_variable("A32NX_ENGINE_STATE:2");
-    Engine3State = register_named_variable("A32NX_ENGINE_STATE:3");
-    Engine4State = register_named_variable("A32NX_ENGINE_STATE:4");
-    Engine1Timer = register_named_variable("A32NX_ENGINE_TIMER:1");
-    Engine2Timer = register_named_variable("A32NX_ENGINE_TIMER:2");
-    Engine3Timer = register_named_variable("A32NX_ENGINE_TIMER:3");
-    Engine4Timer = register_named_variable("A32NX_ENGINE_TIMER:4");
-    PumpStateEngine1 = register_named_variable("A32NX_PUMP_STATE:1");
-    PumpStateEngine2 = register_named_variable("A32NX_PUMP_STATE:2");
-    PumpStateEngine3 = register_named_variable("A32NX_PUMP_STATE:3");
-    PumpStateEngine4 = register_named_variable("A32NX_PUMP_STATE:4");
-    ConversionFactor = register_named_variable("A32NX_EFB_UNIT_CONVERSION_FACTOR");
-    PerPaxWeight = register_named_variable("A32NX_WB_PER_PAX_WEIGHT");
-    PaxRows1to6Actual = register_named_variable("A32NX_PAX_TOTAL_ROWS_1_6");
-    PaxRows7to13Actual = register_named_variable("A32NX_PAX_TOTAL_ROWS_7_13");
-    PaxRows14to21Actual = register_named_variable("A32NX_PAX_TOTAL_ROWS_14_21");
-    PaxRows22to29Actual = register_named_variable("A32NX_PAX_TOTAL_ROWS_22_29");
-    PaxRows1to6Desired = register_named_variable("A32NX_PAX_TOTAL_ROWS_1_6_DESIRED");
-    PaxRows7to13Desired = register_named_variable("A32NX_PAX_TOTAL_ROWS_7_13_DESIRED");
-    PaxRows14to21Desired = register_named_variable("A32NX_PAX_TOTAL_ROWS_14_21_DESIRED");
-    PaxRows22to29Desired = register_named_variable("A32NX_PAX_TOTAL_ROWS_22_29_DESIRED");
-    CargoFwdContainerActual = register_named_variable("A32NX_CARGO_FWD_BAGGAGE_CONTAINER");
-    CargoAftContainerActual = register_named_variable("A32NX_CARGO_AFT_CONTAINER");
-    CargoAftBaggageActual = register_named_variable("A32NX_CARGO_AFT_BAGGAGE");
-    CargoAftBulkActual = register_named_variable("A32NX_CARGO_AFT_BULK_LOOSE");
-    CargoFwdContainerDesired = register_named_variable("A32NX_CARGO_FWD_BAGGAGE_CONTAINER_DESIRED");
-    CargoAftContainerDesired = register_named_variable("A32NX_CARGO_AFT_CONTAINER_DESIRED");
-    CargoAftBaggageDesired = register_named_variable("A32NX_CARGO_AFT_BAGGAGE_DESIRED");
-    CargoAftBulkDesired = register_named_variable("A32NX_CARGO_AFT_BULK_LOOSE_DESIRED");
+    DevVar = lvarSnapshot.add("A32NX_DEVELOPER_STATE");
+    FlexTemp = lvarSnapshot.add("A32NX_TO_FLEX_TEMP");
+    EngineN2 = lvarSnapshot.addIndexed("A32NX_ENGINE_N2", ENGINE_COUNT);
+    EngineN1 = lvarSnapshot.addIndexed("A32NX_ENGINE_N1", ENGINE_COUNT);
+    EngineIdleN1 = lvarSnapshot.add("A32NX_ENGINE_IDLE_N1");
+    EngineIdleN2 = lvarSnapshot.add("A32NX_ENGINE_IDLE_N2");
+    EngineIdleFF = lvarSnapshot.add("A32NX_ENGINE_IDLE_FF");
+    EngineIdleEGT = lvarSnapshot.add("A32NX_ENGINE_IDLE_EGT");
+    EngineEGT = lvarSnapshot.addIndexed("A32NX_ENGINE_EGT", ENGINE_COUNT);
+    EngineOil = lvarSnapshot.addIndexed("A32NX_ENGINE_TANK_OIL", ENGINE_COUNT);
+    EngineTotalOil = lvarSnapshot.addIndexed("A32NX_ENGINE_TOTAL_OIL", ENGINE_COUNT);
+    EngineFF = lvarSnapshot.addIndexed("A32NX_ENGINE_FF", ENGINE_COUNT);
+    EnginePreFF = lvarSnapshot.addIndexed("A32NX_ENGINE_PRE_FF", ENGINE_COUNT);
+    EngineImbalance = lvarSnapshot.add("A32NX_ENGINE_IMBALANCE");
+    FuelUsed = lvarSnapshot.addIndexed("A32NX_FUEL_USED", ENGINE_COUNT);
+    FuelLeftPre = lvarSnapshot.add("A32NX_FUEL_LEFT_PRE");
+    FuelRightPre = lvarSnapshot.add("A32NX_FUEL_RIGHT_PRE");
+    FuelAuxLeftPre = lvarSnapshot.add("A32NX_FUEL_AUX_LEFT_PRE");
+    FuelAuxRightPre = lvarSnapshot.add("A32NX_FUEL_AUX_RIGHT_PRE");
+    FuelCenterPre = lvarSnapshot.add("A32NX_FUEL_CENTER_PRE");
+    RefuelRate = lvarSnapshot.add("A32NX_EFB_REFUEL_RATE_SETTING");
+    RefuelStartedByUser = lvarSnapshot.add("A32NX_REFUEL_STARTED_BY_USR");
+    EngineState = lvarSnapshot.addIndexed("A32NX_ENGINE_STATE", ENGINE_COUNT);
+    EngineTimer = lvarSnapshot.addIndexed("A32NX_ENGINE_TIMER", ENGINE_COUNT);
+    PumpStateEngine1 = lvarSnapshot.add("A32NX_PUMP_STATE:1");
+    PumpStateEngine2 = lvarSnapshot.add("A32NX_PUMP_STATE:2");
+    PumpStateEngine3 = lvarSnapshot.add("A32NX_PUMP_STATE:3");
+    PumpStateEngine4 = lvarSnapshot.add("A32NX_PUMP_STATE:4");
+    ConversionFactor = lvarSnapshot.add("A32NX_EFB_UNIT_CONVERSION_FACTOR");
+    PerPaxWeight = lvarSnapshot.add("A32NX_WB_PER_PAX_WEIGHT");
+    PaxRows1to6Actual = lvarSnapshot.add("A32NX_PAX_TOTAL_ROWS_1_6");
+    PaxRows7to13Actual = lvarSnapshot.add("A32NX_PAX_TOTAL_ROWS_7_13");
+    PaxRows14to21Actual = lvarSnapshot.add("A32NX_PAX_TOTAL_ROWS_14_21");
+    PaxRows22to29Actual = lvarSnapshot.add("A32NX_PAX_TOTAL_ROWS_22_29");
+    PaxRows1to6Desired = lvarSnapshot.add("A32NX_PAX_TOTAL_ROWS_1_6_DESIRED");
+    PaxRows7to13Desired = lvarSnapshot.add("A32NX_PAX_TOTAL_ROWS_7_13_DESIRED");
+    PaxRows14to21Desired = lvarSnapshot.add("A32NX_PAX_TOTAL_ROWS_14_21_DESIRED");
+    PaxRows22to29Desired = lvarSnapshot.add("A32NX_PAX_TOTAL_ROWS_22_29_DESIRED");
+    CargoFwdContainerActual = lvarSnapshot.add("A32NX_CARGO_FWD_BAGGAGE_CONTAINER");
+    CargoAftContainerActual = lvarSnapshot.add("A32NX_CARGO_AFT_CONTAINER");
+    CargoAftBaggageActual = lvarSnapshot.add("A32NX_CARGO_AFT_BAGGAGE");
+    CargoAftBulkActual = lvarSnapshot.add("A32NX_CARGO_AFT_BULK_LOOSE");
+    CargoFwdContainerDesired = lvarSnapshot.add("A32NX_CARGO_FWD_BAGGAGE_CONTAINER_DESIRED");
+    CargoAftContainerDesired = lvarSnapshot.add("A32NX_CARGO_AFT_CONTAINER_DESIRED");
+    CargoAftBaggageDesired = lvarSnapshot.add("A32NX_CARGO_AFT_BAGGAGE_DESIRED");
+    CargoAftBulkDesired = lvarSnapshot.add("A32NX_CARGO_AFT_BULK_LOOSE_DESIRED");
 
-    ThrustLimitType = register_named_variable("A32NX_AUTOTHRUST_THRUST_LIMIT_TYPE");
-    ThrustLimitIdle = register_named_variable("A32NX_AUTOTHRUST_THRUST_LIMIT_IDLE");
-    ThrustLimitToga = register_named_variable("A32NX_AUTOTHRUST_THRUST_LIMIT_TOGA");
-    ThrustLimitFlex = register_named_variable("A32NX_AUTOTHRUST_THRUST_LIMIT_FLX");
-    ThrustLimitClimb = register_named_variable("A32NX_AUTOTHRUST_THRUST_LIMIT_CLB");
-    ThrustLimitMct = register_named_variable("A32NX_AUTOTHRUST_THRUST_LIMIT_MCT");
+    ThrustLimitType = lvarSnapshot.add("A32NX_AUTOTHRUST_THRUST_LIMIT_TYPE");
+    ThrustLimitIdle = lvarSnapshot.add("A32NX_AUTOTHRUST_THRUST_LIMIT_IDLE", false);
+    ThrustLimitToga = lvarSnapshot.add("A32NX_AUTOTHRUST_THRUST_LIMIT_TOGA", false);
+    ThrustLimitFlex = lvarSnapshot.add("A32NX_AUTOTHRUST_THRUST_LIMIT_FLX", false);
+    ThrustLimitClimb = lvarSnapshot.add("A32NX_AUTOTHRUST_THRUST_LIMIT_CLB", false);
+    ThrustLimitMct = lvarSnapshot.add("A32NX_AUTOTHRUST_THRUST_LIMIT_MCT", false);
 
-    PacksState1 = register_named_variable("A32NX_COND_PACK_FLOW_VALVE_1_IS_OPEN");
-    PacksState2 = register_named_variable("A32NX_COND_PACK_FLOW_VALVE_2_IS_OPEN");
+    PacksState1 = lvarSnapshot.add("A32NX_COND_PACK_FLOW_VALVE_1_IS_OPEN");
+    PacksState2 = lvarSnapshot.add("A32NX_COND_PACK_FLOW_VALVE_2_IS_OPEN");
 
     this->setDeveloperState(0);
-    this->setEngine1N2(0);
-    this->setEngine2N2(0);
-    this->setEngine3N2(0);
-    this->setEngine4N2(0);
-    this->setEngine1N1(0);
-    this->setEngine2N1(0);
-    this->setEngine3N1(0);
-    this->setEngine4N1(0);
+    this->setEngineN2(1, 0);
+    this->setEngineN2(2, 0);
+    this->setEngineN2(3, 0);
+    this->setEngineN2(4, 0);
+    this->setEngineN1(1, 0);
+    this->setEngineN1(2, 0);
+    this->setEngineN1(3, 0);
+    this->setEngineN1(4, 0);
     this->setEngineIdleN1(0);
     this->setEngineIdleN2(0);
     this->setEngineIdleFF(0);
     this->setEngineIdleEGT(0);
-    this->setEngine1EGT(0);
-    this->setEngine2EGT(0);
-    this->setEngine3EGT(0);
-    this->setEngine4EGT(0);
-    this->setEngine1Oil(0);
-    this->setEngine2Oil(0);
-    this->setEngine3Oil(0);
-    this->setEngine4Oil(0);
-    this->setEngine1TotalOil(0);
-    this->setEngine2TotalOil(0);
-    this->setEngine3TotalOil(0);
-    this->setEngine4TotalOil(0);
-    this->setEngine1FF(0);
-    this->setEngine2FF(0);
-    this->setEngine3FF(0);
-    this->setEngine4FF(0);
-    this->setEngine1PreFF(0);
-    this->setEngine2PreFF(0);
-    this->setEngine3PreFF(0);
-    this->setEngine4PreFF(0);
+    this->setEngineEGT(1, 0);
+    this->setEngineEGT(2, 0);
+    this->setEngineEGT(3, 0);
+    this->setEngineEGT(4, 0);
+    this->setEngineOil(1, 0);
+    this->setEngineOil(2, 0);
+    this->setEngineOil(3, 0);
+    this->setEngineOil(4, 0);
+    this->setEngineTotalOil(1, 0);
+    this->setEngineTotalOil(2, 0);
+    this->setEngineTotalOil(3, 0);
+    this->setEngineTotalOil(4, 0);
+    this->setEngineFF(1, 0);
+    this->setEngineFF(2, 0);
+    this->setEngineFF(3, 0);
+    this->setEngineFF(4, 0);
+    this->setEnginePreFF(1, 0);
+    this->setEnginePreFF(2, 0);
+    this->setEnginePreFF(3, 0);
+    this->setEnginePreFF(4, 0);
     this->setEngineImbalance(0);
-    this->setFuelUsedEngine1(0);
-    this->setFuelUsedEngine2(0);
-    this->setFuelUsedEngine3(0);
-    this->setFuelUsedEngine4(0);
+    this->setFuelUsed(1, 0);
+    this->setFuelUsed(2, 0);
+    this->setFuelUsed(3, 0);
+    this->setFuelUsed(4, 0);
     this->setFuelLeftPre(0);
     this->setFuelRightPre(0);
     this->setFuelAuxLeftPre(0);
     this->setFuelAuxRightPre(0);
     this->setFuelCenterPre(0);
-    this->setEngine1State(0);
-    this->setEngine2State(0);
-    this->setEngine3State(0);
-    this->setEngine4State(0);
-    this->setEngine1Timer(0);
-    this->setEngine2Timer(0);
-    this->setEngine3Timer(0);
-    this->setEngine4Timer(0);
+    this->setEngineState(1, 0);
+    this->setEngineState(2, 0);
+    this->setEngineState(3, 0);
+    this->setEngineState(4, 0);
+    this->setEngineTimer(1, 0);
+    this->setEngineTimer(2, 0);
+    this->setEngineTimer(3, 0);
+    this->setEngineTimer(4, 0);
     this->setPumpStateEngine1(0);
     this->setPumpStateEngine2(0);
     this->setPumpStateEngine3(0);
@@ -362,187 +330,166 @@ class SimVars {
     this->setThrustLimitMct(0);
 
     m_Units = new Units();
+
+    CorrectedN1Handle = simVarSnapshot.add(CorrectedN1, m_Units->Percent, 4);
+    N1Handle = simVarSnapshot.add(N1, m_Units->Percent, 4);
+    N2Handle = simVarSnapshot.add(N2, m_Units->Percent, 4);
+    ThrustHandle = simVarSnapshot.add(Thrust, m_Units->Pounds, 4);
+    AirSpeedMachHandle = simVarSnapshot.add(AirSpeedMach, m_Units->Mach);
+    PressureAltitudeHandle = simVarSnapshot.add(PressureAltitude, m_Units->Feet);
+    AmbientTempHandle = simVarSnapshot.add(AmbientTemp, m_Units->Celsius);
+    AmbientPressureHandle = simVarSnapshot.add(AmbientPressure, m_Units->Millibars);
+    SimOnGroundHandle = simVarSnapshot.add(SimOnGround, m_Units->Bool);
+    TankLeftAuxQuantityHandle = simVarSnapshot.add(TankLeftAuxQuantity, m_Units->Gallons);
+    TankRightAuxQuantityHandle = simVarSnapshot.add(TankRightAuxQuantity, m_Units->Gallons);
+    TankLeftQuantityHandle = simVarSnapshot.add(TankLeftQuantity, m_Units->Gallons);
+    TankRightQuantityHandle = simVarSnapshot.add(TankRightQuantity, m_Units->Gallons);
+    TankCenterQuantityHandle = simVarSnapshot.add(TankCenterQuantity, m_Units->Gallons);
+    FuelTotalQuantityHandle = simVarSnapshot.add(FuelTotalQuantity, m_Units->Gallons);
+    EmptyWeightHandle = simVarSnapshot.add(EmptyWeight, m_Units->Pounds);
+    TotalWeightHandle = simVarSnapshot.add(TotalWeight, m_Units->Pounds);
+    FuelWeightGallonHandle = simVarSnapshot.add(FuelWeightGallon, m_Units->Pounds);
+    EngineStarterHandle = simVarSnapshot.add(EngineStarter, m_Units->Bool, 4);
+    EngineIgniterHandle = simVarSnapshot.add(EngineIgniter, m_Units->Number, 4);
+    AnimDeltaTimeHandle = simVarSnapshot.add(animDeltaTime, m_Units->Seconds);
+    NacelleAntiIceHandle = simVarSnapshot.add(NacelleAntiIce, m_Units->Bool, 4);
+    OilTempHandle = simVarSnapshot.add(OilTemp, m_Units->Celsius, ENGINE_COUNT);
+    OilPsiHandle = simVarSnapshot.add(OilPSI, m_Units->Psi, ENGINE_COUNT);
+    WingAntiIceHandle = simVarSnapshot.add(WingAntiIce, m_Units->Bool);
   }
 
+  /// <summary>
+  /// Reads the LVars and SimVars for the frame, the getters then return the snapshot
+  /// </summary>
+  void readAll() {
+    lvarSnapshot.readAll();
+    simVarSnapshot.readAll();
+  }
+
+  /// <summary>
+  /// Publishes the LVars that were changed by the setters
+  /// </summary>
+  void writeAll() { lvarSnapshot.writeAll(); }
+
   // Collection of LVar 'set' Functions
-  void setDeveloperState(FLOAT64 value) { set_named_variable_value(DevVar, value); }
-  void setEngine1N2(FLOAT64 value) { set_named_variable_value(Engine1N2, value); }
-  void setEngine2N2(FLOAT64 value) { set_named_variable_value(Engine2N2, value); }
-  void setEngine3N2(FLOAT64 value) { set_named_variable_value(Engine3N2, value); }
-  void setEngine4N2(FLOAT64 value) { set_named_variable_value(Engine4N2, value); }
-  void setEngine1N1(FLOAT64 value) { set_named_variable_value(Engine1N1, value); }
-  void setEngine2N1(FLOAT64 value) { set_named_variable_value(Engine2N1, value); }
-  void setEngine3N1(FLOAT64 value) { set_named_variable_value(Engine3N1, value); }
-  void setEngine4N1(FLOAT64 value) { set_named_variable_value(Engine4N1, value); }
-  void setEngineIdleN1(FLOAT64 value) { set_named_variable_value(EngineIdleN1, value); }
-  void setEngineIdleN2(FLOAT64 value) { set_named_variable_value(EngineIdleN2, value); }
-  void setEngineIdleFF(FLOAT64 value) { set_named_variable_value(EngineIdleFF, value); }
-  void setEngineIdleEGT(FLOAT64 value) { set_named_variable_value(EngineIdleEGT, value); }
-  void setEngine1EGT(FLOAT64 value) { set_named_variable_value(Engine1EGT, value); }
-  void setEngine2EGT(FLOAT64 value) { set_named_variable_value(Engine2EGT, value); }
-  void setEngine3EGT(FLOAT64 value) { set_named_variable_value(Engine3EGT, value); }
-  void setEngine4EGT(FLOAT64 value) { set_named_variable_value(Engine4EGT, value); }
-  void setEngine1Oil(FLOAT64 value) { set_named_variable_value(Engine1Oil, value); }
-  void setEngine2Oil(FLOAT64 value) { set_named_variable_value(Engine2Oil, value); }
-  void setEngine3Oil(FLOAT64 value) { set_named_variable_value(Engine3Oil, value); }
-  void setEngine4Oil(FLOAT64 value) { set_named_variable_value(Engine4Oil, value); }
-  void setEngine1TotalOil(FLOAT64 value) { set_named_variable_value(Engine1TotalOil, value); }
-  void setEngine2TotalOil(FLOAT64 value) { set_named_variable_value(Engine2TotalOil, value); }
-  void setEngine3TotalOil(FLOAT64 value) { set_named_variable_value(Engine3TotalOil, value); }
-  void setEngine4TotalOil(FLOAT64 value) { set_named_variable_value(Engine4TotalOil, value); }
-  void setEngine1FF(FLOAT64 value) { set_named_variable_value(Engine1FF, value); }
-  void setEngine2FF(FLOAT64 value) { set_named_variable_value(Engine2FF, value); }
-  void setEngine3FF(FLOAT64 value) { set_named_variable_value(Engine3FF, value); }
-  void setEngine4FF(FLOAT64 value) { set_named_variable_value(Engine4FF, value); }
-  void setEngine1PreFF(FLOAT64 value) { set_named_variable_value(Engine1PreFF, value); }
-  void setEngine2PreFF(FLOAT64 value) { set_named_variable_value(Engine2PreFF, value); }
-  void setEngine3PreFF(FLOAT64 value) { set_named_variable_value(Engine3PreFF, value); }
-  void setEngine4PreFF(FLOAT64 value) { set_named_variable_value(Engine4PreFF, value); }
-  void setEngineImbalance(FLOAT64 value) { set_named_variable_value(EngineImbalance, value); }
-  void setFuelUsedEngine1(FLOAT64 value) { set_named_variable_value(FuelUsedEngine1, value); }
-  void setFuelUsedEngine2(FLOAT64 value) { set_named_variable_value(FuelUsedEngine2, value); }
-  void setFuelUsedEngine3(FLOAT64 value) { set_named_variable_value(FuelUsedEngine3, value); }
-  void setFuelUsedEngine4(FLOAT64 value) { set_named_variable_value(FuelUsedEngine4, value); }
-  void setFuelLeftPre(FLOAT64 value) { set_named_variable_value(FuelLeftPre, value); }
-  void setFuelRightPre(FLOAT64 value) { set_named_variable_value(FuelRightPre, value); }
-  void setFuelAuxLeftPre(FLOAT64 value) { set_named_variable_value(FuelAuxLeftPre, value); }
-  void setFuelAuxRightPre(FLOAT64 value) { set_named_variable_value(FuelAuxRightPre, value); }
-  void setFuelCenterPre(FLOAT64 value) { set_named_variable_value(FuelCenterPre, value); }
-  void setEngine1State(FLOAT64 value) { set_named_variable_value(Engine1State, value); }
-  void setEngine2State(FLOAT64 value) { set_named_variable_value(Engine2State, value); }
-  void setEngine3State(FLOAT64 value) { set_named_variable_value(Engine3State, value); }
-  void setEngine4State(FLOAT64 value) { set_named_variable_value(Engine4State, value); }
-  void setEngine1Timer(FLOAT64 value) { set_named_variable_value(Engine1Timer, value); }
-  void setEngine2Timer(FLOAT64 value) { set_named_variable_value(Engine2Timer, value); }
-  void setEngine3Timer(FLOAT64 value) { set_named_variable_value(Engine3Timer, value); }
-  void setEngine4Timer(FLOAT64 value) { set_named_variable_value(Engine4Timer, value); }
-  void setPumpStateEngine1(FLOAT64 value) { set_named_variable_value(PumpStateEngine1, value); }
-  void setPumpStateEngine2(FLOAT64 value) { set_named_variable_value(PumpStateEngine2, value); }
-  void setPumpStateEngine3(FLOAT64 value) { set_named_variable_value(PumpStateEngine3, value); }
-  void setPumpStateEngine4(FLOAT64 value) { set_named_variable_value(PumpStateEngine4, value); }
-  void setThrustLimitIdle(FLOAT64 value) { set_named_variable_value(ThrustLimitIdle, value); }
-  void setThrustLimitToga(FLOAT64 value) { set_named_variable_value(ThrustLimitToga, value); }
-  void setThrustLimitFlex(FLOAT64 value) { set_named_variable_value(ThrustLimitFlex, value); }
-  void setThrustLimitClimb(FLOAT64 value) { set_named_variable_value(ThrustLimitClimb, value); }
-  void setThrustLimitMct(FLOAT64 value) { set_named_variable_value(ThrustLimitMct, value); }
+  void setDeveloperState(FLOAT64 value) { lvarSnapshot.set(DevVar, value); }
+  void setEngineN2(int index, FLOAT64 value) { lvarSnapshot.set(EngineN2 + index - 1, value); }
+  void setEngineN1(int index, FLOAT64 value) { lvarSnapshot.set(EngineN1 + index - 1, value); }
+  void setEngineIdleN1(FLOAT64 value) { lvarSnapshot.set(EngineIdleN1, value); }
+  void setEngineIdleN2(FLOAT64 value) { lvarSnapshot.set(EngineIdleN2, value); }
+  void setEngineIdleFF(FLOAT64 value) { lvarSnapshot.set(EngineIdleFF, value); }
+  void setEngineIdleEGT(FLOAT64 value) { lvarSnapshot.set(EngineIdleEGT, value); }
+  void setEngineEGT(int index, FLOAT64 value) { lvarSnapshot.set(EngineEGT + index - 1, value); }
+  void setEngineOil(int index, FLOAT64 value) { lvarSnapshot.set(EngineOil + index - 1, value); }
+  void setEngineTotalOil(int index, FLOAT64 value) { lvarSnapshot.set(EngineTotalOil + index - 1, value); }
+  void setEngineFF(int index, FLOAT64 value) { lvarSnapshot.set(EngineFF + index - 1, value); }
+  void setEnginePreFF(int index, FLOAT64 value) { lvarSnapshot.set(EnginePreFF + index - 1, value); }
+  void setEngineImbalance(FLOAT64 value) { lvarSnapshot.set(EngineImbalance, value); }
+  void setFuelUsed(int index, FLOAT64 value) { lvarSnapshot.set(FuelUsed + index - 1, value); }
+  void setFuelLeftPre(FLOAT64 value) { lvarSnapshot.set(FuelLeftPre, value); }
+  void setFuelRightPre(FLOAT64 value) { lvarSnapshot.set(FuelRightPre, value); }
+  void setFuelAuxLeftPre(FLOAT64 value) { lvarSnapshot.set(FuelAuxLeftPre, value); }
+  void setFuelAuxRightPre(FLOAT64 value) { lvarSnapshot.set(FuelAuxRightPre, value); }
+  void setFuelCenterPre(FLOAT64 value) { lvarSnapshot.set(FuelCenterPre, value); }
+  void setEngineState(int index, FLOAT64 value) { lvarSnapshot.set(EngineState + index - 1, value); }
+  void setEngineTimer(int index, FLOAT64 value) { lvarSnapshot.set(EngineTimer + index - 1, value); }
+  void setPumpStateEngine1(FLOAT64 value) { lvarSnapshot.set(PumpStateEngine1, value); }
+  void setPumpStateEngine2(FLOAT64 value) { lvarSnapshot.set(PumpStateEngine2, value); }
+  void setPumpStateEngine3(FLOAT64 value) { lvarSnapshot.set(PumpStateEngine3, value); }
+  void setPumpStateEngine4(FLOAT64 value) { lvarSnapshot.set(PumpStateEngine4, value); }
+  void setThrustLimitIdle(FLOAT64 value) { lvarSnapshot.set(ThrustLimitIdle, value); }
+  void setThrustLimitToga(FLOAT64 value) { lvarSnapshot.set(ThrustLimitToga, value); }
+  void setThrustLimitFlex(FLOAT64 value) { lvarSnapshot.set(ThrustLimitFlex, value); }
+  void setThrustLimitClimb(FLOAT64 value) { lvarSnapshot.set(ThrustLimitClimb, value); }
+  void setThrustLimitMct(FLOAT64 value) { lvarSnapshot.set(ThrustLimitMct, value); }
 
   // Collection of SimVar/LVar 'get' Functions
-  FLOAT64 getDeveloperState() { return get_named_variable_value(DevVar); }
-  FLOAT64 getFlexTemp() { return get_named_variable_value(FlexTemp); }
-  FLOAT64 getEngine1N2() { return get_named_variable_value(Engine1N2); }
-  FLOAT64 getEngine2N2() { return get_named_variable_value(Engine2N2); }
-  FLOAT64 getEngine3N2() { return get_named_variable_value(Engine3N2); }
-  FLOAT64 getEngine4N2() { return get_named_variable_value(Engine4N2); }
-  FLOAT64 getEngine1N1() { return get_named_variable_value(Engine1N1); }
-  FLOAT64 getEngine2N1() { return get_named_variable_value(Engine2N1); }
-  FLOAT64 getEngine3N1() { return get_named_variable_value(Engine3N1); }
-  FLOAT64 getEngine4N1() { return get_named_variable_value(Engine4N1); }
-  FLOAT64 getEngineIdleN1() { return get_named_variable_value(EngineIdleN1); }
-  FLOAT64 getEngineIdleN2() { return get_named_variable_value(EngineIdleN2); }
-  FLOAT64 getEngineIdleFF() { return get_named_variable_value(EngineIdleFF); }
-  FLOAT64 getEngineIdleEGT() { return get_named_variable_value(EngineIdleEGT); }
-  FLOAT64 getEngine1FF() { return get_named_variable_value(Engine1FF); }
-  FLOAT64 getEngine2FF() { return get_named_variable_value(Engine2FF); }
-  FLOAT64 getEngine3FF() { return get_named_variable_value(Engine3FF); }
-  FLOAT64 getEngine4FF() { return get_named_variable_value(Engine4FF); }
-  FLOAT64 getEngine1EGT() { return get_named_variable_value(Engine1EGT); }
-  FLOAT64 getEngine2EGT() { return get_named_variable_value(Engine2EGT); }
-  FLOAT64 getEngine3EGT() { return get_named_variable_value(Engine3EGT); }
-  FLOAT64 getEngine4EGT() { return get_named_variable_value(Engine4EGT); }
-  FLOAT64 getEngine1Oil() { return get_named_variable_value(Engine1Oil); }
-  FLOAT64 getEngine2Oil() { return get_named_variable_value(Engine2Oil); }
-  FLOAT64 getEngine3Oil() { return get_named_variable_value(Engine3Oil); }
-  FLOAT64 getEngine4Oil() { return get_named_variable_value(Engine4Oil); }
-  FLOAT64 getEngine1TotalOil() { return get_named_variable_value(Engine1TotalOil); }
-  FLOAT64 getEngine2TotalOil() { return get_named_variable_value(Engine2TotalOil); }
-  FLOAT64 getEngine3TotalOil() { return get_named_variable_value(Engine3TotalOil); }
-  FLOAT64 getEngine4TotalOil() { return get_named_variable_value(Engine4TotalOil); }
-  FLOAT64 getEngine1PreFF() { return get_named_variable_value(Engine1PreFF); }
-  FLOAT64 getEngine2PreFF() { return get_named_variable_value(Engine2PreFF); }
-  FLOAT64 getEngine3PreFF() { return get_named_variable_value(Engine3PreFF); }
-  FLOAT64 getEngine4PreFF() { return get_named_variable_value(Engine4PreFF); }
-  FLOAT64 getEngineImbalance() { return get_named_variable_value(EngineImbalance); }
-  FLOAT64 getFuelUsedEngine1() { return get_named_variable_value(FuelUsedEngine1); }
-  FLOAT64 getFuelUsedEngine2() { return get_named_variable_value(FuelUsedEngine2); }
-  FLOAT64 getFuelUsedEngine3() { return get_named_variable_value(FuelUsedEngine3); }
-  FLOAT64 getFuelUsedEngine4() { return get_named_variable_value(FuelUsedEngine4); }
-  FLOAT64 getFuelLeftPre() { return get_named_variable_value(FuelLeftPre); }
-  FLOAT64 getFuelRightPre() { return get_named_variable_value(FuelRightPre); }
-  FLOAT64 getFuelAuxLeftPre() { return get_named_variable_value(FuelAuxLeftPre); }
-  FLOAT64 getFuelAuxRightPre() { return get_named_variable_value(FuelAuxRightPre); }
-  FLOAT64 getFuelCenterPre() { return get_named_variable_value(FuelCenterPre); }
-  FLOAT64 getRefuelRate() { return get_named_variable_value(RefuelRate); }
-  FLOAT64 getRefuelStartedByUser() { return get_named_variable_value(RefuelStartedByUser); }
-  FLOAT64 getPumpStateEngine1() { return get_named_variable_value(PumpStateEngine1); }
-  FLOAT64 getPumpStateEngine2() { return get_named_variable_value(PumpStateEngine2); }
-  FLOAT64 getPumpStateEngine3() { return get_named_variable_value(PumpStateEngine3); }
-  FLOAT64 getPumpStateEngine4() { return get_named_variable_value(PumpStateEngine4); }
-  FLOAT64 getPerPaxWeight() { return get_named_variable_value(PerPaxWeight); }
-  FLOAT64 getConversionFactor() { return get_named_variable_value(ConversionFactor); }
-  FLOAT64 getPaxRows1to6Actual() { return get_named_variable_value(PaxRows1to6Actual); }
-  FLOAT64 getPaxRows7to13Actual() { return get_named_variable_value(PaxRows7to13Actual); }
-  FLOAT64 getPaxRows14to21Actual() { return get_named_variable_value(PaxRows14to21Actual); }
-  FLOAT64 getPaxRows22to29Actual() { return get_named_variable_value(PaxRows22to29Actual); }
-  FLOAT64 getPaxRows1to6Desired() { return get_named_variable_value(PaxRows1to6Desired); }
-  FLOAT64 getPaxRows7to13Desired() { return get_named_variable_value(PaxRows7to13Desired); }
-  FLOAT64 getPaxRows14to21Desired() { return get_named_variable_value(PaxRows14to21Desired); }
-  FLOAT64 getPaxRows22to29Desired() { return get_named_variable_value(PaxRows22to29Desired); }
-  FLOAT64 getCargoFwdContainerActual() { return get_named_variable_value(CargoFwdContainerActual); }
-  FLOAT64 getCargoAftContainerActual() { return get_named_variable_value(CargoAftContainerActual); }
-  FLOAT64 getCargoAftBaggageActual() { return get_named_variable_value(CargoAftBaggageActual); }
-  FLOAT64 getCargoAftBulkActual() { return get_named_variable_value(CargoAftBulkActual); }
-  FLOAT64 getCargoFwdContainerDesired() { return get_named_variable_value(CargoFwdContainerDesired); }
-  FLOAT64 getCargoAftContainerDesired() { return get_named_variable_value(CargoAftContainerDesired); }
-  FLOAT64 getCargoAftBaggageDesired() { return get_named_variable_value(CargoAftBaggageDesired); }
-  FLOAT64 getCargoAftBulkDesired() { return get_named_variable_value(CargoAftBulkDesired); }
-  FLOAT64 getPacksState1() { return get_named_variable_value(PacksState1); }
-  FLOAT64 getPacksState2() { return get_named_variable_value(PacksState2); }
-  FLOAT64 getThrustLimitType() { return get_named_variable_value(ThrustLimitType); }
+  FLOAT64 getDeveloperState() { return lvarSnapshot.get(DevVar); }
+  FLOAT64 getFlexTemp() { return lvarSnapshot.get(FlexTemp); }
+  FLOAT64 getEngineN2(int index) { return lvarSnapshot.get(EngineN2 + index - 1); }
+  FLOAT64 getEngineN1(int index) { return lvarSnapshot.get(EngineN1 + index - 1); }
+  FLOAT64 getEngineIdleN1() { return lvarSnapshot.get(EngineIdleN1); }
+  FLOAT64 getEngineIdleN2() { return lvarSnapshot.get(EngineIdleN2); }
+  FLOAT64 getEngineIdleFF() { return lvarSnapshot.get(EngineIdleFF); }
+  FLOAT64 getEngineIdleEGT() { return lvarSnapshot.get(EngineIdleEGT); }
+  FLOAT64 getEngineFF(int index) { return lvarSnapshot.get(EngineFF + index - 1); }
+  FLOAT64 getEngineEGT(int index) { return lvarSnapshot.get(EngineEGT + index - 1); }
+  FLOAT64 getEngineOil(int index) { return lvarSnapshot.get(EngineOil + index - 1); }
+  FLOAT64 getEngineTotalOil(int index) { return lvarSnapshot.get(EngineTotalOil + index - 1); }
+  FLOAT64 getEnginePreFF(int index) { return lvarSnapshot.get(EnginePreFF + index - 1); }
+  FLOAT64 getEngineImbalance() { return lvarSnapshot.get(EngineImbalance); }
+  FLOAT64 getFuelUsed(int index) { return lvarSnapshot.get(FuelUsed + index - 1); }
+  FLOAT64 getFuelLeftPre() { return lvarSnapshot.get(FuelLeftPre); }
+  FLOAT64 getFuelRightPre() { return lvarSnapshot.get(FuelRightPre); }
+  FLOAT64 getFuelAuxLeftPre() { return lvarSnapshot.get(FuelAuxLeftPre); }
+  FLOAT64 getFuelAuxRightPre() { return lvarSnapshot.get(FuelAuxRightPre); }
+  FLOAT64 getFuelCenterPre() { return lvarSnapshot.get(FuelCenterPre); }
+  FLOAT64 getRefuelRate() { return lvarSnapshot.get(RefuelRate); }
+  FLOAT64 getRefuelStartedByUser() { return lvarSnapshot.get(RefuelStartedByUser); }
+  FLOAT64 getPumpStateEngine1() { return lvarSnapshot.get(PumpStateEngine1); }
+  FLOAT64 getPumpStateEngine2() { return lvarSnapshot.get(PumpStateEngine2); }
+  FLOAT64 getPumpStateEngine3() { return lvarSnapshot.get(PumpStateEngine3); }
+  FLOAT64 getPumpStateEngine4() { return lvarSnapshot.get(PumpStateEngine4); }
+  FLOAT64 getPerPaxWeight() { return lvarSnapshot.get(PerPaxWeight); }
+  FLOAT64 getConversionFactor() { return lvarSnapshot.get(ConversionFactor); }
+  FLOAT64 getPaxRows1to6Actual() { return lvarSnapshot.get(PaxRows1to6Actual); }
+  FLOAT64 getPaxRows7to13Actual() { return lvarSnapshot.get(PaxRows7to13Actual); }
+  FLOAT64 getPaxRows14to21Actual() { return lvarSnapshot.get(PaxRows14to21Actual); }
+  FLOAT64 getPaxRows22to29Actual() { return lvarSnapshot.get(PaxRows22to29Actual); }
+  FLOAT64 getPaxRows1to6Desired() { return lvarSnapshot.get(PaxRows1to6Desired); }
+  FLOAT64 getPaxRows7to13Desired() { return lvarSnapshot.get(PaxRows7to13Desired); }
+  FLOAT64 getPaxRows14to21Desired() { return lvarSnapshot.get(PaxRows14to21Desired); }
+  FLOAT64 getPaxRows22to29Desired() { return lvarSnapshot.get(PaxRows22to29Desired); }
+  FLOAT64 getCargoFwdContainerActual() { return lvarSnapshot.get(CargoFwdContainerActual); }
+  FLOAT64 getCargoAftContainerActual() { return lvarSnapshot.get(CargoAftContainerActual); }
+  FLOAT64 getCargoAftBaggageActual() { return lvarSnapshot.get(CargoAftBaggageActual); }
+  FLOAT64 getCargoAftBulkActual() { return lvarSnapshot.get(CargoAftBulkActual); }
+  FLOAT64 getCargoFwdContainerDesired() { return lvarSnapshot.get(CargoFwdContainerDesired); }
+  FLOAT64 getCargoAftContainerDesired() { return lvarSnapshot.get(CargoAftContainerDesired); }
+  FLOAT64 getCargoAftBaggageDesired() { return lvarSnapshot.get(CargoAftBaggageDesired); }
+  FLOAT64 getCargoAftBulkDesired() { return lvarSnapshot.get(CargoAftBulkDesired); }
+  FLOAT64 getPacksState1() { return lvarSnapshot.get(PacksState1); }
+  FLOAT64 getPacksState2() { return lvarSnapshot.get(PacksState2); }
+  FLOAT64 getThrustLimitType() { return lvarSnapshot.get(ThrustLimitType); }
 
-  FLOAT64 getCN1(int index) { return aircraft_varget(CorrectedN1, m_Units->Percent, index); }
+  FLOAT64 getCN1(int index) { return simVarSnapshot.get(CorrectedN1Handle + index - 1); }
   FLOAT64 getCN2(int index) { return aircraft_varget(CorrectedN2, m_Units->Percent, index); }
-  FLOAT64 getN1(int index) { return aircraft_varget(N1, m_Units->Percent, index); }
-  FLOAT64 getN2(int index) { return aircraft_varget(N2, m_Units->Percent, index); }
-  FLOAT64 getOilPsi(int index) { return aircraft_varget(OilPSI, m_Units->Psi, index); }
-  FLOAT64 getOilTemp(int index) { return aircraft_varget(OilTemp, m_Units->Celsius, index); }
-  FLOAT64 getThrust(int index) { return aircraft_varget(Thrust, m_Units->Pounds, index); }
-  FLOAT64 getEngine1State() { return get_named_variable_value(Engine1State); }
-  FLOAT64 getEngine2State() { return get_named_variable_value(Engine2State); }
-  FLOAT64 getEngine3State() { return get_named_variable_value(Engine3State); }
-  FLOAT64 getEngine4State() { return get_named_variable_value(Engine4State); }
-  FLOAT64 getEngine1Timer() { return get_named_variable_value(Engine1Timer); }
-  FLOAT64 getEngine2Timer() { return get_named_variable_value(Engine2Timer); }
-  FLOAT64 getEngine3Timer() { return get_named_variable_value(Engine3Timer); }
-  FLOAT64 getEngine4Timer() { return get_named_variable_value(Engine4Timer); }
+  FLOAT64 getN1(int index) { return simVarSnapshot.get(N1Handle + index - 1); }
+  FLOAT64 getN2(int index) { return simVarSnapshot.get(N2Handle + index - 1); }
+  FLOAT64 getOilPsi(int index) { return simVarSnapshot.get(OilPsiHandle + index - 1); }
+  FLOAT64 getOilTemp(int index) { return simVarSnapshot.get(OilTempHandle + index - 1); }
+  FLOAT64 getThrust(int index) { return simVarSnapshot.get(ThrustHandle + index - 1); }
+  FLOAT64 getEngineState(int index) { return lvarSnapshot.get(EngineState + index - 1); }
+  FLOAT64 getEngineTimer(int index) { return lvarSnapshot.get(EngineTimer + index - 1); }
   FLOAT64 getFF(int index) { return aircraft_varget(correctedFF, m_Units->Pph, index); }
-  FLOAT64 getMach() { return aircraft_varget(AirSpeedMach, m_Units->Mach, 0); }
+  FLOAT64 getMach() { return simVarSnapshot.get(AirSpeedMachHandle); }
   FLOAT64 getPlaneAltitude() { return aircraft_varget(PlaneAltitude, m_Units->Feet, 0); }
   FLOAT64 getPlaneAltitudeAGL() { return aircraft_varget(PlaneAltitudeAGL, m_Units->Feet, 0); }
-  FLOAT64 getPressureAltitude() { return aircraft_varget(PressureAltitude, m_Units->Feet, 0); }
+  FLOAT64 getPressureAltitude() { return simVarSnapshot.get(PressureAltitudeHandle); }
   FLOAT64 getVerticalSpeed() { return aircraft_varget(VerticalSpeed, m_Units->FeetMin, 0); }
-  FLOAT64 getAmbientTemperature() { return aircraft_varget(AmbientTemp, m_Units->Celsius, 0); }
-  FLOAT64 getAmbientPressure() { return aircraft_varget(AmbientPressure, m_Units->Millibars, 0); }
+  FLOAT64 getAmbientTemperature() { return simVarSnapshot.get(AmbientTempHandle); }
+  FLOAT64 getAmbientPressure() { return simVarSnapshot.get(AmbientPressureHandle); }
   FLOAT64 getStdTemperature() { return aircraft_varget(StdTemp, m_Units->Celsius, 0); }
-  FLOAT64 getSimOnGround() { return aircraft_varget(SimOnGround, m_Units->Bool, 0); }
+  FLOAT64 getSimOnGround() { return simVarSnapshot.get(SimOnGroundHandle); }
   FLOAT64 getTankLeftAuxCapacity() { return aircraft_varget(TankLeftAuxCapacity, m_Units->Gallons, 0); }
   FLOAT64 getTankRightAuxCapacity() { return aircraft_varget(TankRightAuxCapacity, m_Units->Gallons, 0); }
   FLOAT64 getTankLeftCapacity() { return aircraft_varget(TankLeftCapacity, m_Units->Gallons, 0); }
   FLOAT64 getTankRightCapacity() { return aircraft_varget(TankRightCapacity, m_Units->Gallons, 0); }
   FLOAT64 getTankCenterCapacity() { return aircraft_varget(TankCenterCapacity, m_Units->Gallons, 0); }
-  FLOAT64 getTankLeftAuxQuantity() { return aircraft_varget(TankLeftAuxQuantity, m_Units->Gallons, 0); }
-  FLOAT64 getTankRightAuxQuantity() { return aircraft_varget(TankRightAuxQuantity, m_Units->Gallons, 0); }
-  FLOAT64 getTankLeftQuantity() { return aircraft_varget(TankLeftQuantity, m_Units->Gallons, 0); }
-  FLOAT64 getTankRightQuantity() { return aircraft_varget(TankRightQuantity, m_Units->Gallons, 0); }
-  FLOAT64 getTankCenterQuantity() { return aircraft_varget(TankCenterQuantity, m_Units->Gallons, 0); }
-  FLOAT64 getFuelTotalQuantity() { return aircraft_varget(FuelTotalQuantity, m_Units->Gallons, 0); }
-  FLOAT64 getEmptyWeight() { return aircraft_varget(EmptyWeight, m_Units->Pounds, 0); }
-  FLOAT64 getTotalWeight() { return aircraft_varget(TotalWeight, m_Units->Pounds, 0); }
-  FLOAT64 getFuelWeightGallon() { return aircraft_varget(FuelWeightGallon, m_Units->Pounds, 0); }
+  FLOAT64 getTankLeftAuxQuantity() { return simVarSnapshot.get(TankLeftAuxQuantityHandle); }
+  FLOAT64 getTankRightAuxQuantity() { return simVarSnapshot.get(TankRightAuxQuantityHandle); }
+  FLOAT64 getTankLeftQuantity() { return simVarSnapshot.get(TankLeftQuantityHandle); }
+  FLOAT64 getTankRightQuantity() { return simVarSnapshot.get(TankRightQuantityHandle); }
+  FLOAT64 getTankCenterQuantity() { return simVarSnapshot.get(TankCenterQuantityHandle); }
+  FLOAT64 getFuelTotalQuantity() { return simVarSnapshot.get(FuelTotalQuantityHandle); }
+  FLOAT64 getEmptyWeight() { return simVarSnapshot.get(EmptyWeightHandle); }
+  FLOAT64 getTotalWeight() { return simVarSnapshot.get(TotalWeightHandle); }
+  FLOAT64 getFuelWeightGallon() { return simVarSnapshot.get(FuelWeightGallonHandle); }
   FLOAT64 getEngineTime(int index) { return aircraft_varget(EngineTime, m_Units->Seconds, index); }
-  FLOAT64 getEngineStarter(int index) { return aircraft_varget(EngineStarter, m_Units->Bool, index); }
-  FLOAT64 getEngineIgniter(int index) { return aircraft_varget(EngineIgniter, m_Units->Number, index); }
+  FLOAT64 getEngineStarter(int index) { return simVarSnapshot.get(EngineStarterHandle + index - 1); }
+  FLOAT64 getEngineIgniter(int index) { return simVarSnapshot.get(EngineIgniterHandle + index - 1); }
   FLOAT64 getEngineCombustion(int index) { return aircraft_varget(EngineCombustion, m_Units->Bool, index); }
-  FLOAT64 getAnimDeltaTime() { return aircraft_varget(animDeltaTime, m_Units->Seconds, 0); }
-  FLOAT64 getNAI(int index) { return aircraft_varget(NacelleAntiIce, m_Units->Bool, index); }
-  FLOAT64 getWAI() { return aircraft_varget(WingAntiIce, m_Units->Bool, 0); }
+  FLOAT64 getAnimDeltaTime() { return simVarSnapshot.get(AnimDeltaTimeHandle); }
+  FLOAT64 getNAI(int index) { return simVarSnapshot.get(NacelleAntiIceHandle + index - 1); }
+  FLOAT64 getWAI() { return simVarSnapshot.get(WingAntiIceHandle); }
 };
@@ -0,0 +1,542 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "FastMath.h"
+#include "RegPolynomials.h"
+#include "Tables.h"
+#include "VariableSnapshot.h"
+#include "common.h"
+
+/// <summary>
+/// SimConnect data definitions of the engine procedures. The oil values of engine i + 1 are also defined alone by the
+/// first definition + i.
+/// </summary>
+template <size_t ENGINE_COUNT>
+struct EngineDataDefinitions {
+  std::array<SIMCONNECT_DATA_DEFINITION_ID, ENGINE_COUNT> startCN2;
+  SIMCONNECT_DATA_DEFINITION_ID oilTemperatures;
+  SIMCONNECT_DATA_DEFINITION_ID firstOilTemperature;
+  SIMCONNECT_DATA_DEFINITION_ID oilPressures;
+  SIMCONNECT_DATA_DEFINITION_ID firstOilPressure;
+};
+
+/// <summary>
+/// Engine imbalance of the cycle in lanes, all zeros for the engines without imbalance
+/// </summary>
+template <size_t ENGINE_COUNT>
+struct EngineImbalance {
+  std::array<double, ENGINE_COUNT> egt{};
+  std::array<double, ENGINE_COUNT> ff{};
+  std::array<double, ENGINE_COUNT> n2{};
+  std::array<double, ENGINE_COUNT> oilPressure{};
+  // oil pressure offset of all engines
+  double oilPressureIdle = 0;
+};
+
+/// <summary>
+/// Engine lanes and procedures of the FADEC. The EngineControl of each aircraft derives from it and adds the fuel model,
+/// the thrust limits and its SimConnect setup.
+/// </summary>
+template <typename EngineSimVars, size_t ENGINE_COUNT>
+class EngineProcedures {
+ protected:
+  using EngineValues = std::array<double, ENGINE_COUNT>;
+
+  EngineSimVars* simVars;
+  EngineRatios* ratios;
+  Polynomial* poly;
+
+  bool simPaused;
+  double ambientTemp;
+  double ambientPressure;
+  double simOnGround;
+  double mach;
+  double pressAltitude;
+
+  double oilTemperatureMax;
+  double idleN1;
+  double idleN2;
+  double idleFF;
+  double idleEGT;
+
+  const double LBS_TO_KGS = 0.4535934;
+
+  /// <summary>
+  /// Engine parameters in structure-of-arrays layout, lane i holds engine i + 1. readEngines() fills the lanes at the
+  /// start of the cycle, the procedures update them engine by engine and writeEngines() publishes the LVars.
+  /// </summary>
+  struct EngineLanes {
+    // SimVars and LVars of this cycle
+    EngineValues starter;
+    EngineValues igniter;
+    EngineValues simCN1;
+    EngineValues simN1;
+    EngineValues simN2;
+    EngineValues thrust;
+    EngineValues state;
+    EngineValues timer;
+    EngineValues n1;
+    EngineValues n2;
+    EngineValues egt;
+    EngineValues ff;
+    EngineValues fuelUsed;
+
+    // Imbalance of this cycle, zero for the engines without imbalance
+    EngineValues egtImbalance;
+    EngineValues ffImbalance;
+    EngineValues n2Imbalance;
+    EngineValues oilPressureImbalance;
+
+    // Engine state after the state machine, selects the procedure of this cycle
+    std::array<int, ENGINE_COUNT> procedure;
+    EngineValues deltaN2;
+    EngineValues correctedFuelFlow;
+
+    // Kept from one cycle to the next
+    EngineValues simN2Pre;
+    EngineValues thermalEnergy;
+    EngineValues oilTemperaturePre;
+  } engines{};
+
+  explicit EngineProcedures(const EngineDataDefinitions<ENGINE_COUNT>& definitions)
+      : startCN2DataTypes(definitions.startCN2),
+        oilTemperatures(definitions.oilTemperatures, definitions.firstOilTemperature),
+        oilPressures(definitions.oilPressures, definitions.firstOilPressure) {}
+
+  /// <summary>
+  /// Generate Idle/ Initial Engine Parameters (non-imbalanced)
+  /// </summary>
+  void generateIdleParameters(double pressAltitude, double mach, double ambientTemp, double ambientPressure) {
+    double idleCN1;
+    double idleCFF;
+
+    idleCN1 = iCN1(pressAltitude, mach, ambientTemp);
+    idleN1 = idleCN1 * FastMath::sqrt(ratios->theta2(0, ambientTemp));
+    idleN2 = iCN2(pressAltitude, mach) * FastMath::sqrt(ratios->theta(ambientTemp));
+    idleCFF = poly->correctedFuelFlow(idleCN1, 0, pressAltitude);                                               // lbs/hr
+    idleFF = idleCFF * LBS_TO_KGS * ratios->delta2(0, ambientPressure) * FastMath::sqrt(ratios->theta2(0, ambientTemp));  // Kg/hr
+    idleEGT = poly->correctedEGT(idleCN1, idleCFF, 0, pressAltitude) * ratios->theta2(0, ambientTemp);
+
+    simVars->setEngineIdleN1(idleN1);
+    simVars->setEngineIdleN2(idleN2);
+    simVars->setEngineIdleFF(idleFF);
+    simVars->setEngineIdleEGT(idleEGT);
+  }
+
+  /// <summary>
+  /// Initializes the lanes, the oil temperature and the state of the engines. ambientTemp and oilTemperatureMax are
+  /// set by the caller.
+  /// </summary>
+  void initializeEngines() {
+    for (int lane = 0; lane < ENGINE_COUNT; lane++) {
+      engines.simN2Pre[lane] = simVars->getN2(lane + 1);
+    }
+
+    simOnGround = simVars->getSimOnGround();
+    bool allEnginesCombusting = true;
+    for (int lane = 0; lane < ENGINE_COUNT; lane++) {
+      allEnginesCombusting = allEnginesCombusting && simVars->getEngineCombustion(lane + 1) == 1;
+    }
+
+    double oilTemperature = ambientTemp;
+    if (simOnGround == 1 && allEnginesCombusting) {
+      oilTemperature = 75;
+    } else if (simOnGround == 0 && allEnginesCombusting) {
+      oilTemperature = 85;
+    }
+
+    for (int lane = 0; lane < ENGINE_COUNT; lane++) {
+      engines.thermalEnergy[lane] = 0;
+      engines.oilTemperaturePre[lane] = oilTemperature;
+      oilTemperatures.set(lane, engines.oilTemperaturePre[lane]);
+
+      // Initialize Engine State and reset Engine Timers
+      simVars->setEngineState(lane + 1, 10);
+      simVars->setEngineTimer(lane + 1, 0);
+    }
+    oilTemperatures.writeAll(hSimConnect);
+  }
+
+  /// <summary>
+  /// Engine procedures of this cycle, each one runs over the lanes of all engines
+  /// </summary>
+  void updateEngines(const EngineImbalance<ENGINE_COUNT>& imbalance, double deltaTime, double deltaTimeDiff) {
+    readEngines(imbalance);
+    engineStateMachine(deltaTimeDiff);
+    engineStartProcedure(deltaTime);
+    engineShutdownProcedure(deltaTime);
+    updatePrimaryParameters();
+    updateFF();
+    updateEGT(deltaTime);
+    // updateOil(deltaTime);
+    writeEngines();
+  }
+
+  /// <summary>
+  /// Starts the SimConnect data of the engines of this cycle from the values of the sim
+  /// </summary>
+  void readEngineSimObjectData() {
+    EngineValues oilTemperature;
+    EngineValues oilPressure;
+    for (int lane = 0; lane < ENGINE_COUNT; lane++) {
+      oilTemperature[lane] = simVars->getOilTemp(lane + 1);
+      oilPressure[lane] = simVars->getOilPsi(lane + 1);
+    }
+    oilTemperatures.setCurrent(oilTemperature);
+    oilPressures.setCurrent(oilPressure);
+  }
+
+  /// <summary>
+  /// Publishes the SimConnect data of the engines that was set in this cycle and differs from the sim
+  /// </summary>
+  void writeEngineSimObjectData() {
+    oilTemperatures.writeAll(hSimConnect);
+    oilPressures.writeAll(hSimConnect);
+  }
+
+ private:
+  double oilPressureIdle = 0;
+
+  std::array<SIMCONNECT_DATA_DEFINITION_ID, ENGINE_COUNT> startCN2DataTypes;
+  // SimConnect data of the engines of this cycle, published with one call per data definition
+  SimObjectDataSnapshot<ENGINE_COUNT> oilTemperatures;
+  SimObjectDataSnapshot<ENGINE_COUNT> oilPressures;
+
+  /// <summary>
+  /// Reads the engine SimVars and LVars of the cycle into the engine lanes
+  /// </summary>
+  void readEngines(const EngineImbalance<ENGINE_COUNT>& imbalance) {
+    engines.egtImbalance = imbalance.egt;
+    engines.ffImbalance = imbalance.ff;
+    engines.n2Imbalance = imbalance.n2;
+    engines.oilPressureImbalance = imbalance.oilPressure;
+    oilPressureIdle = imbalance.oilPressureIdle;
+
+    for (int lane = 0; lane < ENGINE_COUNT; lane++) {
+      int engine = lane + 1;
+      engines.starter[lane] = simVars->getEngineStarter(engine);
+      engines.igniter[lane] = simVars->getEngineIgniter(engine);
+      engines.simCN1[lane] = simVars->getCN1(engine);
+      engines.simN1[lane] = simVars->getN1(engine);
+      engines.simN2[lane] = simVars->getN2(engine);
+      engines.thrust[lane] = simVars->getThrust(engine);
+
+      engines.state[lane] = simVars->getEngineState(engine);
+      engines.timer[lane] = simVars->getEngineTimer(engine);
+      engines.n1[lane] = simVars->getEngineN1(engine);
+      engines.n2[lane] = simVars->getEngineN2(engine);
+      engines.egt[lane] = simVars->getEngineEGT(engine);
+      engines.ff[lane] = simVars->getEngineFF(engine);
+      engines.fuelUsed[lane] = simVars->getFuelUsed(engine);
+
+      engines.deltaN2[lane] = engines.simN2[lane] - engines.simN2Pre[lane];
+      engines.simN2Pre[lane] = engines.simN2[lane];
+    }
+  }
+
+  /// <summary>
+  /// Publishes the engine LVars of the cycle from the engine lanes
+  /// </summary>
+  void writeEngines() {
+    for (int lane = 0; lane < ENGINE_COUNT; lane++) {
+      int engine = lane + 1;
+      simVars->setEngineState(engine, engines.state[lane]);
+      simVars->setEngineTimer(engine, engines.timer[lane]);
+      simVars->setEngineN1(engine, engines.n1[lane]);
+      simVars->setEngineN2(engine, engines.n2[lane]);
+      simVars->setEngineEGT(engine, engines.egt[lane]);
+      simVars->setEngineFF(engine, engines.ff[lane]);
+      simVars->setFuelUsed(engine, engines.fuelUsed[lane]);
+    }
+  }
+
+  bool isStarting(int lane) const { return engines.procedure[lane] == 2 || engines.procedure[lane] == 3; }
+  bool isShuttingDown(int lane) const { return engines.procedure[lane] == 4; }
+
+  /// <summary>
+  /// Engine State Machine
+  /// 0 - Engine OFF, 1 - Engine ON, 2 - Engine Starting, 3 - Engine Re-starting & 4 - Engine Shutting
+  /// The resulting state selects the procedure of each engine for this cycle.
+  /// </summary>
+  void engineStateMachine(double deltaTimeDiff) {
+    // Present State PAUSED
+    simPaused = deltaTimeDiff == 0;
+
+    for (int lane = 0; lane < ENGINE_COUNT; lane++) {
+      double engineState = engines.state[lane];
+      double engineIgniter = engines.igniter[lane];
+      double engineStarter = engines.starter[lane];
+      double simN2 = engines.simN2[lane];
+      int resetTimer = 0;
+
+      if (simPaused) {
+        if (engineState < 10) {
+          engineState = engineState + 10;
+        }
+      } else {
+        // Present State OFF
+        if (engineState == 0 || engineState == 10) {
+          if (engineIgniter == 1 && engineStarter == 1 && simN2 > 20) {
+            engineState = 1;
+          } else if (engineIgniter == 2 && engineStarter == 1) {
+            engineState = 2;
+          } else {
+            engineState = 0;
+          }
+        }
+
+        // Present State ON
+        if (engineState == 1 || engineState == 11) {
+          if (engineStarter == 1) {
+            engineState = 1;
+          } else {
+            engineState = 4;
+          }
+        }
+
+        // Present State Starting.
+        if (engineState == 2 || engineState == 12) {
+          if (engineStarter == 1 && simN2 >= (idleN2 - 0.1)) {
+            engineState = 1;
+            resetTimer = 1;
+          } else if (engineStarter == 0) {
+            engineState = 4;
+            resetTimer = 1;
+          } else {
+            engineState = 2;
+          }
+        }
+
+        // Present State Re-Starting.
+        if (engineState == 3 || engineState == 13) {
+          if (engineStarter == 1 && simN2 >= (idleN2 - 0.1)) {
+            engineState = 1;
+            resetTimer = 1;
+          } else if (engineStarter == 0) {
+            engineState = 4;
+            resetTimer = 1;
+          } else {
+            engineState = 3;
+          }
+        }
+
+        // Present State Shutting
+        if (engineState == 4 || engineState == 14) {
+          if (engineIgniter == 2 && engineStarter == 1) {
+            engineState = 3;
+            resetTimer = 1;
+          } else if (engineStarter == 0 && simN2 < 0.05 && engines.egt[lane] <= ambientTemp) {
+            engineState = 0;
+            resetTimer = 1;
+          } else if (engineStarter == 1 && simN2 > 50) {
+            engineState = 3;
+            resetTimer = 1;
+          } else {
+            engineState = 4;
+          }
+        }
+      }
+
+      engines.state[lane] = engineState;
+      engines.procedure[lane] = int(engineState);
+      if (resetTimer == 1) {
+        engines.timer[lane] = 0;
+      }
+    }
+  }
+
+  /// <summary>
+  /// Engine Start Procedure
+  /// </summary>
+  void engineStartProcedure(double deltaTime) {
+    double startCN2 = 0;
+
+    idleN2 = simVars->getEngineIdleN2();
+    idleN1 = simVars->getEngineIdleN1();
+    idleFF = simVars->getEngineIdleFF();
+    idleEGT = simVars->getEngineIdleEGT();
+
+    for (int lane = 0; lane < ENGINE_COUNT; lane++) {
+      if (!isStarting(lane)) {
+        continue;
+      }
+
+      // Delay between Engine Master ON and Start Valve Open
+      if (engines.timer[lane] < 1.7) {
+        if (simOnGround == 1) {
+          engines.fuelUsed[lane] = 0;
+        }
+        engines.timer[lane] += deltaTime;
+        SimConnect_SetDataOnSimObject(hSimConnect, startCN2DataTypes[lane], SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double), &startCN2);
+        continue;
+      }
+
+      // the start procedure takes the N2 imbalance in whole percent
+      double startIdleN2 = idleN2 - static_cast<int>(engines.n2Imbalance[lane]);
+      double preEgtFbw = engines.egt[lane];
+      double newN2Fbw = poly->startN2(engines.simN2[lane], engines.n2[lane], startIdleN2);
+      double startEgtFbw = poly->startEGT(newN2Fbw, startIdleN2, ambientTemp, idleEGT - engines.egtImbalance[lane]);
+      double shutdownEgtFbw = poly->shutdownEGT(preEgtFbw, ambientTemp, deltaTime);
+
+      engines.n2[lane] = newN2Fbw;
+      engines.n1[lane] = poly->startN1(newN2Fbw, startIdleN2, idleN1);
+      engines.ff[lane] = poly->startFF(newN2Fbw, startIdleN2, idleFF - engines.ffImbalance[lane]);
+
+      if (engines.procedure[lane] == 3) {
+        if (abs(startEgtFbw - preEgtFbw) <= 1.5) {
+          engines.egt[lane] = startEgtFbw;
+          engines.state[lane] = 2;
+        } else if (startEgtFbw > preEgtFbw) {
+          engines.egt[lane] = preEgtFbw + (0.75 * deltaTime * (idleN2 - newN2Fbw));
+        } else {
+          engines.egt[lane] = shutdownEgtFbw;
+        }
+      } else {
+        engines.egt[lane] = startEgtFbw;
+      }
+
+      double oilTemperature = poly->startOilTemp(newN2Fbw, idleN2, ambientTemp);
+      engines.oilTemperaturePre[lane] = oilTemperature;
+      oilTemperatures.set(lane, oilTemperature);
+    }
+  }
+
+  /// <summary>
+  /// Engine Shutdown Procedure - TEMPORAL SOLUTION
+  /// </summary>
+  void engineShutdownProcedure(double deltaTime) {
+    for (int lane = 0; lane < ENGINE_COUNT; lane++) {
+      if (!isShuttingDown(lane)) {
+        continue;
+      }
+
+      if (engines.timer[lane] < 1.8) {
+        engines.timer[lane] += deltaTime;
+      } else {
+        double newN1Fbw = poly->shutdownN1(engines.n1[lane], deltaTime);
+        if (engines.simN1[lane] < 5 && engines.simN1[lane] > newN1Fbw) {  // Takes care of windmilling
+          newN1Fbw = engines.simN1[lane];
+        }
+        engines.n1[lane] = newN1Fbw;
+        engines.n2[lane] = poly->shutdownN2(engines.n2[lane], deltaTime);
+        engines.egt[lane] = poly->shutdownEGT(engines.egt[lane], ambientTemp, deltaTime);
+      }
+    }
+  }
+
+  /// <summary>
+  /// FBW Engine RPM (N1 and N2)
+  /// Updates Engine N1 and N2 of the engines that are neither starting nor shutting down
+  /// </summary>
+  void updatePrimaryParameters() {
+    for (int lane = 0; lane < ENGINE_COUNT; lane++) {
+      if (!isStarting(lane) && !isShuttingDown(lane)) {
+        engines.n1[lane] = engines.simN1[lane];
+        engines.n2[lane] = engines.simN2[lane] - engines.n2Imbalance[lane];
+      }
+    }
+  }
+
+  /// <summary>
+  /// FBW Exhaust Gas Temperature (in degree Celsius)
+  /// Updates EGT with realistic values visualized in the ECAM
+  /// </summary>
+  void updateEGT(double deltaTime) {
+    double theta2 = ratios->theta2(mach, ambientTemp);
+    double decay = expFBW(-0.1 * deltaTime);
+
+    for (int lane = 0; lane < ENGINE_COUNT; lane++) {
+      if (isStarting(lane) || isShuttingDown(lane)) {
+        continue;
+      }
+
+      if (simOnGround == 1 && engines.procedure[lane] == 0) {
+        engines.egt[lane] = ambientTemp;
+      } else {
+        double correctedEGT = poly->correctedEGT(engines.simCN1[lane], engines.correctedFuelFlow[lane], mach, pressAltitude);
+        double egtFbwActual = (correctedEGT * theta2) - engines.egtImbalance[lane];
+        engines.egt[lane] = egtFbwActual + (engines.egt[lane] - egtFbwActual) * decay;
+      }
+    }
+  }
+
+  /// <summary>
+  /// FBW Fuel FLow (in Kg/h)
+  /// Updates Fuel Flow with realistic values
+  /// </summary>
+  void updateFF() {
+    double fuelFlowFactor = LBS_TO_KGS * ratios->delta2(mach, ambientPressure) * FastMath::sqrt(ratios->theta2(mach, ambientTemp));
+
+    for (int lane = 0; lane < ENGINE_COUNT; lane++) {
+      if (isStarting(lane)) {
+        continue;
+      }
+
+      double correctedFuelFlow = poly->correctedFuelFlow(engines.simCN1[lane], mach, pressAltitude);  // in lbs/hr.
+      engines.correctedFuelFlow[lane] = correctedFuelFlow;
+
+      // Checking Fuel Logic and final Fuel Flow
+      if (correctedFuelFlow < 1) {
+        engines.ff[lane] = 0;
+      } else {
+        engines.ff[lane] = correctedFuelFlow * fuelFlowFactor - engines.ffImbalance[lane];
+      }
+    }
+  }
+
+  /// <summary>
+  /// FBW Oil Qty, Pressure and Temperature (in Quarts, PSI and degree Celsius)
+  /// Updates Oil with realistic values visualized in the SD
+  /// </summary>
+  void updateOil(double deltaTime) {
+    for (int lane = 0; lane < ENGINE_COUNT; lane++) {
+      int engine = lane + 1;
+      double steadyTemperature = engines.egt[lane];
+      double oilTemperaturePre = engines.oilTemperaturePre[lane];
+      double oilQtyActual = simVars->getEngineOil(engine);
+      double oilTotalActual = simVars->getEngineTotalOil(engine);
+      double oilTemperature;
+
+      //--------------------------------------------
+      // Oil Temperature
+      //--------------------------------------------
+      if (simOnGround == 1 && engines.procedure[lane] == 0 && ambientTemp > oilTemperaturePre - 10) {
+        oilTemperature = ambientTemp;
+      } else {
+        if (steadyTemperature > oilTemperatureMax) {
+          steadyTemperature = oilTemperatureMax;
+        }
+        engines.thermalEnergy[lane] = (0.995 * engines.thermalEnergy[lane]) + (engines.deltaN2[lane] / deltaTime);
+        oilTemperature = poly->oilTemperature(engines.thermalEnergy[lane], oilTemperaturePre, steadyTemperature, deltaTime);
+      }
+
+      //--------------------------------------------
+      // Oil Quantity
+      //--------------------------------------------
+      // Calculating Oil Qty as a function of thrust
+      double oilQtyObjective = oilTotalActual * (1 - poly->oilGulpPct(engines.thrust[lane]));
+      oilQtyActual = oilQtyActual - (oilTemperature - oilTemperaturePre);
+
+      // Oil burnt taken into account for tank and total oil
+      double oilBurn = (0.00011111 * deltaTime);
+      oilQtyActual = oilQtyActual - oilBurn;
+      oilTotalActual = oilTotalActual - oilBurn;
+
+      //--------------------------------------------
+      // Oil Pressure
+      //--------------------------------------------
+      double oilPressure = poly->oilPressure(engines.simN2[lane]) - engines.oilPressureImbalance[lane] + oilPressureIdle;
+
+      //--------------------------------------------
+      // Engine Writing
+      //--------------------------------------------
+      engines.oilTemperaturePre[lane] = oilTemperature;
+      simVars->setEngineOil(engine, oilQtyActual);
+      simVars->setEngineTotalOil(engine, oilTotalActual);
+      oilTemperatures.set(lane, oilTemperature);
+      oilPressures.set(lane, oilPressure);
+    }
+  }
+};
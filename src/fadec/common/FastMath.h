@@ -0,0 +1,126 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "HornerPolynomial.h"
+
+/// <summary>
+/// Elementary functions of the FADEC without calls into libm. The kernels are branch-free apart from range handling, so
+/// the array overloads evaluate one value per engine in a loop the compiler can vectorize.
+/// Error bounds, checked by fadecsim --math-check over the ranges the engine model uses:
+/// exp: relative error below 2e-16 (1 ulp) for all arguments, clamped to [-708, 709].
+/// expDecay: error below 3e-6 * |x| * e^x for the decay arguments in [-1, 0], the error of exp below -1.
+/// powHalfInteger: relative error below 1.2e-16 * (n + 1).
+/// sqrt: correctly rounded, it is a single instruction on the x86 and WebAssembly targets.
+/// </summary>
+namespace FastMath {
+
+namespace detail {
+
+constexpr double LOG2E = 1.4426950408889634;
+// ln(2) split into a part with a short mantissa, whose product with the exponent is exact, and the remainder
+constexpr double LN2_HIGH = 6.93147180369123816490e-01;
+constexpr double LN2_LOW = 1.90821492927058770002e-10;
+// adding 1.5 * 2^52 rounds to an integer that is kept in the low bits of the mantissa
+constexpr double ROUNDING_SHIFT = 6755399441055744.0;
+
+constexpr double MIN_EXP_ARGUMENT = -708;
+constexpr double MAX_EXP_ARGUMENT = 709;
+
+// e^r for |r| <= ln(2) / 2, Taylor series up to r^13 / 13!
+constexpr HornerPolynomial<14> EXP_SERIES({1.0, 1.0, 1.0 / 2, 1.0 / 6, 1.0 / 24, 1.0 / 120, 1.0 / 720, 1.0 / 5040, 1.0 / 40320,
+                                           1.0 / 362880, 1.0 / 3628800, 1.0 / 39916800, 1.0 / 479001600, 1.0 / 6227020800});
+
+// e^x = 1 + x * q(x) for x in [-1, 0], minimax for the error relative to |x| * e^x. A decay applied every frame
+// accumulates the error of each step, which thereby stays proportional to the decayed time and not to the frame rate.
+// With degree 5 it takes as many multiplies and adds as the previous (1 + x / 256)^256.
+constexpr double MIN_EXP_DECAY_ARGUMENT = -1;
+constexpr HornerPolynomial<6> EXP_DECAY_POLYNOMIAL({1.0, 0.9999971062027176, 0.49987608587146337, 0.16575588030486607,
+                                                    0.03920605259670585, 0.005450775357670265});
+
+}  // namespace detail
+
+/// <summary>
+/// e^x
+/// </summary>
+inline double exp(double x) {
+  x = x < detail::MIN_EXP_ARGUMENT ? detail::MIN_EXP_ARGUMENT : (x > detail::MAX_EXP_ARGUMENT ? detail::MAX_EXP_ARGUMENT : x);
+
+  // x = k * ln(2) + r
+  double shifted = x * detail::LOG2E + detail::ROUNDING_SHIFT;
+  int64_t k = static_cast<int32_t>(std::bit_cast<uint64_t>(shifted));
+  double kd = shifted - detail::ROUNDING_SHIFT;
+  double r = (x - kd * detail::LN2_HIGH) - kd * detail::LN2_LOW;
+
+  // e^x = 2^k * e^r, k is added to the exponent of e^r
+  return std::bit_cast<double>(std::bit_cast<uint64_t>(detail::EXP_SERIES.evaluate(r)) + (static_cast<uint64_t>(k) << 52));
+}
+
+/// <summary>
+/// e^x for x <= 0, the decay of the engine parameters. Arguments in [-1, 0] are evaluated by a polynomial of degree 5,
+/// smaller ones are left to exp.
+/// </summary>
+inline double expDecay(double x) {
+  return x >= detail::MIN_EXP_DECAY_ARGUMENT ? detail::EXP_DECAY_POLYNOMIAL.evaluate(x) : exp(x);
+}
+
+inline double sqrt(double x) {
+  return std::sqrt(x);
+}
+
+/// <summary>
+/// x^(n + 0.5) for x >= 0 by n multiplications and a square root, e.g. the pressure ratio power 3.5
+/// </summary>
+inline double powHalfInteger(double x, unsigned n) {
+  double power = sqrt(x);
+  while (n > 0) {
+    power *= x;
+    --n;
+  }
+  return power;
+}
+
+/// <summary>
+/// Array versions, one value per engine
+/// </summary>
+template <size_t N>
+std::array<double, N> exp(const std::array<double, N>& x) {
+  std::array<double, N> result{};
+  for (size_t i = 0; i < N; i++) {
+    result[i] = exp(x[i]);
+  }
+  return result;
+}
+
+template <size_t N>
+std::array<double, N> expDecay(const std::array<double, N>& x) {
+  std::array<double, N> result{};
+  for (size_t i = 0; i < N; i++) {
+    result[i] = expDecay(x[i]);
+  }
+  return result;
+}
+
+template <size_t N>
+std::array<double, N> sqrt(const std::array<double, N>& x) {
+  std::array<double, N> result{};
+  for (size_t i = 0; i < N; i++) {
+    result[i] = sqrt(x[i]);
+  }
+  return result;
+}
+
+template <size_t N>
+std::array<double, N> powHalfInteger(const std::array<double, N>& x, unsigned n) {
+  std::array<double, N> result{};
+  for (size_t i = 0; i < N; i++) {
+    result[i] = powHalfInteger(x[i], n);
+  }
+  return result;
+}
+
+}  // namespace FastMath
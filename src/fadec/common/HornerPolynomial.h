@@ -0,0 +1,43 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+/// <summary>
+/// Polynomial c[0] + c[1] * x + ... + c[N - 1] * x^(N - 1) with a constant coefficient table, evaluated by Horner's
+/// scheme with N - 1 multiplies and adds.
+/// </summary>
+template <size_t N>
+class HornerPolynomial {
+ public:
+  static_assert(N > 0, "polynomial needs at least one coefficient");
+
+  constexpr explicit HornerPolynomial(const std::array<double, N>& coefficients) : coefficients(coefficients) {}
+
+  constexpr double evaluate(double x) const {
+    double result = coefficients[N - 1];
+    for (size_t k = N - 1; k > 0; k--) {
+      result = result * x + coefficients[k - 1];
+    }
+    return result;
+  }
+
+  /// <summary>
+  /// Evaluates the polynomial for one value per engine at once. The lanes are independent, so the compiler can keep
+  /// them in vector registers where the target has them.
+  /// </summary>
+  template <size_t LANES>
+  constexpr std::array<double, LANES> evaluate(const std::array<double, LANES>& x) const {
+    std::array<double, LANES> result{};
+    result.fill(coefficients[N - 1]);
+    for (size_t k = N - 1; k > 0; k--) {
+      for (size_t lane = 0; lane < LANES; lane++) {
+        result[lane] = result[lane] * x[lane] + coefficients[k - 1];
+      }
+    }
+    return result;
+  }
+
+ private:
+  std::array<double, N> coefficients;
+};
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+/// <summary>
+/// Position of a value between two breakpoints: the lower breakpoint and the weight of the upper one (0 to 1).
+/// </summary>
+struct TableSegment {
+  size_t index;
+  double fraction;
+
+  constexpr double interpolate(double lower, double upper) const { return lower * (1 - fraction) + upper * fraction; }
+};
+
+/// <summary>
+/// Ascending breakpoints of a table axis with a precomputed index over uniform buckets of the axis. A lookup goes to the
+/// bucket of the value and from the first segment of the bucket to the segment of the value, which is at most a few
+/// steps as there are twice as many buckets as breakpoints. Values outside the axis are clamped to its ends.
+/// </summary>
+template <size_t N>
+class TableAxis {
+ public:
+  static_assert(N >= 2, "axis needs at least two breakpoints");
+
+  constexpr explicit TableAxis(const std::array<double, N>& breakpoints) : breakpoints(breakpoints) {
+    bucketScale = BUCKETS / (breakpoints[N - 1] - breakpoints[0]);
+    size_t segment = 0;
+    for (size_t bucket = 0; bucket < BUCKETS; bucket++) {
+      double bucketStart = breakpoints[0] + bucket / bucketScale;
+      while (segment < N - 2 && breakpoints[segment + 1] <= bucketStart) {
+        segment++;
+      }
+      bucketSegments[bucket] = segment;
+    }
+  }
+
+  constexpr TableSegment locate(double x) const {
+    if (!(x > breakpoints[0])) {
+      return {0, 0};
+    }
+    if (x >= breakpoints[N - 1]) {
+      return {N - 2, 1};
+    }
+
+    size_t bucket = static_cast<size_t>((x - breakpoints[0]) * bucketScale);
+    size_t segment = bucketSegments[bucket < BUCKETS ? bucket : BUCKETS - 1];
+    while (segment < N - 2 && x >= breakpoints[segment + 1]) {
+      segment++;
+    }
+
+    double width = breakpoints[segment + 1] - breakpoints[segment];
+    return {segment, width > 0 ? (x - breakpoints[segment]) / width : 0};
+  }
+
+ private:
+  static constexpr size_t BUCKETS = 2 * N;
+
+  std::array<double, N> breakpoints;
+  std::array<size_t, BUCKETS> bucketSegments{};
+  double bucketScale = 0;
+};
+
+/// <summary>
+/// Table of COLUMNS values per breakpoint, interpolated linearly between the breakpoints. Each row of the table data is
+/// the breakpoint followed by its values.
+/// </summary>
+template <size_t ROWS, size_t COLUMNS>
+class InterpolationTable {
+ public:
+  using Values = std::array<double, COLUMNS>;
+
+  constexpr explicit InterpolationTable(const double (&rows)[ROWS][COLUMNS + 1]) : axis(breakpointsOf(rows)), values(valuesOf(rows)) {}
+
+  constexpr double interpolate(double x, size_t column) const {
+    TableSegment segment = axis.locate(x);
+    return segment.interpolate(values[segment.index][column], values[segment.index + 1][column]);
+  }
+
+  /// <summary>
+  /// Interpolates all columns at once.
+  /// </summary>
+  constexpr Values interpolate(double x) const {
+    TableSegment segment = axis.locate(x);
+    Values result{};
+    for (size_t column = 0; column < COLUMNS; column++) {
+      result[column] = segment.interpolate(values[segment.index][column], values[segment.index + 1][column]);
+    }
+    return result;
+  }
+
+ private:
+  TableAxis<ROWS> axis;
+  std::array<Values, ROWS> values;
+
+  static constexpr std::array<double, ROWS> breakpointsOf(const double (&rows)[ROWS][COLUMNS + 1]) {
+    std::array<double, ROWS> breakpoints{};
+    for (size_t row = 0; row < ROWS; row++) {
+      breakpoints[row] = rows[row][0];
+    }
+    return breakpoints;
+  }
+
+  static constexpr std::array<Values, ROWS> valuesOf(const double (&rows)[ROWS][COLUMNS + 1]) {
+    std::array<Values, ROWS> result{};
+    for (size_t row = 0; row < ROWS; row++) {
+      for (size_t column = 0; column < COLUMNS; column++) {
+        result[row][column] = rows[row][column + 1];
+      }
+    }
+    return result;
+  }
+};
+
+/// <summary>
+/// Table of values over two axes, interpolated bilinearly.
+/// </summary>
+template <size_t ROWS, size_t COLUMNS>
+class InterpolationTable2D {
+ public:
+  constexpr InterpolationTable2D(const std::array<double, ROWS>& rowBreakpoints,
+                                 const std::array<double, COLUMNS>& columnBreakpoints,
+                                 const double (&table)[ROWS][COLUMNS])
+      : rowAxis(rowBreakpoints), columnAxis(columnBreakpoints), values(valuesOf(table)) {}
+
+  constexpr double interpolate(double x, double y) const {
+    TableSegment row = rowAxis.locate(x);
+    TableSegment column = columnAxis.locate(y);
+    double lower = row.interpolate(values[row.index][column.index], values[row.index + 1][column.index]);
+    double upper = row.interpolate(values[row.index][column.index + 1], values[row.index + 1][column.index + 1]);
+    return column.interpolate(lower, upper);
+  }
+
+ private:
+  TableAxis<ROWS> rowAxis;
+  TableAxis<COLUMNS> columnAxis;
+  std::array<std::array<double, COLUMNS>, ROWS> values;
+
+  static constexpr std::array<std::array<double, COLUMNS>, ROWS> valuesOf(const double (&table)[ROWS][COLUMNS]) {
+    std::array<std::array<double, COLUMNS>, ROWS> result{};
+    for (size_t row = 0; row < ROWS; row++) {
+      for (size_t column = 0; column < COLUMNS; column++) {
+        result[row][column] = table[row][column];
+      }
+    }
+    return result;
+  }
+};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "HornerPolynomial.h"
 #include "common.h"
 
 /// <summary>
@@ -69,15 +70,7 @@ class Polynomial {
 
     normalN2 = n2 * 68.2 / idleN2;
 
-    double c_N2[16] = {4.03649879e+00,  -9.41981960e-01, 1.98426614e-01,  -2.11907840e-02, 1.00777507e-03,  -1.57319166e-06,
-                       -2.15034888e-06, 1.08288379e-07,  -2.48504632e-09, 2.52307089e-11,  -2.06869243e-14, 8.99045761e-16,
-                       -9.94853959e-17, 1.85366499e-18,  -1.44869928e-20, 4.31033031e-23};
-
-    outN2 = c_N2[0] + (c_N2[1] * normalN2) + (c_N2[2] * powFBW(normalN2, 2)) + (c_N2[3] * powFBW(normalN2, 3)) +
-            (c_N2[4] * powFBW(normalN2, 4)) + (c_N2[5] * powFBW(normalN2, 5)) + (c_N2[6] * powFBW(normalN2, 6)) +
-            (c_N2[7] * powFBW(normalN2, 7)) + (c_N2[8] * powFBW(normalN2, 8)) + (c_N2[9] * powFBW(normalN2, 9)) +
-            (c_N2[10] * powFBW(normalN2, 10)) + (c_N2[11] * powFBW(normalN2, 11)) + (c_N2[12] * powFBW(normalN2, 12)) +
-            (c_N2[13] * powFBW(normalN2, 13)) + (c_N2[14] * powFBW(normalN2, 14)) + (c_N2[15] * powFBW(normalN2, 15));
+    outN2 = startN2Polynomial.evaluate(normalN2);
 
     outN2 = outN2 * n2;
 
@@ -98,14 +91,9 @@ class Polynomial {
     double normalN1pre = 0;
     double normalN1post = 0;
     double normalN2 = fbwN2 / idleN2;
-    double c_N1[9] = {-2.2812156e-12, -5.9830374e+01, 7.0629094e+02,  -3.4580361e+03, 9.1428923e+03,
-                      -1.4097740e+04, 1.2704110e+04,  -6.2099935e+03, 1.2733071e+03};
-
-    normalN1pre = (-2.4698087 * powFBW(normalN2, 3)) + (0.9662026 * powFBW(normalN2, 2)) + (0.0701367 * normalN2);
 
-    normalN1post = c_N1[0] + (c_N1[1] * normalN2) + (c_N1[2] * powFBW(normalN2, 2)) + (c_N1[3] * powFBW(normalN2, 3)) +
-                   (c_N1[4] * powFBW(normalN2, 4)) + (c_N1[5] * powFBW(normalN2, 5)) + (c_N1[6] * powFBW(normalN2, 6)) +
-                   (c_N1[7] * powFBW(normalN2, 7)) + (c_N1[8] * powFBW(normalN2, 8));
+    normalN1pre = startN1PrePolynomial.evaluate(normalN2);
+    normalN1post = startN1Polynomial.evaluate(normalN2);
 
     if (normalN1post >= normalN1pre)
       return normalN1post * idleN1;
@@ -124,12 +112,7 @@ class Polynomial {
     if (normalN2 <= 0.37) {
       normalFF = 0;
     } else {
-      double c_FF[9] = {3.1110282e-12, 1.0804331e+02,  -1.3972629e+03, 7.4874131e+03, -2.1511983e+04,
-                        3.5957757e+04, -3.5093994e+04, 1.8573033e+04,  -4.1220062e+03};
-
-      normalFF = c_FF[0] + (c_FF[1] * normalN2) + (c_FF[2] * powFBW(normalN2, 2)) + (c_FF[3] * powFBW(normalN2, 3)) +
-                 (c_FF[4] * powFBW(normalN2, 4)) + (c_FF[5] * powFBW(normalN2, 5)) + (c_FF[6] * powFBW(normalN2, 6)) +
-                 (c_FF[7] * powFBW(normalN2, 7)) + (c_FF[8] * powFBW(normalN2, 8));
+      normalFF = startFFPolynomial.evaluate(normalN2);
     }
 
     if (normalFF < 0) {
@@ -152,12 +135,7 @@ class Polynomial {
     } else if (normalN2 <= 0.4) {
       normalEGT = (0.04783 * normalN2) - 0.00813;
     } else {
-      double c_EGT[9] = {-6.8725167e+02, 7.7548864e+03,  -3.7507098e+04, 1.0147016e+05, -1.6779273e+05,
-                         1.7357157e+05,  -1.0960924e+05, 3.8591956e+04,  -5.7912600e+03};
-
-      normalEGT = c_EGT[0] + (c_EGT[1] * normalN2) + (c_EGT[2] * powFBW(normalN2, 2)) + (c_EGT[3] * powFBW(normalN2, 3)) +
-                  (c_EGT[4] * powFBW(normalN2, 4)) + (c_EGT[5] * powFBW(normalN2, 5)) + (c_EGT[6] * powFBW(normalN2, 6)) +
-                  (c_EGT[7] * powFBW(normalN2, 7)) + (c_EGT[8] * powFBW(normalN2, 8));
+      normalEGT = startEGTPolynomial.evaluate(normalN2);
     }
 
     outEGT = (normalEGT * (idleEGT - (ambientTemp))) + (ambientTemp);
@@ -249,9 +227,7 @@ class Polynomial {
   double oilGulpPct(double thrust) {
     double outOilGulpPct = 0;
 
-    double c_OilGulp[3] = {20.1968848, -1.2270302e-4, 1.78442e-8};
-
-    outOilGulpPct = c_OilGulp[0] + (c_OilGulp[1] * thrust) + (c_OilGulp[2] * powFBW(thrust, 2));
+    outOilGulpPct = oilGulpPolynomial.evaluate(thrust);
 
     return outOilGulpPct / 100;
   }
@@ -262,10 +238,26 @@ class Polynomial {
   double oilPressure(double simN2) {
     double outOilPressure = 0;
 
-    double c_OilPress[3] = {-0.88921, 0.23711, 0.00682};
-
-    outOilPressure = c_OilPress[0] + (c_OilPress[1] * simN2) + (c_OilPress[2] * powFBW(simN2, 2));
+    outOilPressure = oilPressurePolynomial.evaluate(simN2);
 
     return outOilPressure;
   }
+
+  // Coefficient tables of the univariate polynomials, lowest order first
+  static constexpr HornerPolynomial<16> startN2Polynomial{
+      {4.03649879e+00, -9.41981960e-01, 1.98426614e-01, -2.11907840e-02, 1.00777507e-03, -1.57319166e-06, -2.15034888e-06,
+       1.08288379e-07, -2.48504632e-09, 2.52307089e-11, -2.06869243e-14, 8.99045761e-16, -9.94853959e-17, 1.85366499e-18,
+       -1.44869928e-20, 4.31033031e-23}};
+  static constexpr HornerPolynomial<4> startN1PrePolynomial{{0, 0.0701367, 0.9662026, -2.4698087}};
+  static constexpr HornerPolynomial<9> startN1Polynomial{{-2.2812156e-12, -5.9830374e+01, 7.0629094e+02, -3.4580361e+03,
+                                                          9.1428923e+03, -1.4097740e+04, 1.2704110e+04, -6.2099935e+03,
+                                                          1.2733071e+03}};
+  static constexpr HornerPolynomial<9> startFFPolynomial{{3.1110282e-12, 1.0804331e+02, -1.3972629e+03, 7.4874131e+03,
+                                                          -2.1511983e+04, 3.5957757e+04, -3.5093994e+04, 1.8573033e+04,
+                                                          -4.1220062e+03}};
+  static constexpr HornerPolynomial<9> startEGTPolynomial{{-6.8725167e+02, 7.7548864e+03, -3.7507098e+04, 1.0147016e+05,
+                                                           -1.6779273e+05, 1.7357157e+05, -1.0960924e+05, 3.8591956e+04,
+                                                           -5.7912600e+03}};
+  static constexpr HornerPolynomial<3> oilGulpPolynomial{{20.1968848, -1.2270302e-4, 1.78442e-8}};
+  static constexpr HornerPolynomial<3> oilPressurePolynomial{{-0.88921, 0.23711, 0.00682}};
 };
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "InterpolationTable.h"
+#include "common.h"
+
+EngineRatios* ratios;
+
+/// <summary>
+/// Table 1502 (CN2 vs correctedN1) representations with FSX nomenclature: correctedN1 at Mach 0.2 and 0.9 per CN2
+/// </summary>
+static constexpr InterpolationTable2D<13, 2> table1502{
+    {18.20, 22.00, 26.00, 57.00, 68.20, 77.00, 83.00, 89.00, 92.80, 97.00, 100.00, 104.00, 116.50},
+    {0.2, 0.9},
+    {{0.00, 17.00},
+     {1.90, 17.40},
+     {2.50, 18.20},
+     {12.80, 27.00},
+     {19.60, 34.83},
+     {26.00, 40.84},
+     {31.42, 44.77},
+     {40.97, 50.09},
+     {51.00, 55.04},
+     {65.00, 65.00},
+     {77.00, 77.00},
+     {85.00, 85.50},
+     {101.00, 101.00}}};
+
+/// <summary>
+/// Calculate expected CN2 at Idle
+/// </summary>
+double iCN2(double pressAltitude, double mach) {
+  double cn2 = 0;
+
+  cn2 = 68.2 / (FastMath::sqrt((288.15 - (1.98 * pressAltitude / 1000)) / 288.15) * FastMath::sqrt(1 + (0.2 * powFBW(mach, 2))));
+
+  return cn2;
+}
+
+/// <summary>
+/// Calculate expected correctedN1 at Idle
+/// </summary>
+double iCN1(double pressAltitude, double mach, double ambientTemp) {
+  return table1502.interpolate(iCN2(pressAltitude, mach), mach);
+}
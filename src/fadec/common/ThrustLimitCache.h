@@ -0,0 +1,95 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+/// <summary>
+/// Width of the input bands of the thrust limit cache. A width of 0 only reuses a limit for the same input.
+/// </summary>
+struct ThrustLimitTolerances {
+  double altitude = 10;       // ft
+  double temperature = 0.05;  // degrees C
+  double pressure = 0.1;      // hPa
+};
+
+/// <summary>
+/// Memoized N1 limits. The limits depend on slowly changing inputs, so a limit is only recomputed when the altitude,
+/// temperature or pressure moves to another tolerance band, or when the flex temperature or a bleed state changes.
+/// There is one entry per limit type with and without flex temperature, i.e. per limit that is computed every frame.
+/// </summary>
+class ThrustLimitCache {
+ public:
+  static constexpr int LIMIT_TYPES = 4;
+
+  explicit ThrustLimitCache(const ThrustLimitTolerances& tolerances = {}) : tolerances(tolerances) {}
+
+  void setTolerances(const ThrustLimitTolerances& newTolerances) {
+    tolerances = newTolerances;
+    clear();
+  }
+
+  /// <summary>
+  /// Returns the limit of the given type (0-TO, 1-GA, 2-CLB, 3-MCT) from the cache, or computes it with
+  /// compute(type, altitude, ambientTemp, ambientPressure, flexTemp, ac, nacelle, wing) if an input changed.
+  /// </summary>
+  template <typename Compute>
+  double get(int type,
+             double altitude,
+             double ambientTemp,
+             double ambientPressure,
+             double flexTemp,
+             double ac,
+             double nacelle,
+             double wing,
+             Compute compute) {
+    Key key{band(altitude, tolerances.altitude),
+            band(ambientTemp, tolerances.temperature),
+            band(ambientPressure, tolerances.pressure),
+            flexTemp,
+            ac,
+            nacelle,
+            wing};
+    Entry& entry = entries[type * 2 + (flexTemp > 0 ? 1 : 0)];
+    if (entry.isValid && entry.key == key) {
+      hits++;
+      return entry.limit;
+    }
+
+    misses++;
+    entry = {key, compute(type, altitude, ambientTemp, ambientPressure, flexTemp, ac, nacelle, wing), true};
+    return entry.limit;
+  }
+
+  void clear() { entries = {}; }
+
+  uint64_t getHits() const { return hits; }
+  uint64_t getMisses() const { return misses; }
+  void resetCounters() { hits = misses = 0; }
+
+ private:
+  struct Key {
+    double altitudeBand;
+    double temperatureBand;
+    double pressureBand;
+    double flexTemp;
+    double ac;
+    double nacelle;
+    double wing;
+
+    bool operator==(const Key&) const = default;
+  };
+
+  struct Entry {
+    Key key;
+    double limit;
+    bool isValid;
+  };
+
+  ThrustLimitTolerances tolerances;
+  std::array<Entry, 2 * LIMIT_TYPES> entries{};
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+
+  static double band(double value, double tolerance) { return tolerance > 0 ? std::floor(value / tolerance) : value; }
+};
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cmath>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// Per-frame snapshot of LVars. readAll() reads every input once at the start of the frame, get() and set() then only
+/// access the snapshot, and writeAll() publishes the values that differ from the ones last read or written.
+/// A value that was set is returned by get() for the rest of the frame.
+/// </summary>
+class LVarSnapshot {
+ public:
+  using Handle = size_t;
+
+  /// <summary>
+  /// Registers an LVar and reads its current value. Outputs are only written by the FADEC and are not read every frame.
+  /// </summary>
+  Handle add(const char* name, bool isInput = true) {
+    ID id = register_named_variable(name);
+    FLOAT64 value = get_named_variable_value(id);
+    ids.push_back(id);
+    values.push_back(value);
+    publishedValues.push_back(value);
+    if (isInput) {
+      inputs.push_back(ids.size() - 1);
+    }
+    return ids.size() - 1;
+  }
+
+  /// <summary>
+  /// Registers the engine LVars name:1 to name:indexCount, the value of index i is at handle + i - 1.
+  /// </summary>
+  Handle addIndexed(const char* name, int indexCount, bool isInput = true) {
+    Handle handle = ids.size();
+    for (int index = 1; index <= indexCount; index++) {
+      add((std::string(name) + ":" + std::to_string(index)).c_str(), isInput);
+    }
+    return handle;
+  }
+
+  FLOAT64 get(Handle handle) const { return values[handle]; }
+  void set(Handle handle, FLOAT64 value) { values[handle] = value; }
+
+  void readAll() {
+    for (Handle handle : inputs) {
+      values[handle] = publishedValues[handle] = get_named_variable_value(ids[handle]);
+    }
+  }
+
+  void writeAll() {
+    for (Handle handle = 0; handle < ids.size(); handle++) {
+      if (values[handle] != publishedValues[handle]) {
+        set_named_variable_value(ids[handle], values[handle]);
+        publishedValues[handle] = values[handle];
+      }
+    }
+  }
+
+ private:
+  std::vector<ID> ids;
+  std::vector<FLOAT64> values;
+  std::vector<FLOAT64> publishedValues;
+  std::vector<Handle> inputs;
+};
+
+/// <summary>
+/// Per-frame snapshot of aircraft SimVars, refreshed with readAll() at the start of the frame.
+/// </summary>
+class SimVarSnapshot {
+ public:
+  using Handle = size_t;
+
+  /// <summary>
+  /// Registers a SimVar and reads its current value. For engine SimVars the indices 1 to indexCount are registered and
+  /// the value of index i is at handle + i - 1.
+  /// </summary>
+  Handle add(ENUM variable, ENUM unit, SINT32 indexCount = 0) {
+    Handle handle = variables.size();
+    if (indexCount == 0) {
+      variables.push_back({variable, unit, 0});
+    }
+    for (SINT32 index = 1; index <= indexCount; index++) {
+      variables.push_back({variable, unit, index});
+    }
+    values.resize(variables.size());
+    for (Handle i = handle; i < variables.size(); i++) {
+      values[i] = read(variables[i]);
+    }
+    return handle;
+  }
+
+  FLOAT64 get(Handle handle) const { return values[handle]; }
+
+  void readAll() {
+    for (Handle handle = 0; handle < variables.size(); handle++) {
+      values[handle] = read(variables[handle]);
+    }
+  }
+
+ private:
+  struct Variable {
+    ENUM variable;
+    ENUM unit;
+    SINT32 index;
+  };
+
+  std::vector<Variable> variables;
+  std::vector<FLOAT64> values;
+
+  static FLOAT64 read(const Variable& variable) { return aircraft_varget(variable.variable, variable.unit, variable.index); }
+};
+
+/// <summary>
+/// Values of a SimConnect data definition of N doubles, e.g. the fuel tanks of the aircraft. setCurrent() takes the
+/// values of the sim object at the start of the frame and set() changes them during the frame. writeAll() publishes the
+/// values that were set and differ from the sim object, in one SimConnect call if all of them were set. Otherwise each
+/// is published with the data definition of its index, so the values that were not set are not written back with the
+/// ones read at the start of the frame.
+/// </summary>
+template <size_t N>
+class SimObjectDataSnapshot {
+ public:
+  using Values = std::array<double, N>;
+
+  /// <summary>
+  /// Only set(values) can be used, all values are always published together.
+  /// </summary>
+  explicit SimObjectDataSnapshot(SIMCONNECT_DATA_DEFINITION_ID definitionId)
+      : definitionId(definitionId), firstIndexDefinitionId(definitionId), hasIndexDefinitions(false) {
+    publishedValues.fill(NAN);
+  }
+
+  /// <summary>
+  /// The value of index i is also defined alone by the data definition firstIndexDefinitionId + i.
+  /// </summary>
+  SimObjectDataSnapshot(SIMCONNECT_DATA_DEFINITION_ID definitionId, SIMCONNECT_DATA_DEFINITION_ID firstIndexDefinitionId)
+      : definitionId(definitionId), firstIndexDefinitionId(firstIndexDefinitionId), hasIndexDefinitions(true) {
+    publishedValues.fill(NAN);
+  }
+
+  double get(size_t index) const { return values[index]; }
+
+  void set(size_t index, double value) {
+    values[index] = value;
+    isSet.set(index);
+  }
+
+  void set(const Values& newValues) {
+    values = newValues;
+    isSet.set();
+  }
+
+  /// <summary>
+  /// Values of the sim object at the start of the frame.
+  /// </summary>
+  void setCurrent(const Values& current) {
+    values = publishedValues = current;
+    isSet.reset();
+  }
+
+  /// <summary>
+  /// Forgets the values of the sim object when they are not read, e.g. because they are known to differ. The next
+  /// writeAll() publishes all values that are set.
+  /// </summary>
+  void invalidate() { publishedValues.fill(NAN); }
+
+  void writeAll(HANDLE simConnect) {
+    std::bitset<N> isChanged;
+    for (size_t index = 0; index < N; index++) {
+      isChanged[index] = isSet[index] && values[index] != publishedValues[index];
+    }
+    if (isChanged.any() && (isSet.all() || !hasIndexDefinitions)) {
+      SimConnect_SetDataOnSimObject(simConnect, definitionId, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(values), values.data());
+      publishedValues = values;
+    } else if (isChanged.any()) {
+      for (size_t index = 0; index < N; index++) {
+        if (isChanged[index]) {
+          SimConnect_SetDataOnSimObject(simConnect, firstIndexDefinitionId + index, SIMCONNECT_OBJECT_ID_USER, 0, 0, sizeof(double),
+                                        &values[index]);
+          publishedValues[index] = values[index];
+        }
+      }
+    }
+    isSet.reset();
+  }
+
+ private:
+  SIMCONNECT_DATA_DEFINITION_ID definitionId;
+  SIMCONNECT_DATA_DEFINITION_ID firstIndexDefinitionId;
+  bool hasIndexDefinitions;
+  Values values{};
+  Values publishedValues;
+  std::bitset<N> isSet;
+};
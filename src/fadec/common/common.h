@@ -1,14 +1,16 @@
 #pragma once
 
+#include "FastMath.h"
+
 class SimVars;
 
-HANDLE hSimConnect;
+inline HANDLE hSimConnect;
 
 /// <summary>
 /// Interpolation function being used by MSFS for the engine tables
 /// </summary>
 /// <returns>Interpolated 'y' for a given 'x'.</returns>
-double interpolate(double x, double x0, double x1, double y0, double y1) {
+inline double interpolate(double x, double x0, double x1, double y0, double y1) {
   double y = 0;
 
   if (x0 == x1) {
@@ -23,7 +25,7 @@ double interpolate(double x, double x0, double x1, double y0, double y1) {
 /// <summary>
 /// Custom POW function
 /// </summary>
-double powFBW(double base, size_t exponent) {
+inline double powFBW(double base, size_t exponent) {
   double power = 1.0;
 
   while (exponent > 0) {
@@ -35,17 +37,10 @@ double powFBW(double base, size_t exponent) {
 }
 
 /// <summary>
-/// Custom EXP function
+/// Custom EXP function for the decay of the engine parameters (see FastMath.h)
 /// </summary>
-double expFBW(double x) {
-  int n = 8;
-  x = 1.0 + x / 256.0;
-
-  while (n > 0) {
-    x *= x;
-    --n;
-  }
-  return x;
+inline double expFBW(double x) {
+  return FastMath::expDecay(x);
 }
 
 /// <summary>
@@ -69,7 +64,7 @@ class EngineRatios {
   }
 
   FLOAT64 delta2(double mach, double ambientPressure) {
-    double d2 = this->delta(ambientPressure) * pow((1 + 0.2 * powFBW(mach, 2)), 3.5);
+    double d2 = this->delta(ambientPressure) * FastMath::powHalfInteger(1 + 0.2 * powFBW(mach, 2), 3);
     return d2;
   }
 };
@@ -90,7 +85,7 @@ std::string to_string_with_zero_padding(const T& value, std::size_t total_length
 /// </summary>
 /// <param name="imbalanceCode">The imbalance coded word (2-bytes per parameter).</param>
 /// <param name="parameter">The engine parameter which is being imbalanced.</param>
-double imbalanceExtractor(double imbalanceCode, int parameter) {
+inline double imbalanceExtractor(double imbalanceCode, int parameter) {
   double reg = 0;
 
   parameter = 9 - parameter;
@@ -0,0 +1,23 @@
+@echo off
+
+:: go to current directory
+pushd %~dp0
+
+:: clean build directory
+rd /s /q build
+
+:: create build files
+cmake -B build
+
+:: build
+cmake --build build --config Release
+
+:: get current sha
+for /f %%i in ('git rev-parse --short HEAD') do set GIT_SHA=%%i
+
+:: copy result
+copy build\Release\fadecsim_a320.exe fadecsim_a320_%GIT_SHA%.exe
+copy build\Release\fadecsim_a380.exe fadecsim_a380_%GIT_SHA%.exe
+
+:: restore directory
+popd
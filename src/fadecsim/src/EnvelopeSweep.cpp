@@ -0,0 +1,325 @@
+#include "EnvelopeSweep.h"
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "MsfsTypes.h"
+#include "SimulatorStub.h"
+#include "fmt/include/fmt/core.h"
+
+// the FADEC of the aircraft this program is built for, this is the only translation unit that includes it
+#include "EngineControl.h"
+
+namespace {
+
+constexpr int ENGINE_COUNT = SimVars::ENGINE_COUNT;
+
+// fixed imbalance code (see EngineControl::generateEngineImbalance) instead of the random one, so that traces repeat
+constexpr double ENGINE_IMBALANCE = 110201505150790;
+
+// the FADEC publishes its idle values, these are used when it does not
+constexpr double DEFAULT_IDLE_N1 = 19.5;
+constexpr double DEFAULT_IDLE_N2 = 68.2;
+
+// envelope of the sweep and the sequence flown at every point
+constexpr std::array<double, 5> ALTITUDES_FT = {0, 10000, 20000, 30000, 39000};
+constexpr std::array<double, 3> MACHS = {0, 0.4, 0.78};
+constexpr std::array<double, 3> ISA_DEVIATIONS_C = {-15, 0, 15};
+constexpr std::array<double, 5> THROTTLES = {0, 0.25, 0.5, 0.75, 1};
+constexpr double START_DURATION = 60;
+constexpr double THROTTLE_DURATION = 15;
+constexpr double SHUTDOWN_DURATION = 60;
+
+struct Atmosphere {
+  double temperatureC;
+  double standardTemperatureC;
+  double pressureMb;
+};
+
+// ISA temperature and pressure at the given pressure altitude, up to 65000 ft
+Atmosphere atmosphereAt(double altitudeFt, double isaDeviationC) {
+  const double tropopauseFt = 36089;
+  double standardTemperatureC = 15 - 0.0019812 * std::min(altitudeFt, tropopauseFt);
+  double pressureMb = altitudeFt <= tropopauseFt ? 1013.25 * std::pow(1 - 6.8756e-6 * altitudeFt, 5.2559)
+                                                 : 226.32 * std::exp(-(altitudeFt - tropopauseFt) / 20806);
+  return {standardTemperatureC + isaDeviationC, standardTemperatureC, pressureMb};
+}
+
+// Engine model of the simulator as far as the FADEC sees it: the starter motors N2 up to idle, a running engine
+// follows the throttle between idle and maximum N1 and an engine without starter runs down.
+class SimEngine {
+ public:
+  void update(int index, double throttle, double theta2, double deltaTime) {
+    double idleN1 = idleValue("A32NX_ENGINE_IDLE_N1", DEFAULT_IDLE_N1);
+    double idleN2 = idleValue("A32NX_ENGINE_IDLE_N2", DEFAULT_IDLE_N2);
+    bool starter = SimulatorStub::getAircraftVariable("GENERAL ENG STARTER", index) == 1;
+    bool startSelected = SimulatorStub::getAircraftVariable("TURB ENG IGNITION SWITCH EX1", index) == 2;
+
+    if (!starter) {
+      running = false;
+      n1 *= std::exp(-deltaTime / RUNDOWN_TIME);
+      n2 *= std::exp(-deltaTime / RUNDOWN_TIME);
+      if (n2 < 0.01) {
+        n1 = 0;
+        n2 = 0;
+      }
+    } else if (!running && startSelected) {
+      n2 = std::min(idleN2, n2 + STARTER_RATE * deltaTime);
+      n1 = n2 * idleN1 / idleN2;
+      running = n2 >= idleN2;
+    } else if (running) {
+      double targetN1 = idleN1 + throttle * (MAX_N1 - idleN1);
+      n1 += (targetN1 - n1) * (1 - std::exp(-deltaTime / SPOOL_TIME));
+      n2 = idleN2 + (n1 - idleN1) * (MAX_N2 - idleN2) / (MAX_N1 - idleN1);
+    }
+
+    SimulatorStub::setAircraftVariable("TURB ENG N1", index, n1);
+    SimulatorStub::setAircraftVariable("TURB ENG N2", index, n2);
+    SimulatorStub::setAircraftVariable("TURB ENG CORRECTED N1", index, n1 / std::sqrt(theta2));
+    SimulatorStub::setAircraftVariable("TURB ENG CORRECTED N2", index, n2 / std::sqrt(theta2));
+    SimulatorStub::setAircraftVariable("TURB ENG JET THRUST", index, running ? MAX_THRUST * n1 / MAX_N1 : 0);
+    SimulatorStub::setAircraftVariable("GENERAL ENG COMBUSTION", index, running ? 1 : 0);
+  }
+
+ private:
+  static constexpr double STARTER_RATE = 2.5;  // %/s
+  static constexpr double SPOOL_TIME = 2.5;    // s
+  static constexpr double RUNDOWN_TIME = 8;    // s
+  static constexpr double MAX_N1 = 100;
+  static constexpr double MAX_N2 = 100;
+  static constexpr double MAX_THRUST = 27000;  // lbs
+
+  double n1 = 0;
+  double n2 = 0;
+  bool running = false;
+
+  static double idleValue(const std::string& name, double defaultValue) {
+    double value = SimulatorStub::getNamedVariable(name);
+    return value > 0 ? value : defaultValue;
+  }
+};
+
+class Sweep {
+ public:
+  explicit Sweep(std::ofstream& trace) : trace(trace) {}
+
+  void initialize() {
+    SimulatorStub::reset();
+    SimulatorStub::setAircraftVariable("FUEL WEIGHT PER GALLON", 0, 6.7);
+    for (const char* tank : {"LEFT MAIN", "RIGHT MAIN", "LEFT AUX", "RIGHT AUX", "CENTER"}) {
+      SimulatorStub::setAircraftVariable(fmt::format("FUEL TANK {} QUANTITY", tank), 0, 1000);
+      SimulatorStub::setAircraftVariable(fmt::format("FUEL TANK {} CAPACITY", tank), 0, 2000);
+    }
+    setAmbient(0, 0, 0);
+
+    EngineControlInstance.initialize("FADECSIM");
+    SimulatorStub::setNamedVariable("A32NX_ENGINE_IMBALANCE", ENGINE_IMBALANCE);
+
+    trace << "time,altitude,mach,oat,throttle";
+    for (int engine = 1; engine <= ENGINE_COUNT; engine++) {
+      trace << fmt::format(",state{0},n1_{0},n2_{0},egt{0},ff{0}", engine);
+    }
+    trace << "\n";
+  }
+
+  void run(double sampleTime) {
+    for (double altitude : ALTITUDES_FT) {
+      for (double mach : MACHS) {
+        for (double isaDeviation : ISA_DEVIATIONS_C) {
+          setAmbient(altitude, mach, isaDeviation);
+
+          // start all engines from whatever state the previous point left them in
+          setEngineSwitches(1, 2);
+          runFor(START_DURATION, 0, sampleTime);
+          setEngineSwitches(1, 1);
+
+          for (double throttle : THROTTLES) {
+            runFor(THROTTLE_DURATION, throttle, sampleTime);
+          }
+
+          setEngineSwitches(0, 1);
+          runFor(SHUTDOWN_DURATION, 0, sampleTime);
+        }
+      }
+    }
+  }
+
+  void printTiming() const {
+    double microseconds = std::chrono::duration<double, std::micro>(updateTime).count();
+    fmt::print("{} FADEC: {} updates over {:.0f} s simulated, {:.3f} us and {:.2f} SimConnect writes per update\n", FADECSIM_AIRCRAFT,
+               updates, simulationTime, microseconds / updates, static_cast<double>(SimulatorStub::getSimObjectDataWriteCount()) / updates);
+    fmt::print("{} FADEC: thrust limit cache {} hits, {} misses\n", FADECSIM_AIRCRAFT, thrustLimitCache.getHits(),
+               thrustLimitCache.getMisses());
+  }
+
+ private:
+  std::ofstream& trace;
+  std::array<SimEngine, ENGINE_COUNT> engines;
+  std::chrono::steady_clock::duration updateTime{};
+  long updates = 0;
+  double simulationTime = 0;
+  double nextTraceTime = 0;
+  double altitude = 0;
+  double mach = 0;
+  double theta2 = 1;
+
+  void setAmbient(double altitudeFt, double machNumber, double isaDeviation) {
+    Atmosphere atmosphere = atmosphereAt(altitudeFt, isaDeviation);
+    altitude = altitudeFt;
+    mach = machNumber;
+    theta2 = (atmosphere.temperatureC + 273.15) / 288.15 * (1 + 0.2 * mach * mach);
+
+    SimulatorStub::setAircraftVariable("PRESSURE ALTITUDE", 0, altitudeFt);
+    SimulatorStub::setAircraftVariable("PLANE ALTITUDE", 0, altitudeFt);
+    SimulatorStub::setAircraftVariable("PLANE ALT ABOVE GROUND", 0, altitudeFt);
+    SimulatorStub::setAircraftVariable("AIRSPEED MACH", 0, machNumber);
+    SimulatorStub::setAircraftVariable("AMBIENT TEMPERATURE", 0, atmosphere.temperatureC);
+    SimulatorStub::setAircraftVariable("STANDARD ATM TEMPERATURE", 0, atmosphere.standardTemperatureC);
+    SimulatorStub::setAircraftVariable("AMBIENT PRESSURE", 0, atmosphere.pressureMb);
+    SimulatorStub::setAircraftVariable("SIM ON GROUND", 0, altitudeFt == 0 && machNumber == 0 ? 1 : 0);
+  }
+
+  void setEngineSwitches(double starter, double igniter) {
+    for (int engine = 1; engine <= ENGINE_COUNT; engine++) {
+      SimulatorStub::setAircraftVariable("GENERAL ENG STARTER", engine, starter);
+      SimulatorStub::setAircraftVariable("TURB ENG IGNITION SWITCH EX1", engine, igniter);
+    }
+  }
+
+  void runFor(double duration, double throttle, double sampleTime) {
+    double endTime = simulationTime + duration;
+    while (simulationTime < endTime - sampleTime / 2) {
+      for (int engine = 1; engine <= ENGINE_COUNT; engine++) {
+        engines[engine - 1].update(engine, throttle, theta2, sampleTime);
+      }
+
+      // the animation time only grows, so that the pause detection of the FADEC never triggers
+      simulationTime += sampleTime;
+      SimulatorStub::setAircraftVariable("ANIMATION DELTA TIME", 0, simulationTime);
+
+      auto startTime = std::chrono::steady_clock::now();
+      EngineControlInstance.update(sampleTime, simulationTime);
+      updateTime += std::chrono::steady_clock::now() - startTime;
+      updates++;
+
+      if (simulationTime >= nextTraceTime - sampleTime / 2) {
+        writeTrace(throttle);
+        nextTraceTime += 1;
+      }
+    }
+  }
+
+  void writeTrace(double throttle) {
+    trace << fmt::format("{:.1f},{:.0f},{:.2f},{:.2f},{:.2f}", simulationTime, altitude, mach,
+                         SimulatorStub::getAircraftVariable("AMBIENT TEMPERATURE", 0), throttle);
+    for (int engine = 1; engine <= ENGINE_COUNT; engine++) {
+      trace << fmt::format(",{:.0f},{:.4f},{:.4f},{:.3f},{:.3f}", engineVariable("A32NX_ENGINE_STATE", engine),
+                           engineVariable("A32NX_ENGINE_N1", engine), engineVariable("A32NX_ENGINE_N2", engine),
+                           engineVariable("A32NX_ENGINE_EGT", engine), engineVariable("A32NX_ENGINE_FF", engine));
+    }
+    trace << "\n";
+  }
+
+  static double engineVariable(const char* name, int engine) {
+    return SimulatorStub::getNamedVariable(fmt::format("{}:{}", name, engine));
+  }
+};
+
+std::vector<std::string> splitColumns(const std::string& line) {
+  std::vector<std::string> columns;
+  std::stringstream stream(line);
+  std::string column;
+  while (std::getline(stream, column, ',')) {
+    columns.push_back(column);
+  }
+  return columns;
+}
+
+}  // namespace
+
+bool runEnvelopeSweep(const std::string& traceFilePath, double sampleTime) {
+  std::ofstream trace(traceFilePath);
+  if (!trace) {
+    fmt::print("Failed to open trace file {}\n", traceFilePath);
+    return false;
+  }
+
+  Sweep sweep(trace);
+  sweep.initialize();
+  sweep.run(sampleTime);
+  sweep.printTiming();
+
+  trace.close();
+  if (!trace) {
+    fmt::print("Failed to write trace file {}\n", traceFilePath);
+    return false;
+  }
+  return true;
+}
+
+bool compareTraces(const std::string& traceFilePath, const std::string& goldenFilePath, double tolerance) {
+  std::ifstream trace(traceFilePath);
+  std::ifstream golden(goldenFilePath);
+  if (!trace || !golden) {
+    fmt::print("Failed to open {}\n", !trace ? traceFilePath : goldenFilePath);
+    return false;
+  }
+
+  std::string traceLine;
+  std::string goldenLine;
+  std::getline(trace, traceLine);
+  std::getline(golden, goldenLine);
+  std::vector<std::string> names = splitColumns(goldenLine);
+  if (splitColumns(traceLine) != names) {
+    fmt::print("The columns of the trace do not match the golden trace\n");
+    return false;
+  }
+
+  std::vector<double> maxDeviation(names.size(), 0);
+  std::vector<double> maxDeviationTime(names.size(), 0);
+  long rows = 0;
+  bool sameRows = true;
+  while (true) {
+    bool hasTraceLine = static_cast<bool>(std::getline(trace, traceLine));
+    bool hasGoldenLine = static_cast<bool>(std::getline(golden, goldenLine));
+    if (hasTraceLine != hasGoldenLine) {
+      sameRows = false;
+    }
+    if (!hasTraceLine || !hasGoldenLine) {
+      break;
+    }
+
+    std::vector<std::string> traceColumns = splitColumns(traceLine);
+    std::vector<std::string> goldenColumns = splitColumns(goldenLine);
+    if (traceColumns.size() != names.size() || goldenColumns.size() != names.size()) {
+      sameRows = false;
+      break;
+    }
+    for (size_t i = 0; i < names.size(); i++) {
+      double deviation = std::abs(std::stod(traceColumns[i]) - std::stod(goldenColumns[i]));
+      if (deviation > maxDeviation[i]) {
+        maxDeviation[i] = deviation;
+        maxDeviationTime[i] = std::stod(goldenColumns[0]);
+      }
+    }
+    rows++;
+  }
+
+  bool passed = sameRows;
+  for (size_t i = 0; i < names.size(); i++) {
+    bool withinTolerance = maxDeviation[i] <= tolerance;
+    passed = passed && withinTolerance;
+    fmt::print("{:<10} max deviation {:12.6f} at {:8.1f} s  {}\n", names[i], maxDeviation[i], maxDeviationTime[i],
+               withinTolerance ? "ok" : "EXCEEDED");
+  }
+  fmt::print("{} rows compared{}\n", rows, sameRows ? "" : ", the traces have different rows");
+  return passed;
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <string>
+
+// Runs the FADEC (EngineControl.h) against a simple engine model of the simulator. For every point of an envelope of
+// altitude, Mach and ISA deviation all engines are started, run through a series of throttle settings and shut down
+// again. The N1, N2, EGT and fuel flow of every engine are written to the trace file once per simulated second and the
+// time per FADEC update is reported. Returns false if the trace file could not be written.
+bool runEnvelopeSweep(const std::string& traceFilePath, double sampleTime);
+
+// Compares two trace files of runEnvelopeSweep() and prints the maximum deviation of every column. Returns true if
+// the files have the same rows and all deviations are within the tolerance.
+bool compareTraces(const std::string& traceFilePath, const std::string& goldenFilePath, double tolerance);
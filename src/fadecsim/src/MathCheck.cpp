@@ -0,0 +1,136 @@
+#include "MathCheck.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "FastMath.h"
+#include "fmt/include/fmt/core.h"
+
+namespace {
+
+using Function = double (*)(double);
+using ReferenceFunction = long double (*)(long double);
+using LaneFunction = std::array<double, 4> (*)(const std::array<double, 4>&);
+
+struct Kernel {
+  const char* name;
+  // argument range of the engine model
+  double min;
+  double max;
+  // documented bound of the relative error
+  double errorBound;
+  ReferenceFunction reference;
+  Function libm;
+  // the code the FADEC used before the kernel
+  Function previous;
+  Function fast;
+  LaneFunction fastLanes;
+};
+
+// exponent of the pressure ratio in delta2 and cas2mach
+constexpr double PRESSURE_EXPONENT = 3.5;
+
+// expFBW before the FastMath kernels
+double previousExpFBW(double x) {
+  int n = 8;
+  x = 1.0 + x / 256.0;
+
+  while (n > 0) {
+    x *= x;
+    --n;
+  }
+  return x;
+}
+
+const Kernel kernels[] = {
+    {"exp decay", -1, 0, 3e-6, [](long double x) { return std::exp(x); }, [](double x) { return std::exp(x); }, previousExpFBW,
+     [](double x) { return FastMath::expDecay(x); }, [](const std::array<double, 4>& x) { return FastMath::expDecay(x); }},
+    {"exp full", -700, 700, 2e-16, [](long double x) { return std::exp(x); }, [](double x) { return std::exp(x); }, previousExpFBW,
+     [](double x) { return FastMath::exp(x); }, [](const std::array<double, 4>& x) { return FastMath::exp(x); }},
+    {"pow 3.5", 1, 1.2, 4.8e-16, [](long double x) { return std::pow(x, static_cast<long double>(PRESSURE_EXPONENT)); },
+     [](double x) { return std::pow(x, PRESSURE_EXPONENT); }, [](double x) { return std::pow(x, PRESSURE_EXPONENT); },
+     [](double x) { return FastMath::powHalfInteger(x, 3); },
+     [](const std::array<double, 4>& x) { return FastMath::powHalfInteger(x, 3); }},
+    {"sqrt", 0.5, 1.5, 1.2e-16, [](long double x) { return std::sqrt(x); }, [](double x) { return std::sqrt(x); },
+     [](double x) { return std::sqrt(x); }, [](double x) { return FastMath::sqrt(x); },
+     [](const std::array<double, 4>& x) { return FastMath::sqrt(x); }},
+};
+
+double relativeError(long double reference, double value) {
+  return static_cast<double>(std::abs((value - reference) / reference));
+}
+
+template <typename Evaluate>
+double timeEvaluations(const std::vector<double>& inputs, std::vector<double>& outputs, Evaluate evaluate) {
+  auto start = std::chrono::steady_clock::now();
+  evaluate(inputs, outputs);
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() * 1e9 / inputs.size();
+}
+
+bool checkKernel(const Kernel& kernel, int evaluations) {
+  // a multiple of 4 evaluations, so that the lanes evaluate the same inputs
+  std::size_t count = std::max<std::size_t>(4, static_cast<std::size_t>(evaluations) / 4 * 4);
+  std::vector<double> inputs(count);
+  for (std::size_t i = 0; i < count; i++) {
+    inputs[i] = kernel.min + (kernel.max - kernel.min) * static_cast<double>(i) / (count - 1);
+  }
+
+  std::vector<double> libmOutputs(count);
+  std::vector<double> previousOutputs(count);
+  std::vector<double> fastOutputs(count);
+  std::vector<double> laneOutputs(count);
+  double libmTime = timeEvaluations(inputs, libmOutputs, [&](const std::vector<double>& x, std::vector<double>& y) {
+    for (std::size_t i = 0; i < x.size(); i++) {
+      y[i] = kernel.libm(x[i]);
+    }
+  });
+  double previousTime = timeEvaluations(inputs, previousOutputs, [&](const std::vector<double>& x, std::vector<double>& y) {
+    for (std::size_t i = 0; i < x.size(); i++) {
+      y[i] = kernel.previous(x[i]);
+    }
+  });
+  double fastTime = timeEvaluations(inputs, fastOutputs, [&](const std::vector<double>& x, std::vector<double>& y) {
+    for (std::size_t i = 0; i < x.size(); i++) {
+      y[i] = kernel.fast(x[i]);
+    }
+  });
+  double laneTime = timeEvaluations(inputs, laneOutputs, [&](const std::vector<double>& x, std::vector<double>& y) {
+    for (std::size_t i = 0; i < x.size(); i += 4) {
+      std::array<double, 4> lanes;
+      std::copy_n(&x[i], 4, lanes.begin());
+      lanes = kernel.fastLanes(lanes);
+      std::copy_n(lanes.begin(), 4, &y[i]);
+    }
+  });
+
+  double libmError = 0;
+  double previousError = 0;
+  double fastError = 0;
+  for (std::size_t i = 0; i < count; i++) {
+    long double reference = kernel.reference(inputs[i]);
+    libmError = std::max(libmError, relativeError(reference, libmOutputs[i]));
+    previousError = std::max(previousError, relativeError(reference, previousOutputs[i]));
+    fastError = std::max(fastError, relativeError(reference, fastOutputs[i]));
+  }
+
+  bool passed = fastError <= kernel.errorBound && laneOutputs == fastOutputs;
+  fmt::print("{:<11} [{:g}, {:g}]  {}  max relative error {:.2e} (libm {:.2e}, previous {:.2e}, bound {:.1e})  {:.2f} ns/evaluation "
+             "(libm {:.2f}, previous {:.2f}, 4 engines {:.2f})\n",
+             kernel.name, kernel.min, kernel.max, passed ? "passed" : "FAILED", fastError, libmError, previousError, kernel.errorBound,
+             fastTime, libmTime, previousTime, laneTime);
+  return passed;
+}
+
+}  // namespace
+
+bool runMathCheck(int evaluations) {
+  bool passed = true;
+  for (const Kernel& kernel : kernels) {
+    passed = checkKernel(kernel, evaluations) && passed;
+  }
+  return passed;
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+// Evaluates the kernels of the FADEC numerics library (FastMath.h) over the argument ranges the engine model uses,
+// checks their relative error against a long double reference and reports the time per evaluation compared to libm,
+// for a single engine and for 4 engines at once. Returns true if all kernels are within their documented error bounds.
+bool runMathCheck(int evaluations);
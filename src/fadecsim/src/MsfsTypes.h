@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+
+// Types and functions of the MSFS SDK that the FADEC headers use, for building them on the host. The functions are
+// implemented in memory by SimulatorStub.cpp.
+using HANDLE = void*;
+using HRESULT = long;
+using DWORD = unsigned long;
+using ID = int;
+using ENUM = unsigned int;
+using SINT32 = int32_t;
+using FLOAT64 = double;
+using PCSTRINGZ = const char*;
+using SIMCONNECT_DATA_DEFINITION_ID = DWORD;
+
+#define SIMCONNECT_OBJECT_ID_USER 0
+
+ID register_named_variable(PCSTRINGZ name);
+FLOAT64 get_named_variable_value(ID id);
+void set_named_variable_value(ID id, FLOAT64 value);
+
+ENUM get_aircraft_var_enum(PCSTRINGZ name);
+ENUM get_units_enum(PCSTRINGZ name);
+FLOAT64 aircraft_varget(ENUM variable, ENUM units, SINT32 index);
+
+HRESULT SimConnect_SetDataOnSimObject(HANDLE hSimConnect,
+                                      SIMCONNECT_DATA_DEFINITION_ID defineId,
+                                      DWORD objectId,
+                                      DWORD flags,
+                                      DWORD arrayCount,
+                                      DWORD unitSize,
+                                      void* data);
+
+// the FADEC headers call min and max without qualification and with mixed argument types
+template <typename A, typename B>
+constexpr auto max(A a, B b) {
+  return a > b ? a : b;
+}
+
+template <typename A, typename B>
+constexpr auto min(A a, B b) {
+  return a < b ? a : b;
+}
@@ -0,0 +1,228 @@
+#include "PolynomialCheck.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "MsfsTypes.h"
+#include "RegPolynomials.h"
+#include "fmt/include/fmt/core.h"
+
+namespace {
+
+// The start-up and oil polynomials as they were before the Horner scheme, with a power per term.
+struct ReferencePolynomial {
+  static double startN2Normal(double normalN2) {
+    double c_N2[16] = {4.03649879e+00,  -9.41981960e-01, 1.98426614e-01,  -2.11907840e-02, 1.00777507e-03,  -1.57319166e-06,
+                       -2.15034888e-06, 1.08288379e-07,  -2.48504632e-09, 2.52307089e-11,  -2.06869243e-14, 8.99045761e-16,
+                       -9.94853959e-17, 1.85366499e-18,  -1.44869928e-20, 4.31033031e-23};
+
+    return c_N2[0] + (c_N2[1] * normalN2) + (c_N2[2] * powFBW(normalN2, 2)) + (c_N2[3] * powFBW(normalN2, 3)) +
+           (c_N2[4] * powFBW(normalN2, 4)) + (c_N2[5] * powFBW(normalN2, 5)) + (c_N2[6] * powFBW(normalN2, 6)) +
+           (c_N2[7] * powFBW(normalN2, 7)) + (c_N2[8] * powFBW(normalN2, 8)) + (c_N2[9] * powFBW(normalN2, 9)) +
+           (c_N2[10] * powFBW(normalN2, 10)) + (c_N2[11] * powFBW(normalN2, 11)) + (c_N2[12] * powFBW(normalN2, 12)) +
+           (c_N2[13] * powFBW(normalN2, 13)) + (c_N2[14] * powFBW(normalN2, 14)) + (c_N2[15] * powFBW(normalN2, 15));
+  }
+
+  static double startN2(double n2, double preN2, double idleN2) {
+    double outN2 = startN2Normal(n2 * 68.2 / idleN2) * n2;
+
+    if (outN2 < preN2) {
+      outN2 = preN2 + 0.002;
+    }
+    if (outN2 >= idleN2 + 0.1) {
+      outN2 = idleN2 + 0.05;
+    }
+
+    return outN2;
+  }
+
+  static double startN1(double fbwN2, double idleN2, double idleN1) {
+    double normalN2 = fbwN2 / idleN2;
+    double c_N1[9] = {-2.2812156e-12, -5.9830374e+01, 7.0629094e+02,  -3.4580361e+03, 9.1428923e+03,
+                      -1.4097740e+04, 1.2704110e+04,  -6.2099935e+03, 1.2733071e+03};
+
+    double normalN1pre = (-2.4698087 * powFBW(normalN2, 3)) + (0.9662026 * powFBW(normalN2, 2)) + (0.0701367 * normalN2);
+
+    double normalN1post = c_N1[0] + (c_N1[1] * normalN2) + (c_N1[2] * powFBW(normalN2, 2)) + (c_N1[3] * powFBW(normalN2, 3)) +
+                          (c_N1[4] * powFBW(normalN2, 4)) + (c_N1[5] * powFBW(normalN2, 5)) + (c_N1[6] * powFBW(normalN2, 6)) +
+                          (c_N1[7] * powFBW(normalN2, 7)) + (c_N1[8] * powFBW(normalN2, 8));
+
+    return std::max(normalN1pre, normalN1post) * idleN1;
+  }
+
+  static double startFF(double fbwN2, double idleN2, double idleFF) {
+    double normalFF = 0;
+    double normalN2 = fbwN2 / idleN2;
+
+    if (normalN2 > 0.37) {
+      double c_FF[9] = {3.1110282e-12, 1.0804331e+02,  -1.3972629e+03, 7.4874131e+03, -2.1511983e+04,
+                        3.5957757e+04, -3.5093994e+04, 1.8573033e+04,  -4.1220062e+03};
+
+      normalFF = c_FF[0] + (c_FF[1] * normalN2) + (c_FF[2] * powFBW(normalN2, 2)) + (c_FF[3] * powFBW(normalN2, 3)) +
+                 (c_FF[4] * powFBW(normalN2, 4)) + (c_FF[5] * powFBW(normalN2, 5)) + (c_FF[6] * powFBW(normalN2, 6)) +
+                 (c_FF[7] * powFBW(normalN2, 7)) + (c_FF[8] * powFBW(normalN2, 8));
+    }
+
+    return std::max(normalFF, 0.0) * idleFF;
+  }
+
+  static double startEGT(double fbwN2, double idleN2, double ambientTemp, double idleEGT) {
+    double normalEGT = 0;
+    double normalN2 = fbwN2 / idleN2;
+
+    if (normalN2 < 0.17) {
+      normalEGT = 0;
+    } else if (normalN2 <= 0.4) {
+      normalEGT = (0.04783 * normalN2) - 0.00813;
+    } else {
+      double c_EGT[9] = {-6.8725167e+02, 7.7548864e+03,  -3.7507098e+04, 1.0147016e+05, -1.6779273e+05,
+                         1.7357157e+05,  -1.0960924e+05, 3.8591956e+04,  -5.7912600e+03};
+
+      normalEGT = c_EGT[0] + (c_EGT[1] * normalN2) + (c_EGT[2] * powFBW(normalN2, 2)) + (c_EGT[3] * powFBW(normalN2, 3)) +
+                  (c_EGT[4] * powFBW(normalN2, 4)) + (c_EGT[5] * powFBW(normalN2, 5)) + (c_EGT[6] * powFBW(normalN2, 6)) +
+                  (c_EGT[7] * powFBW(normalN2, 7)) + (c_EGT[8] * powFBW(normalN2, 8));
+    }
+
+    return (normalEGT * (idleEGT - (ambientTemp))) + (ambientTemp);
+  }
+
+  static double oilGulpPct(double thrust) {
+    double c_OilGulp[3] = {20.1968848, -1.2270302e-4, 1.78442e-8};
+    return (c_OilGulp[0] + (c_OilGulp[1] * thrust) + (c_OilGulp[2] * powFBW(thrust, 2))) / 100;
+  }
+
+  static double oilPressure(double simN2) {
+    double c_OilPress[3] = {-0.88921, 0.23711, 0.00682};
+    return c_OilPress[0] + (c_OilPress[1] * simN2) + (c_OilPress[2] * powFBW(simN2, 2));
+  }
+};
+
+// maximum difference to the reference in the unit of the output (%, kg/h, degrees C or psi)
+const double tolerance = 1e-6;
+
+const double idleN2s[] = {60.0, 68.2, 72.0};
+const double ambientTemps[] = {-40.0, 15.0, 45.0};
+const double idleN1 = 19.0;
+const double idleFF = 300.0;
+const double idleEGT = 400.0;
+
+struct ErrorReport {
+  const char* name;
+  double maxError = 0;
+
+  void add(double reference, double value) { maxError = std::max(maxError, std::abs(reference - value)); }
+
+  bool print() const {
+    bool passed = maxError < tolerance;
+    fmt::print("{:<12} {}  max error {:g}\n", name, passed ? "passed" : "FAILED", maxError);
+    return passed;
+  }
+};
+
+bool checkAccuracy(int evaluations) {
+  Polynomial polynomial;
+  ErrorReport startN2{"startN2"};
+  ErrorReport startN1{"startN1"};
+  ErrorReport startFF{"startFF"};
+  ErrorReport startEGT{"startEGT"};
+  ErrorReport oilGulpPct{"oilGulpPct"};
+  ErrorReport oilPressure{"oilPressure"};
+
+  for (int i = 0; i <= evaluations; i++) {
+    double fraction = static_cast<double>(i) / evaluations;
+
+    for (double idleN2 : idleN2s) {
+      double n2 = fraction * idleN2;
+      startN2.add(ReferencePolynomial::startN2(n2, 0, idleN2), polynomial.startN2(n2, 0, idleN2));
+      startN1.add(ReferencePolynomial::startN1(n2, idleN2, idleN1), polynomial.startN1(n2, idleN2, idleN1));
+      startFF.add(ReferencePolynomial::startFF(n2, idleN2, idleFF), polynomial.startFF(n2, idleN2, idleFF));
+      for (double ambientTemp : ambientTemps) {
+        startEGT.add(ReferencePolynomial::startEGT(n2, idleN2, ambientTemp, idleEGT),
+                     polynomial.startEGT(n2, idleN2, ambientTemp, idleEGT));
+      }
+    }
+
+    double thrust = fraction * 35000;
+    oilGulpPct.add(ReferencePolynomial::oilGulpPct(thrust), polynomial.oilGulpPct(thrust));
+    double simN2 = fraction * 110;
+    oilPressure.add(ReferencePolynomial::oilPressure(simN2), polynomial.oilPressure(simN2));
+  }
+
+  bool passed = startN2.print();
+  passed = startN1.print() && passed;
+  passed = startFF.print() && passed;
+  passed = startEGT.print() && passed;
+  passed = oilGulpPct.print() && passed;
+  passed = oilPressure.print() && passed;
+  return passed;
+}
+
+// Evaluates the start N2 polynomial for all inputs with LANES engines at once and checks that every lane matches the
+// scalar Horner scheme exactly.
+template <std::size_t LANES>
+bool benchmarkLanes(const std::vector<double>& inputs, const std::vector<double>& scalarOutputs, double powerSumTime) {
+  std::vector<double> outputs(inputs.size());
+
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i + LANES <= inputs.size(); i += LANES) {
+    std::array<double, LANES> x;
+    std::copy_n(&inputs[i], LANES, x.begin());
+    std::array<double, LANES> y = Polynomial::startN2Polynomial.evaluate(x);
+    std::copy_n(y.begin(), LANES, &outputs[i]);
+  }
+  double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  bool passed = outputs == scalarOutputs;
+  fmt::print("horner {} engines:  {}  {:.2f} ns/evaluation  speedup {:.1f}x\n", LANES, passed ? "passed" : "FAILED",
+             time * 1e9 / inputs.size(), powerSumTime / time);
+  return passed;
+}
+
+bool benchmark(int evaluations) {
+  // a multiple of 4 evaluations, so that all engine counts evaluate the same inputs
+  std::size_t count = std::max<std::size_t>(4, static_cast<std::size_t>(evaluations) / 4 * 4);
+  std::vector<double> inputs(count);
+  for (std::size_t i = 0; i < count; i++) {
+    inputs[i] = 68.2 * static_cast<double>(i) / count;
+  }
+
+  std::vector<double> powerSumOutputs(count);
+  auto powerSumStart = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < count; i++) {
+    powerSumOutputs[i] = ReferencePolynomial::startN2Normal(inputs[i]);
+  }
+  double powerSumTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - powerSumStart).count();
+
+  std::vector<double> hornerOutputs(count);
+  auto hornerStart = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < count; i++) {
+    hornerOutputs[i] = Polynomial::startN2Polynomial.evaluate(inputs[i]);
+  }
+  double hornerTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - hornerStart).count();
+
+  double maxError = 0;
+  for (std::size_t i = 0; i < count; i++) {
+    maxError = std::max(maxError, std::abs(powerSumOutputs[i] - hornerOutputs[i]));
+  }
+
+  bool passed = maxError < tolerance;
+  fmt::print("power sum:         {:.2f} ns/evaluation\n", powerSumTime * 1e9 / count);
+  fmt::print("horner:            {}  max error {:g}  {:.2f} ns/evaluation  speedup {:.1f}x\n", passed ? "passed" : "FAILED",
+             maxError, hornerTime * 1e9 / count, powerSumTime / hornerTime);
+
+  passed = benchmarkLanes<2>(inputs, hornerOutputs, powerSumTime) && passed;
+  passed = benchmarkLanes<4>(inputs, hornerOutputs, powerSumTime) && passed;
+  return passed;
+}
+
+}  // namespace
+
+bool runPolynomialCheck(int evaluations) {
+  bool passed = checkAccuracy(evaluations);
+  passed = benchmark(evaluations) && passed;
+  return passed;
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+// Evaluates the regression polynomials of the FADEC (RegPolynomials.h) over the engine start and operating range, checks
+// them against the previous implementation with a power per term and reports the time per evaluation of the start N2
+// polynomial for the power sum, the Horner scheme and the Horner scheme for 2 and 4 engines at once.
+// Returns true if all results match.
+bool runPolynomialCheck(int evaluations);
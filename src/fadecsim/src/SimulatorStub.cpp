@@ -0,0 +1,115 @@
+#include "SimulatorStub.h"
+
+#include <array>
+#include <cstring>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// engine variables are indexed from 1, the aircraft variables without index use index 0
+constexpr int MAX_INDEX = 8;
+
+struct Variables {
+  std::unordered_map<std::string, ENUM> aircraftVariableIds;
+  std::vector<std::array<double, MAX_INDEX + 1>> aircraftVariables;
+
+  std::unordered_map<std::string, ID> namedVariableIds;
+  std::vector<double> namedVariables;
+
+  std::map<SIMCONNECT_DATA_DEFINITION_ID, std::vector<double>> simObjectData;
+  size_t simObjectDataWriteCount = 0;
+};
+
+Variables variables;
+
+ENUM aircraftVariableId(const std::string& name) {
+  auto [it, inserted] = variables.aircraftVariableIds.try_emplace(name, static_cast<ENUM>(variables.aircraftVariables.size()));
+  if (inserted) {
+    variables.aircraftVariables.push_back({});
+  }
+  return it->second;
+}
+
+ID namedVariableId(const std::string& name) {
+  auto [it, inserted] = variables.namedVariableIds.try_emplace(name, static_cast<ID>(variables.namedVariables.size()));
+  if (inserted) {
+    variables.namedVariables.push_back(0);
+  }
+  return it->second;
+}
+
+bool isValidIndex(int index) {
+  return index >= 0 && index <= MAX_INDEX;
+}
+
+}  // namespace
+
+namespace SimulatorStub {
+
+void reset() {
+  variables = Variables();
+}
+
+void setAircraftVariable(const std::string& name, int index, double value) {
+  if (isValidIndex(index)) {
+    variables.aircraftVariables[aircraftVariableId(name)][index] = value;
+  }
+}
+
+double getAircraftVariable(const std::string& name, int index) {
+  return isValidIndex(index) ? variables.aircraftVariables[aircraftVariableId(name)][index] : 0;
+}
+
+void setNamedVariable(const std::string& name, double value) {
+  variables.namedVariables[namedVariableId(name)] = value;
+}
+
+double getNamedVariable(const std::string& name) {
+  return variables.namedVariables[namedVariableId(name)];
+}
+
+double getSimObjectData(SIMCONNECT_DATA_DEFINITION_ID defineId, size_t index) {
+  auto it = variables.simObjectData.find(defineId);
+  return it != variables.simObjectData.end() && index < it->second.size() ? it->second[index] : 0;
+}
+
+size_t getSimObjectDataWriteCount() {
+  return variables.simObjectDataWriteCount;
+}
+
+}  // namespace SimulatorStub
+
+ID register_named_variable(PCSTRINGZ name) {
+  return namedVariableId(name);
+}
+
+FLOAT64 get_named_variable_value(ID id) {
+  return variables.namedVariables[id];
+}
+
+void set_named_variable_value(ID id, FLOAT64 value) {
+  variables.namedVariables[id] = value;
+}
+
+ENUM get_aircraft_var_enum(PCSTRINGZ name) {
+  return aircraftVariableId(name);
+}
+
+ENUM get_units_enum(PCSTRINGZ) {
+  return 0;
+}
+
+FLOAT64 aircraft_varget(ENUM variable, ENUM, SINT32 index) {
+  return isValidIndex(index) ? variables.aircraftVariables[variable][index] : 0;
+}
+
+HRESULT SimConnect_SetDataOnSimObject(HANDLE, SIMCONNECT_DATA_DEFINITION_ID defineId, DWORD, DWORD, DWORD, DWORD unitSize, void* data) {
+  // the FADEC data definitions hold doubles only
+  std::vector<double>& values = variables.simObjectData[defineId];
+  values.resize(unitSize / sizeof(double));
+  std::memcpy(values.data(), data, values.size() * sizeof(double));
+  variables.simObjectDataWriteCount++;
+  return 0;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "MsfsTypes.h"
+
+// In-memory stand-in for the simulator behind the MSFS gauge API and SimConnect. The harness sets the aircraft
+// variables the FADEC reads and reads back the local variables and SimConnect data the FADEC writes. Units are not
+// converted, every aircraft variable is stored in the unit the FADEC reads it with.
+namespace SimulatorStub {
+
+// Forgets all variables, e.g. before the FADEC is initialized again.
+void reset();
+
+void setAircraftVariable(const std::string& name, int index, double value);
+double getAircraftVariable(const std::string& name, int index);
+
+void setNamedVariable(const std::string& name, double value);
+double getNamedVariable(const std::string& name);
+
+// Returns the last value the FADEC set for the given SimConnect data definition and index within it, 0 if it never did.
+double getSimObjectData(SIMCONNECT_DATA_DEFINITION_ID defineId, size_t index = 0);
+
+// Number of SimConnect data writes since the last reset.
+size_t getSimObjectDataWriteCount();
+
+}  // namespace SimulatorStub
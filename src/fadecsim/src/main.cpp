@@ -0,0 +1,70 @@
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "EnvelopeSweep.h"
+#include "MathCheck.h"
+#include "PolynomialCheck.h"
+#include "commandline/CommandLine.hpp"
+#include "fmt/include/fmt/core.h"
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  int32_t polynomialEvaluations = 0;
+  int32_t mathEvaluations = 0;
+  std::string traceFilePath;
+  std::string goldenFilePath;
+  double sampleTime = 1.0 / 30.0;
+  double tolerance = 0.001;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args("Runs the " FADECSIM_AIRCRAFT " FADEC on the host");
+  args.addArgument({"-p", "--polynomial-check"}, &polynomialEvaluations,
+                   "Check the regression polynomials against the power sums for the given evaluations");
+  args.addArgument({"-m", "--math-check"}, &mathEvaluations, "Check the numerics kernels against libm for the given evaluations");
+  args.addArgument({"-s", "--sweep"}, &traceFilePath, "Sweep the engine envelope and write the N1, N2, EGT and FF trace to the given file");
+  args.addArgument({"-g", "--golden"}, &goldenFilePath, "Compare the trace of the sweep with the given golden trace");
+  args.addArgument({"-t", "--sample-time"}, &sampleTime, "Sample time of the sweep in seconds");
+  args.addArgument({"-e", "--tolerance"}, &tolerance, "Tolerance of the golden trace comparison");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (std::runtime_error const& e) {
+    fmt::print("{}\n", e.what());
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp || (polynomialEvaluations <= 0 && mathEvaluations <= 0 && traceFilePath.empty())) {
+    args.printHelp();
+    std::cout << std::endl;
+    return 0;
+  }
+
+  // check parameters
+  if (sampleTime <= 0 || tolerance < 0 || (!goldenFilePath.empty() && traceFilePath.empty())) {
+    fmt::print("Invalid parameters!\n");
+    return -1;
+  }
+
+  bool passed = true;
+  if (polynomialEvaluations > 0) {
+    passed = runPolynomialCheck(polynomialEvaluations) && passed;
+  }
+  if (mathEvaluations > 0) {
+    passed = runMathCheck(mathEvaluations) && passed;
+  }
+  if (!traceFilePath.empty()) {
+    if (!runEnvelopeSweep(traceFilePath, sampleTime)) {
+      return -1;
+    }
+    if (!goldenFilePath.empty()) {
+      passed = compareTraces(traceFilePath, goldenFilePath, tolerance) && passed;
+    }
+  }
+
+  return passed ? 0 : 2;
+}
@@ -96,6 +96,7 @@ clang++ \
   "${DIR}/src/utils/SRFlipFLop.cpp" \
   "${DIR}/src/utils/PulseNode.cpp" \
   "${DIR}/src/utils/HysteresisNode.cpp" \
+  "${DIR}/src/utils/ModelStepGate.cpp" \
   -I "${DIR}/src/model" \
   "${DIR}/src/model/AutopilotLaws_data.cpp" \
   "${DIR}/src/model/AutopilotLaws.cpp" \
@@ -131,6 +132,11 @@ clang++ \
   "${DIR}/src/Arinc429.cpp" \
   "${DIR}/src/Arinc429Utils.cpp" \
   "${COMMON_DIR}/src/LocalVariable.cpp" \
+  "${COMMON_DIR}/src/FrameProfiler.cpp" \
+  "${COMMON_DIR}/src/FrameScheduler.cpp" \
+  "${COMMON_DIR}/src/Arinc429BusDecoder.cpp" \
+  "${COMMON_DIR}/src/Arinc429BusRouter.cpp" \
+  "${COMMON_DIR}/src/SimulationRateGovernor.cpp" \
   "${COMMON_DIR}/src/InterpolatingLookupTable.cpp" \
   "${DIR}/src/SpoilersHandler.cpp" \
   "${COMMON_DIR}/src/ThrottleAxisMapping.cpp" \
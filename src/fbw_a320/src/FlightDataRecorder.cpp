@@ -47,24 +47,45 @@ void FlightDataRecorder::update(AutopilotStateMachineModelClass* autopilotStateM
     return;
   }
 
-  // do file management
-  manageFlightDataRecorderFiles();
-
-  // write data to file
-  fileStream->write((char*)(&autopilotStateMachine->getExternalOutputs().out), sizeof(autopilotStateMachine->getExternalOutputs().out));
-  fileStream->write((char*)(&autopilotLaws->getExternalOutputs().out.output), sizeof(autopilotLaws->getExternalOutputs().out.output));
-  fileStream->write((char*)(&autoThrust->getExternalOutputs().out), sizeof(autoThrust->getExternalOutputs().out));
-  fileStream->write((char*)(&engineData), sizeof(engineData));
-  fileStream->write((char*)(&additionalData), sizeof(additionalData));
+  // buffer the data, the compression is left to flush()
+  size_t previousSize = pendingFrames.size();
+  appendToPendingFrames(&autopilotStateMachine->getExternalOutputs().out, sizeof(autopilotStateMachine->getExternalOutputs().out));
+  appendToPendingFrames(&autopilotLaws->getExternalOutputs().out.output, sizeof(autopilotLaws->getExternalOutputs().out.output));
+  appendToPendingFrames(&autoThrust->getExternalOutputs().out, sizeof(autoThrust->getExternalOutputs().out));
+  appendToPendingFrames(&engineData, sizeof(engineData));
+  appendToPendingFrames(&additionalData, sizeof(additionalData));
+  frameSize = pendingFrames.size() - previousSize;
+}
+
+bool FlightDataRecorder::flush() {
+  for (size_t offset = 0; offset < pendingFrames.size(); offset += frameSize) {
+    // do file management
+    manageFlightDataRecorderFiles();
+
+    // write data to file
+    fileStream->write(pendingFrames.data() + offset, frameSize);
+  }
+
+  // the capacity is kept, so that buffering does not allocate after the first frames
+  pendingFrames.clear();
+
+  return true;
 }
 
 void FlightDataRecorder::terminate() {
+  flush();
+
   if (fileStream) {
     fileStream->close();
     fileStream.reset();
   }
 }
 
+void FlightDataRecorder::appendToPendingFrames(const void* data, size_t size) {
+  const char* bytes = static_cast<const char*>(data);
+  pendingFrames.insert(pendingFrames.end(), bytes, bytes + size);
+}
+
 void FlightDataRecorder::manageFlightDataRecorderFiles() {
   // increase sample counter
   sampleCounter++;
@@ -1,18 +1,228 @@
 #include <ini.h>
 #include <ini_type_conversion.h>
+#include <chrono>
 #include <cmath>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
 
 #include "Arinc429Utils.h"
 #include "FlyByWireInterface.h"
+#include "LocalVariableNames.h"
 #include "SimConnectData.h"
 
 using namespace mINI;
 
+namespace {
+// names of the local variables of the spoilers, one per spoiler
+constexpr auto LEFT_SPOILER_COMMANDED_POSITION_NAMES = indexedLocalVariableNames<5>("A32NX_LEFT_SPOILER_", "_COMMANDED_POSITION");
+constexpr auto RIGHT_SPOILER_COMMANDED_POSITION_NAMES = indexedLocalVariableNames<5>("A32NX_RIGHT_SPOILER_", "_COMMANDED_POSITION");
+constexpr auto LEFT_SPOILER_POSITION_NAMES = indexedLocalVariableNames<5>("A32NX_HYD_SPOILER_", "_LEFT_DEFLECTION");
+constexpr auto RIGHT_SPOILER_POSITION_NAMES = indexedLocalVariableNames<5>("A32NX_HYD_SPOILER_", "_RIGHT_DEFLECTION");
+constexpr auto LEFT_SPOILER_FAULT_NAMES = indexedLocalVariableNames<5>("A32NX_LEFT_SPLR_", "_SERVO_FAILED");
+constexpr auto RIGHT_SPOILER_FAULT_NAMES = indexedLocalVariableNames<5>("A32NX_RIGHT_SPLR_", "_SERVO_FAILED");
+
+// prefixes of the local variables of the buses that are read from local variables, one per unit
+constexpr auto RA_BUS_PREFIXES = indexedLocalVariableNames<2>("A32NX_RA_", "_");
+constexpr auto LGCIU_BUS_PREFIXES = indexedLocalVariableNames<2>("A32NX_LGCIU_", "_");
+constexpr auto ADR_BUS_PREFIXES = indexedLocalVariableNames<3>("A32NX_ADIRS_ADR_", "_");
+constexpr auto IR_BUS_PREFIXES = indexedLocalVariableNames<3>("A32NX_ADIRS_IR_", "_");
+
+// names of the other local variables of the units and surfaces, one per unit
+constexpr auto LGCIU_NOSE_GEAR_COMPRESSED_NAMES = indexedLocalVariableNames<2>("A32NX_LGCIU_", "_NOSE_GEAR_COMPRESSED");
+constexpr auto LGCIU_LEFT_MAIN_GEAR_COMPRESSED_NAMES = indexedLocalVariableNames<2>("A32NX_LGCIU_", "_LEFT_GEAR_COMPRESSED");
+constexpr auto LGCIU_RIGHT_MAIN_GEAR_COMPRESSED_NAMES = indexedLocalVariableNames<2>("A32NX_LGCIU_", "_RIGHT_GEAR_COMPRESSED");
+constexpr auto FCDC_DISCRETE_WORD_1_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_DISCRETE_WORD_1");
+constexpr auto FCDC_DISCRETE_WORD_2_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_DISCRETE_WORD_2");
+constexpr auto FCDC_DISCRETE_WORD_3_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_DISCRETE_WORD_3");
+constexpr auto FCDC_DISCRETE_WORD_4_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_DISCRETE_WORD_4");
+constexpr auto FCDC_DISCRETE_WORD_5_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_DISCRETE_WORD_5");
+constexpr auto FCDC_CAPT_ROLL_COMMAND_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_CAPT_ROLL_COMMAND");
+constexpr auto FCDC_FO_ROLL_COMMAND_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_FO_ROLL_COMMAND");
+constexpr auto FCDC_CAPT_PITCH_COMMAND_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_CAPT_PITCH_COMMAND");
+constexpr auto FCDC_FO_PITCH_COMMAND_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_FO_PITCH_COMMAND");
+constexpr auto FCDC_RUDDER_PEDAL_POS_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_RUDDER_PEDAL_POS");
+constexpr auto FCDC_AILERON_LEFT_POS_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_AILERON_LEFT_POS");
+constexpr auto FCDC_ELEVATOR_LEFT_POS_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_ELEVATOR_LEFT_POS");
+constexpr auto FCDC_AILERON_RIGHT_POS_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_AILERON_RIGHT_POS");
+constexpr auto FCDC_ELEVATOR_RIGHT_POS_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_ELEVATOR_RIGHT_POS");
+constexpr auto FCDC_ELEVATOR_TRIM_POS_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_ELEVATOR_TRIM_POS");
+constexpr auto FCDC_SPOILER_LEFT_1_POS_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_SPOILER_LEFT_1_POS");
+constexpr auto FCDC_SPOILER_LEFT_2_POS_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_SPOILER_LEFT_2_POS");
+constexpr auto FCDC_SPOILER_LEFT_3_POS_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_SPOILER_LEFT_3_POS");
+constexpr auto FCDC_SPOILER_LEFT_4_POS_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_SPOILER_LEFT_4_POS");
+constexpr auto FCDC_SPOILER_LEFT_5_POS_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_SPOILER_LEFT_5_POS");
+constexpr auto FCDC_SPOILER_RIGHT_1_POS_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_SPOILER_RIGHT_1_POS");
+constexpr auto FCDC_SPOILER_RIGHT_2_POS_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_SPOILER_RIGHT_2_POS");
+constexpr auto FCDC_SPOILER_RIGHT_3_POS_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_SPOILER_RIGHT_3_POS");
+constexpr auto FCDC_SPOILER_RIGHT_4_POS_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_SPOILER_RIGHT_4_POS");
+constexpr auto FCDC_SPOILER_RIGHT_5_POS_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_SPOILER_RIGHT_5_POS");
+constexpr auto FCDC_PRIORITY_CAPT_GREEN_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_PRIORITY_LIGHT_CAPT_GREEN_ON");
+constexpr auto FCDC_PRIORITY_CAPT_RED_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_PRIORITY_LIGHT_CAPT_RED_ON");
+constexpr auto FCDC_PRIORITY_FO_GREEN_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_PRIORITY_LIGHT_FO_GREEN_ON");
+constexpr auto FCDC_PRIORITY_FO_RED_NAMES = indexedLocalVariableNames<2>("A32NX_FCDC_", "_PRIORITY_LIGHT_FO_RED_ON");
+constexpr auto ELAC_PUSHBUTTON_PRESSED_NAMES = indexedLocalVariableNames<2>("A32NX_ELAC_", "_PUSHBUTTON_PRESSED");
+constexpr auto ELAC_DIGITAL_OP_VALIDATED_NAMES = indexedLocalVariableNames<2>("A32NX_ELAC_", "_DIGITAL_OP_VALIDATED");
+constexpr auto SEC_PUSHBUTTON_PRESSED_NAMES = indexedLocalVariableNames<3>("A32NX_SEC_", "_PUSHBUTTON_PRESSED");
+constexpr auto SEC_FAULT_LIGHT_ON_NAMES = indexedLocalVariableNames<3>("A32NX_SEC_", "_FAULT_LIGHT_ON");
+constexpr auto SEC_GROUND_SPOILERS_OUT_NAMES = indexedLocalVariableNames<3>("A32NX_SEC_", "_GROUND_SPOILER_OUT");
+constexpr auto FAC_PUSHBUTTON_PRESSED_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_PUSHBUTTON_PRESSED");
+constexpr auto FAC_HEALTHY_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_HEALTHY");
+constexpr auto FAC_DISCRETE_WORD_1_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_DISCRETE_WORD_1");
+constexpr auto FAC_GAMMA_A_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_GAMMA_A");
+constexpr auto FAC_GAMMA_T_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_GAMMA_T");
+constexpr auto FAC_WEIGHT_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_WEIGHT");
+constexpr auto FAC_CENTER_OF_GRAVITY_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_CENTER_OF_GRAVITY");
+constexpr auto FAC_SIDESLIP_TARGET_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_SIDESLIP_TARGET");
+constexpr auto FAC_SLAT_ANGLE_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_SLATS_ANGLE");
+constexpr auto FAC_FLAP_ANGLE_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_FLAPS_ANGLE");
+constexpr auto FAC_DISCRETE_WORD_2_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_DISCRETE_WORD_2");
+constexpr auto FAC_RUDDER_TRAVEL_LIMIT_COMMAND_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_RUDDER_TRAVEL_LIMIT_COMMAND");
+constexpr auto FAC_DELTA_R_YAW_DAMPER_VOTED_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_DELTA_R_YAW_DAMPER");
+constexpr auto FAC_ESTIMATED_SIDESLIP_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_ESTIMATED_SIDESLIP");
+constexpr auto FAC_V_ALPHA_LIM_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_V_ALPHA_LIM");
+constexpr auto FAC_V_LS_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_V_LS");
+constexpr auto FAC_V_STALL_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_V_STALL_1G");
+constexpr auto FAC_V_ALPHA_PROT_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_V_ALPHA_PROT");
+constexpr auto FAC_V_STALL_WARN_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_V_STALL_WARN");
+constexpr auto FAC_SPEED_TREND_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_SPEED_TREND");
+constexpr auto FAC_V_3_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_V_3");
+constexpr auto FAC_V_4_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_V_4");
+constexpr auto FAC_V_MAN_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_V_MAN");
+constexpr auto FAC_V_MAX_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_V_MAX");
+constexpr auto FAC_V_FE_NEXT_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_V_FE_NEXT");
+constexpr auto FAC_DISCRETE_WORD_3_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_DISCRETE_WORD_3");
+constexpr auto FAC_DISCRETE_WORD_4_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_DISCRETE_WORD_4");
+constexpr auto FAC_DISCRETE_WORD_5_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_DISCRETE_WORD_5");
+constexpr auto FAC_DELTA_R_RUDDER_TRIM_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_DELTA_R_RUDDER_TRIM");
+constexpr auto FAC_RUDDER_TRIM_POS_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_RUDDER_TRIM_POS");
+constexpr auto FAC_RUDDER_TRAVEL_LIMIT_RESET_NAMES = indexedLocalVariableNames<2>("A32NX_FAC_", "_RTL_EMER_RESET");
+constexpr auto RUDDER_TRIM_ACTIVE_MODE_COMMANDED_NAMES = indexedLocalVariableNames<2>("A32NX_RUDDER_TRIM_", "_ACTIVE_MODE_COMMANDED");
+constexpr auto RUDDER_TRIM_COMMANDED_POSITION_NAMES = indexedLocalVariableNames<2>("A32NX_RUDDER_TRIM_", "_COMMANDED_POSITION");
+constexpr auto RUDDER_TRAVEL_LIMIT_ACTIVE_MODE_COMMANDED_NAMES =
+    indexedLocalVariableNames<2>("A32NX_RUDDER_TRAVEL_LIM_", "_ACTIVE_MODE_COMMANDED");
+constexpr auto RUDDER_TRAVEL_LIM_COMMANDED_POSITION_NAMES = indexedLocalVariableNames<2>("A32NX_RUDDER_TRAVEL_LIM_", "_COMMANDED_POSITION");
+constexpr auto THS_ACTIVE_MODE_COMMANDED_NAMES = indexedLocalVariableNames<3>("A32NX_THS_", "_ACTIVE_MODE_COMMANDED");
+constexpr auto THS_COMMANDED_POSITION_NAMES = indexedLocalVariableNames<3>("A32NX_THS_", "_COMMANDED_POSITION");
+constexpr auto ELEV_FAULT_LEFT_NAMES = indexedLocalVariableNames<2>("A32NX_LEFT_ELEV_SERVO_", "_FAILED");
+constexpr auto ELEV_FAULT_RIGHT_NAMES = indexedLocalVariableNames<2>("A32NX_RIGHT_ELEV_SERVO_", "_FAILED");
+constexpr auto AIL_FAULT_LEFT_NAMES = indexedLocalVariableNames<2>("A32NX_LEFT_AIL_SERVO_", "_FAILED");
+constexpr auto AIL_FAULT_RIGHT_NAMES = indexedLocalVariableNames<2>("A32NX_RIGHT_AIL_SERVO_", "_FAILED");
+
+// names of the local variables of the aileron, elevator and yaw damper servos, one per servo, named after the hydraulic
+// system that powers it
+constexpr const char* LEFT_AILERON_SOLENOID_ENERGIZED_NAMES[] = {
+    "A32NX_LEFT_AIL_BLUE_SERVO_SOLENOID_ENERGIZED",
+    "A32NX_LEFT_AIL_GREEN_SERVO_SOLENOID_ENERGIZED",
+};
+constexpr const char* LEFT_AILERON_COMMANDED_POSITION_NAMES[] = {
+    "A32NX_LEFT_AIL_BLUE_COMMANDED_POSITION",
+    "A32NX_LEFT_AIL_GREEN_COMMANDED_POSITION",
+};
+constexpr const char* RIGHT_AILERON_SOLENOID_ENERGIZED_NAMES[] = {
+    "A32NX_RIGHT_AIL_GREEN_SERVO_SOLENOID_ENERGIZED",
+    "A32NX_RIGHT_AIL_BLUE_SERVO_SOLENOID_ENERGIZED",
+};
+constexpr const char* RIGHT_AILERON_COMMANDED_POSITION_NAMES[] = {
+    "A32NX_RIGHT_AIL_GREEN_COMMANDED_POSITION",
+    "A32NX_RIGHT_AIL_BLUE_COMMANDED_POSITION",
+};
+constexpr const char* LEFT_ELEVATOR_SOLENOID_ENERGIZED_NAMES[] = {
+    "A32NX_LEFT_ELEV_BLUE_SERVO_SOLENOID_ENERGIZED",
+    "A32NX_LEFT_ELEV_GREEN_SERVO_SOLENOID_ENERGIZED",
+};
+constexpr const char* LEFT_ELEVATOR_COMMANDED_POSITION_NAMES[] = {
+    "A32NX_LEFT_ELEV_BLUE_COMMANDED_POSITION",
+    "A32NX_LEFT_ELEV_GREEN_COMMANDED_POSITION",
+};
+constexpr const char* RIGHT_ELEVATOR_SOLENOID_ENERGIZED_NAMES[] = {
+    "A32NX_RIGHT_ELEV_BLUE_SERVO_SOLENOID_ENERGIZED",
+    "A32NX_RIGHT_ELEV_YELLOW_SERVO_SOLENOID_ENERGIZED",
+};
+constexpr const char* RIGHT_ELEVATOR_COMMANDED_POSITION_NAMES[] = {
+    "A32NX_RIGHT_ELEV_BLUE_COMMANDED_POSITION",
+    "A32NX_RIGHT_ELEV_YELLOW_COMMANDED_POSITION",
+};
+constexpr const char* YAW_DAMPER_SOLENOID_ENERGIZED_NAMES[] = {
+    "A32NX_YAW_DAMPER_GREEN_SERVO_SOLENOID_ENERGIZED",
+    "A32NX_YAW_DAMPER_YELLOW_SERVO_SOLENOID_ENERGIZED",
+};
+constexpr const char* YAW_DAMPER_COMMANDED_POSITION_NAMES[] = {
+    "A32NX_YAW_DAMPER_GREEN_COMMANDED_POSITION",
+    "A32NX_YAW_DAMPER_YELLOW_COMMANDED_POSITION",
+};
+
+// ARINC 429 words of the buses that are read from local variables: local variable name after the prefix of the unit and
+// word in the bus
+const Arinc429BusDecoder::Field RA_BUS_FIELDS[] = {
+    {"RADIO_ALTITUDE", ARINC429_BUS_WORD(base_ra_bus, radio_height_ft)},
+};
+
+const Arinc429BusDecoder::Field LGCIU_BUS_FIELDS[] = {
+    {"DISCRETE_WORD_1", ARINC429_BUS_WORD(base_lgciu_bus, discrete_word_1)},
+    {"DISCRETE_WORD_2", ARINC429_BUS_WORD(base_lgciu_bus, discrete_word_2)},
+    {"DISCRETE_WORD_3", ARINC429_BUS_WORD(base_lgciu_bus, discrete_word_3)},
+};
+
+const Arinc429BusDecoder::Field SFCC_BUS_FIELDS[] = {
+    {"SLAT_FLAP_COMPONENT_STATUS_WORD", ARINC429_BUS_WORD(base_sfcc_bus, slat_flap_component_status_word)},
+    {"SLAT_FLAP_SYSTEM_STATUS_WORD", ARINC429_BUS_WORD(base_sfcc_bus, slat_flap_system_status_word)},
+    {"SLAT_FLAP_ACTUAL_POSITION_WORD", ARINC429_BUS_WORD(base_sfcc_bus, slat_flap_actual_position_word)},
+    {"SLAT_ACTUAL_POSITION_WORD", ARINC429_BUS_WORD(base_sfcc_bus, slat_actual_position_deg)},
+    {"FLAP_ACTUAL_POSITION_WORD", ARINC429_BUS_WORD(base_sfcc_bus, flap_actual_position_deg)},
+};
+
+const Arinc429BusDecoder::Field ADR_BUS_FIELDS[] = {
+    {"ALTITUDE", ARINC429_BUS_WORD(base_adr_bus, altitude_corrected_ft)},
+    {"MACH", ARINC429_BUS_WORD(base_adr_bus, mach)},
+    {"COMPUTED_AIRSPEED", ARINC429_BUS_WORD(base_adr_bus, airspeed_computed_kn)},
+    {"TRUE_AIRSPEED", ARINC429_BUS_WORD(base_adr_bus, airspeed_true_kn)},
+    {"BAROMETRIC_VERTICAL_SPEED", ARINC429_BUS_WORD(base_adr_bus, vertical_speed_ft_min)},
+    {"ANGLE_OF_ATTACK", ARINC429_BUS_WORD(base_adr_bus, aoa_corrected_deg)},
+    {"CORRECTED_AVERAGE_STATIC_PRESSURE", ARINC429_BUS_WORD(base_adr_bus, corrected_average_static_pressure)},
+};
+
+const Arinc429BusDecoder::Field IR_BUS_FIELDS[] = {
+    {"LATITUDE", ARINC429_BUS_WORD(base_ir_bus, latitude_deg)},
+    {"LONGITUDE", ARINC429_BUS_WORD(base_ir_bus, longitude_deg)},
+    {"GROUND_SPEED", ARINC429_BUS_WORD(base_ir_bus, ground_speed_kn)},
+    {"WIND_SPEED", ARINC429_BUS_WORD(base_ir_bus, wind_speed_kn)},
+    {"WIND_DIRECTION", ARINC429_BUS_WORD(base_ir_bus, wind_direction_true_deg)},
+    {"TRACK", ARINC429_BUS_WORD(base_ir_bus, track_angle_magnetic_deg)},
+    {"HEADING", ARINC429_BUS_WORD(base_ir_bus, heading_magnetic_deg)},
+    {"DRIFT_ANGLE", ARINC429_BUS_WORD(base_ir_bus, drift_angle_deg)},
+    {"FLIGHT_PATH_ANGLE", ARINC429_BUS_WORD(base_ir_bus, flight_path_angle_deg)},
+    {"PITCH", ARINC429_BUS_WORD(base_ir_bus, pitch_angle_deg)},
+    {"ROLL", ARINC429_BUS_WORD(base_ir_bus, roll_angle_deg)},
+    {"BODY_PITCH_RATE", ARINC429_BUS_WORD(base_ir_bus, body_pitch_rate_deg_s)},
+    {"BODY_ROLL_RATE", ARINC429_BUS_WORD(base_ir_bus, body_roll_rate_deg_s)},
+    {"BODY_YAW_RATE", ARINC429_BUS_WORD(base_ir_bus, body_yaw_rate_deg_s)},
+    {"BODY_LONGITUDINAL_ACC", ARINC429_BUS_WORD(base_ir_bus, body_long_accel_g)},
+    {"BODY_LATERAL_ACC", ARINC429_BUS_WORD(base_ir_bus, body_lat_accel_g)},
+    {"BODY_NORMAL_ACC", ARINC429_BUS_WORD(base_ir_bus, body_normal_accel_g)},
+    {"HEADING_RATE", ARINC429_BUS_WORD(base_ir_bus, track_angle_rate_deg_s)},
+    {"PITCH_ATT_RATE", ARINC429_BUS_WORD(base_ir_bus, pitch_att_rate_deg_s)},
+    {"ROLL_ATT_RATE", ARINC429_BUS_WORD(base_ir_bus, roll_att_rate_deg_s)},
+    {"VERTICAL_SPEED", ARINC429_BUS_WORD(base_ir_bus, inertial_vertical_speed_ft_s)},
+};
+}  // namespace
+
 bool FlyByWireInterface::connect() {
+  // remember start of the startup, it is reported with the first frame
+  startupStart = std::chrono::steady_clock::now();
+
   // setup local variables
   setupLocalVariables();
+  startupLocalVariablesTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startupStart).count();
+
+  // setup frame profiler
+  setupFrameProfiler();
+
+  // setup frame scheduler
+  setupFrameScheduler();
+
+  // setup bus routes between the computers
+  setupBusRoutes();
 
   // load configuration
   loadConfiguration();
@@ -32,11 +242,11 @@ bool FlyByWireInterface::connect() {
   flightDataRecorder.initialize();
 
   // connect to sim connect
-  return simConnectInterface.connect(clientDataEnabled, autopilotStateMachineEnabled, autopilotLawsEnabled, flyByWireEnabled, elacDisabled,
-                                     secDisabled, facDisabled, throttleAxis, spoilersHandler, flightControlsKeyChangeAileron,
-                                     flightControlsKeyChangeElevator, flightControlsKeyChangeRudder,
-                                     disableXboxCompatibilityRudderAxisPlusMinus, idMinimumSimulationRate->get(),
-                                     idMaximumSimulationRate->get(), limitSimulationRateByPerformance);
+  return simConnectInterface.connect(clientDataEnabled, clientDataPacked, clientDataLoopback, autopilotStateMachineEnabled,
+                                     autopilotLawsEnabled, flyByWireEnabled, elacDisabled, secDisabled, facDisabled, throttleAxis,
+                                     spoilersHandler, flightControlsKeyChangeAileron, flightControlsKeyChangeElevator,
+                                     flightControlsKeyChangeRudder, disableXboxCompatibilityRudderAxisPlusMinus,
+                                     idMinimumSimulationRate->get(), idMaximumSimulationRate->get(), limitSimulationRateByPerformance);
 }
 
 void FlyByWireInterface::disconnect() {
@@ -58,13 +268,46 @@ void FlyByWireInterface::disconnect() {
 }
 
 bool FlyByWireInterface::update(double sampleTime) {
+  frameStart = std::chrono::steady_clock::now();
+  frameProfiler.beginFrame();
+
+  bool result = updateFrame(sampleTime);
+
+  // publish the local variables set during the frame in one pass
+  result &= updateLocalVariableStatistics();
+  {
+    FrameProfiler::Scope profilerScope(frameProfiler, profilerStageWriteLocalVariables);
+    LocalVariable::writeAll();
+  }
+
+  // the profiler results are published with the next frame
+  frameProfiler.endFrame();
+
+  // the compute time is used by the simulation rate governor in the next frame
+  frameComputeTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - frameStart).count();
+
+  // report the time from connect() to the end of the first frame
+  if (!isStartupReported) {
+    isStartupReported = true;
+    double startupTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startupStart).count();
+    std::cout << "WASM: startup took " << startupTime * 1000 << " ms, local variables " << startupLocalVariablesTime * 1000 << " ms, "
+              << LocalVariable::getRegisteredCount() << " local variables registered" << std::endl;
+  }
+
+  return result;
+}
+
+bool FlyByWireInterface::updateFrame(double sampleTime) {
   bool result = true;
 
   // update failures handler
   failuresConsumer.update();
 
   // get data & inputs
-  result &= readDataAndLocalVariables(sampleTime);
+  {
+    FrameProfiler::Scope profilerScope(frameProfiler, profilerStageReadData);
+    result &= readDataAndLocalVariables(sampleTime);
+  }
 
   // update performance monitoring
   result &= updatePerformanceMonitoring(sampleTime);
@@ -86,9 +329,6 @@ bool FlyByWireInterface::update(double sampleTime) {
     return result;
   }
 
-  // update altimeter setting
-  result &= updateAltimeterSetting(calculatedSampleTime);
-
   // update autopilot state machine
   result &= updateAutopilotStateMachine(calculatedSampleTime);
 
@@ -133,22 +373,32 @@ bool FlyByWireInterface::update(double sampleTime) {
     result &= updateFcdc(calculatedSampleTime, i);
   }
 
+  // send the bus words and computer inputs of this frame to the external computers at once
+  if (clientDataEnabled) {
+    result &= simConnectInterface.sendClientDataBusFrame();
+  }
+
   result &= updateServoSolenoidStatus();
 
-  // update additional recording data
+  // the additional data and engine data are recorded with this frame and read by the autothrust and the FO side, so they
+  // are updated every frame and before the deferred work
   result &= updateAdditionalData(calculatedSampleTime);
-
-  // update engine data
   result &= updateEngineData(calculatedSampleTime);
 
   // update spoilers
   result &= updateSpoilers(calculatedSampleTime);
 
-  // update FO side with FO Sync ON
-  result &= updateFoSide(calculatedSampleTime);
+  // update altimeter setting, FO side with FO Sync ON and the flight data recorder file as the budget allows
+  {
+    FrameProfiler::Scope profilerScope(frameProfiler, profilerStageDeferredWork);
+    result &= frameScheduler.run(calculatedSampleTime, frameStart);
+  }
 
-  // update flight data recorder
-  flightDataRecorder.update(&autopilotStateMachine, &autopilotLaws, &autoThrust, engineData, additionalData);
+  // buffer the data of the flight data recorder
+  {
+    FrameProfiler::Scope profilerScope(frameProfiler, profilerStageFlightDataRecorder);
+    flightDataRecorder.update(&autopilotStateMachine, &autopilotLaws, &autoThrust, engineData, additionalData);
+  }
 
   // if default AP is on -> disconnect it
   if (simConnectInterface.getSimData().autopilot_master_on) {
@@ -162,6 +412,82 @@ bool FlyByWireInterface::update(double sampleTime) {
   return result;
 }
 
+// Save the state of the models and flight control computers into the arena, e.g. to rewind or fork a session.
+// The computer outputs are included as they are consumed by the other computers on the next frame.
+bool FlyByWireInterface::saveState(SnapshotArena& arena) const {
+  if (!(arena.save(autopilotStateMachine) && arena.save(autopilotStateMachineOutput) && arena.save(autopilotLaws) &&
+        arena.save(autopilotLawsOutput) && arena.save(autoThrust) && arena.save(autoThrustOutput))) {
+    return false;
+  }
+
+  for (int i = 0; i < 2; i++) {
+    if (!elacs[i].saveState(arena)) {
+      return false;
+    }
+  }
+
+  for (int i = 0; i < 3; i++) {
+    if (!secs[i].saveState(arena)) {
+      return false;
+    }
+  }
+
+  for (int i = 0; i < 2; i++) {
+    if (!fcdcs[i].saveState(arena)) {
+      return false;
+    }
+  }
+
+  for (int i = 0; i < 2; i++) {
+    if (!facs[i].saveState(arena)) {
+      return false;
+    }
+  }
+
+  return arena.save(elacsDiscreteOutputs) && arena.save(elacsAnalogOutputs) && arena.save(elacsBusOutputs) &&
+         arena.save(secsDiscreteOutputs) && arena.save(secsAnalogOutputs) && arena.save(secsBusOutputs) &&
+         arena.save(fcdcsDiscreteOutputs) && arena.save(fcdcsBusOutputs) && arena.save(facsDiscreteOutputs) &&
+         arena.save(facsAnalogOutputs) && arena.save(facsBusOutputs);
+}
+
+// Restore the state saved by saveState. Stops at the first object that cannot be restored, the state is then only partly
+// restored and must be restored again from a complete snapshot.
+bool FlyByWireInterface::restoreState(SnapshotArena& arena) {
+  if (!(arena.restore(autopilotStateMachine) && arena.restore(autopilotStateMachineOutput) && arena.restore(autopilotLaws) &&
+        arena.restore(autopilotLawsOutput) && arena.restore(autoThrust) && arena.restore(autoThrustOutput))) {
+    return false;
+  }
+
+  for (int i = 0; i < 2; i++) {
+    if (!elacs[i].restoreState(arena)) {
+      return false;
+    }
+  }
+
+  for (int i = 0; i < 3; i++) {
+    if (!secs[i].restoreState(arena)) {
+      return false;
+    }
+  }
+
+  for (int i = 0; i < 2; i++) {
+    if (!fcdcs[i].restoreState(arena)) {
+      return false;
+    }
+  }
+
+  for (int i = 0; i < 2; i++) {
+    if (!facs[i].restoreState(arena)) {
+      return false;
+    }
+  }
+
+  return arena.restore(elacsDiscreteOutputs) && arena.restore(elacsAnalogOutputs) && arena.restore(elacsBusOutputs) &&
+         arena.restore(secsDiscreteOutputs) && arena.restore(secsAnalogOutputs) && arena.restore(secsBusOutputs) &&
+         arena.restore(fcdcsDiscreteOutputs) && arena.restore(fcdcsBusOutputs) && arena.restore(facsDiscreteOutputs) &&
+         arena.restore(facsAnalogOutputs) && arena.restore(facsBusOutputs);
+}
+
 void FlyByWireInterface::loadConfiguration() {
   // parse from ini file
   INIStructure iniStructure;
@@ -178,6 +504,8 @@ void FlyByWireInterface::loadConfiguration() {
   secDisabled = INITypeConversion::getInteger(iniStructure, "MODEL", "SEC_DISABLED", -1);
   facDisabled = INITypeConversion::getInteger(iniStructure, "MODEL", "FAC_DISABLED", -1);
   tailstrikeProtectionEnabled = INITypeConversion::getBoolean(iniStructure, "MODEL", "TAILSTRIKE_PROTECTION_ENABLED", false);
+  clientDataPacked = INITypeConversion::getBoolean(iniStructure, "MODEL", "CLIENT_DATA_PACKED", false);
+  clientDataLoopback = INITypeConversion::getBoolean(iniStructure, "MODEL", "CLIENT_DATA_LOOPBACK", false);
 
   // if any model is deactivated we need to enable client data
   clientDataEnabled = (elacDisabled != -1 || secDisabled != -1 || facDisabled != -1 || !autopilotStateMachineEnabled ||
@@ -193,6 +521,8 @@ void FlyByWireInterface::loadConfiguration() {
   std::cout << "WASM: MODEL     : SEC_DISABLED                         = " << secDisabled << std::endl;
   std::cout << "WASM: MODEL     : FAC_DISABLED                         = " << facDisabled << std::endl;
   std::cout << "WASM: MODEL     : TAILSTRIKE_PROTECTION_ENABLED        = " << tailstrikeProtectionEnabled << std::endl;
+  std::cout << "WASM: MODEL     : CLIENT_DATA_PACKED                   = " << clientDataPacked << std::endl;
+  std::cout << "WASM: MODEL     : CLIENT_DATA_LOOPBACK                 = " << clientDataLoopback << std::endl;
 
   // --------------------------------------------------------------------------
   // load values - autopilot
@@ -200,12 +530,19 @@ void FlyByWireInterface::loadConfiguration() {
   idMaximumSimulationRate->set(INITypeConversion::getDouble(iniStructure, "AUTOPILOT", "MAXIMUM_SIMULATION_RATE", 4));
   limitSimulationRateByPerformance = INITypeConversion::getBoolean(iniStructure, "AUTOPILOT", "LIMIT_SIMULATION_RATE_BY_PERFORMANCE", true);
   simulationRateReductionEnabled = INITypeConversion::getBoolean(iniStructure, "AUTOPILOT", "SIMULATION_RATE_REDUCTION_ENABLED", true);
+  simulationRateGovernorEnabled = INITypeConversion::getBoolean(iniStructure, "AUTOPILOT", "SIMULATION_RATE_GOVERNOR_ENABLED", true);
 
   // print configuration into console
   std::cout << "WASM: AUTOPILOT : MINIMUM_SIMULATION_RATE                     = " << idMinimumSimulationRate->get() << std::endl;
   std::cout << "WASM: AUTOPILOT : MAXIMUM_SIMULATION_RATE                     = " << idMaximumSimulationRate->get() << std::endl;
   std::cout << "WASM: AUTOPILOT : LIMIT_SIMULATION_RATE_BY_PERFORMANCE        = " << limitSimulationRateByPerformance << std::endl;
   std::cout << "WASM: AUTOPILOT : SIMULATION_RATE_REDUCTION_ENABLED           = " << simulationRateReductionEnabled << std::endl;
+  std::cout << "WASM: AUTOPILOT : SIMULATION_RATE_GOVERNOR_ENABLED            = " << simulationRateGovernorEnabled << std::endl;
+
+  // initialize simulation rate governor
+  SimulationRateGovernor::Parameters governorParameters = {};
+  governorParameters.maxSampleTime = MAX_ACCEPTABLE_SAMPLE_TIME;
+  simulationRateGovernor.initialize(governorParameters);
 
   // --------------------------------------------------------------------------
   // load values - autothrust
@@ -288,6 +625,13 @@ void FlyByWireInterface::setupLocalVariables() {
 
   // register L variable for performance warning
   idPerformanceWarningActive = std::make_unique<LocalVariable>("A32NX_PERFORMANCE_WARNING_ACTIVE");
+  idSimulationRateGovernorMaximumRate = std::make_unique<LocalVariable>("A32NX_SIM_RATE_GOVERNOR_MAX_RATE");
+  idSimulationRateGovernorComputeTime = std::make_unique<LocalVariable>("A32NX_SIM_RATE_GOVERNOR_COMPUTE_TIME_US");
+
+  // register L variables for the local variable statistics of the previous frame
+  idLocalVariableReads = std::make_unique<LocalVariable>("A32NX_FBW_LVAR_READS");
+  idLocalVariableWrites = std::make_unique<LocalVariable>("A32NX_FBW_LVAR_WRITES");
+  idLocalVariableWritesAvoided = std::make_unique<LocalVariable>("A32NX_FBW_LVAR_WRITES_AVOIDED");
 
   // register L variable for external override
   idTrackingMode = std::make_unique<LocalVariable>("A32NX_FLIGHT_CONTROLS_TRACKING_MODE");
@@ -490,205 +834,143 @@ void FlyByWireInterface::setupLocalVariables() {
   idFmGrossWeight = std::make_unique<LocalVariable>("A32NX_FM_GROSS_WEIGHT");
 
   for (int i = 0; i < 2; i++) {
-    std::string idString = std::to_string(i + 1);
-    idRadioAltimeterHeight[i] = std::make_unique<LocalVariable>("A32NX_RA_" + idString + "_RADIO_ALTITUDE");
+    raBusDecoders[i].initialize(RA_BUS_PREFIXES[i].data(), RA_BUS_FIELDS, std::size(RA_BUS_FIELDS));
   }
 
   for (int i = 0; i < 2; i++) {
-    std::string idString = std::to_string(i + 1);
-    idLgciuNoseGearCompressed[i] = std::make_unique<LocalVariable>("A32NX_LGCIU_" + idString + "_NOSE_GEAR_COMPRESSED");
-    idLgciuLeftMainGearCompressed[i] = std::make_unique<LocalVariable>("A32NX_LGCIU_" + idString + "_LEFT_GEAR_COMPRESSED");
-    idLgciuRightMainGearCompressed[i] = std::make_unique<LocalVariable>("A32NX_LGCIU_" + idString + "_RIGHT_GEAR_COMPRESSED");
-    idLgciuDiscreteWord1[i] = std::make_unique<LocalVariable>("A32NX_LGCIU_" + idString + "_DISCRETE_WORD_1");
-    idLgciuDiscreteWord2[i] = std::make_unique<LocalVariable>("A32NX_LGCIU_" + idString + "_DISCRETE_WORD_2");
-    idLgciuDiscreteWord3[i] = std::make_unique<LocalVariable>("A32NX_LGCIU_" + idString + "_DISCRETE_WORD_3");
+    idLgciuNoseGearCompressed[i] = std::make_unique<LocalVariable>(LGCIU_NOSE_GEAR_COMPRESSED_NAMES[i].data());
+    idLgciuLeftMainGearCompressed[i] = std::make_unique<LocalVariable>(LGCIU_LEFT_MAIN_GEAR_COMPRESSED_NAMES[i].data());
+    idLgciuRightMainGearCompressed[i] = std::make_unique<LocalVariable>(LGCIU_RIGHT_MAIN_GEAR_COMPRESSED_NAMES[i].data());
+    lgciuBusDecoders[i].initialize(LGCIU_BUS_PREFIXES[i].data(), LGCIU_BUS_FIELDS, std::size(LGCIU_BUS_FIELDS));
   }
 
-  idSfccSlatFlapComponentStatusWord = std::make_unique<LocalVariable>("A32NX_SFCC_SLAT_FLAP_COMPONENT_STATUS_WORD");
-  idSfccSlatFlapSystemStatusWord = std::make_unique<LocalVariable>("A32NX_SFCC_SLAT_FLAP_SYSTEM_STATUS_WORD");
-  idSfccSlatFlapActualPositionWord = std::make_unique<LocalVariable>("A32NX_SFCC_SLAT_FLAP_ACTUAL_POSITION_WORD");
-  idSfccSlatActualPositionWord = std::make_unique<LocalVariable>("A32NX_SFCC_SLAT_ACTUAL_POSITION_WORD");
-  idSfccFlapActualPositionWord = std::make_unique<LocalVariable>("A32NX_SFCC_FLAP_ACTUAL_POSITION_WORD");
+  sfccBusDecoder.initialize("A32NX_SFCC_", SFCC_BUS_FIELDS, std::size(SFCC_BUS_FIELDS));
 
   for (int i = 0; i < 3; i++) {
-    std::string idString = std::to_string(i + 1);
-    idAdrAltitudeCorrected[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_ADR_" + idString + "_ALTITUDE");
-    idAdrMach[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_ADR_" + idString + "_MACH");
-    idAdrAirspeedComputed[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_ADR_" + idString + "_COMPUTED_AIRSPEED");
-    idAdrAirspeedTrue[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_ADR_" + idString + "_TRUE_AIRSPEED");
-    idAdrVerticalSpeed[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_ADR_" + idString + "_BAROMETRIC_VERTICAL_SPEED");
-    idAdrAoaCorrected[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_ADR_" + idString + "_ANGLE_OF_ATTACK");
-    idAdrCorrectedAverageStaticPressure[i] =
-        std::make_unique<LocalVariable>("A32NX_ADIRS_ADR_" + idString + "_CORRECTED_AVERAGE_STATIC_PRESSURE");
-
-    idIrLatitude[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_LATITUDE");
-    idIrLongitude[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_LONGITUDE");
-    idIrGroundSpeed[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_GROUND_SPEED");
-    idIrWindSpeed[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_WIND_SPEED");
-    idIrWindDirectionTrue[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_WIND_DIRECTION");
-    idIrTrackAngleMagnetic[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_TRACK");
-    idIrHeadingMagnetic[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_HEADING");
-    idIrDriftAngle[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_DRIFT_ANGLE");
-    idIrFlightPathAngle[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_FLIGHT_PATH_ANGLE");
-    idIrPitchAngle[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_PITCH");
-    idIrRollAngle[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_ROLL");
-    idIrBodyPitchRate[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_BODY_PITCH_RATE");
-    idIrBodyRollRate[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_BODY_ROLL_RATE");
-    idIrBodyYawRate[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_BODY_YAW_RATE");
-    idIrBodyLongAccel[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_BODY_LONGITUDINAL_ACC");
-    idIrBodyLatAccel[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_BODY_LATERAL_ACC");
-    idIrBodyNormalAccel[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_BODY_NORMAL_ACC");
-    idIrTrackAngleRate[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_HEADING_RATE");
-    idIrPitchAttRate[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_PITCH_ATT_RATE");
-    idIrRollAttRate[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_ROLL_ATT_RATE");
-    idIrInertialVerticalSpeed[i] = std::make_unique<LocalVariable>("A32NX_ADIRS_IR_" + idString + "_VERTICAL_SPEED");
+    adrBusDecoders[i].initialize(ADR_BUS_PREFIXES[i].data(), ADR_BUS_FIELDS, std::size(ADR_BUS_FIELDS));
+    irBusDecoders[i].initialize(IR_BUS_PREFIXES[i].data(), IR_BUS_FIELDS, std::size(IR_BUS_FIELDS));
   }
 
   for (int i = 0; i < 2; i++) {
-    std::string idString = std::to_string(i + 1);
-
-    idFcdcDiscreteWord1[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_DISCRETE_WORD_1");
-    idFcdcDiscreteWord2[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_DISCRETE_WORD_2");
-    idFcdcDiscreteWord3[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_DISCRETE_WORD_3");
-    idFcdcDiscreteWord4[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_DISCRETE_WORD_4");
-    idFcdcDiscreteWord5[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_DISCRETE_WORD_5");
-    idFcdcCaptRollCommand[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_CAPT_ROLL_COMMAND");
-    idFcdcFoRollCommand[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_FO_ROLL_COMMAND");
-    idFcdcCaptPitchCommand[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_CAPT_PITCH_COMMAND");
-    idFcdcFoPitchCommand[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_FO_PITCH_COMMAND");
-    idFcdcRudderPedalPos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_RUDDER_PEDAL_POS");
-    idFcdcAileronLeftPos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_AILERON_LEFT_POS");
-    idFcdcElevatorLeftPos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_ELEVATOR_LEFT_POS");
-    idFcdcAileronRightPos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_AILERON_RIGHT_POS");
-    idFcdcElevatorRightPos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_ELEVATOR_RIGHT_POS");
-    idFcdcElevatorTrimPos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_ELEVATOR_TRIM_POS");
-    idFcdcSpoilerLeft1Pos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_SPOILER_LEFT_1_POS");
-    idFcdcSpoilerLeft2Pos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_SPOILER_LEFT_2_POS");
-    idFcdcSpoilerLeft3Pos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_SPOILER_LEFT_3_POS");
-    idFcdcSpoilerLeft4Pos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_SPOILER_LEFT_4_POS");
-    idFcdcSpoilerLeft5Pos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_SPOILER_LEFT_5_POS");
-    idFcdcSpoilerRight1Pos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_SPOILER_RIGHT_1_POS");
-    idFcdcSpoilerRight2Pos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_SPOILER_RIGHT_2_POS");
-    idFcdcSpoilerRight3Pos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_SPOILER_RIGHT_3_POS");
-    idFcdcSpoilerRight4Pos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_SPOILER_RIGHT_4_POS");
-    idFcdcSpoilerRight5Pos[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_SPOILER_RIGHT_5_POS");
-
-    idFcdcPriorityCaptGreen[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_PRIORITY_LIGHT_CAPT_GREEN_ON");
-    idFcdcPriorityCaptRed[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_PRIORITY_LIGHT_CAPT_RED_ON");
-    idFcdcPriorityFoGreen[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_PRIORITY_LIGHT_FO_GREEN_ON");
-    idFcdcPriorityFoRed[i] = std::make_unique<LocalVariable>("A32NX_FCDC_" + idString + "_PRIORITY_LIGHT_FO_RED_ON");
+    idFcdcDiscreteWord1[i] = std::make_unique<LocalVariable>(FCDC_DISCRETE_WORD_1_NAMES[i].data());
+    idFcdcDiscreteWord2[i] = std::make_unique<LocalVariable>(FCDC_DISCRETE_WORD_2_NAMES[i].data());
+    idFcdcDiscreteWord3[i] = std::make_unique<LocalVariable>(FCDC_DISCRETE_WORD_3_NAMES[i].data());
+    idFcdcDiscreteWord4[i] = std::make_unique<LocalVariable>(FCDC_DISCRETE_WORD_4_NAMES[i].data());
+    idFcdcDiscreteWord5[i] = std::make_unique<LocalVariable>(FCDC_DISCRETE_WORD_5_NAMES[i].data());
+    idFcdcCaptRollCommand[i] = std::make_unique<LocalVariable>(FCDC_CAPT_ROLL_COMMAND_NAMES[i].data());
+    idFcdcFoRollCommand[i] = std::make_unique<LocalVariable>(FCDC_FO_ROLL_COMMAND_NAMES[i].data());
+    idFcdcCaptPitchCommand[i] = std::make_unique<LocalVariable>(FCDC_CAPT_PITCH_COMMAND_NAMES[i].data());
+    idFcdcFoPitchCommand[i] = std::make_unique<LocalVariable>(FCDC_FO_PITCH_COMMAND_NAMES[i].data());
+    idFcdcRudderPedalPos[i] = std::make_unique<LocalVariable>(FCDC_RUDDER_PEDAL_POS_NAMES[i].data());
+    idFcdcAileronLeftPos[i] = std::make_unique<LocalVariable>(FCDC_AILERON_LEFT_POS_NAMES[i].data());
+    idFcdcElevatorLeftPos[i] = std::make_unique<LocalVariable>(FCDC_ELEVATOR_LEFT_POS_NAMES[i].data());
+    idFcdcAileronRightPos[i] = std::make_unique<LocalVariable>(FCDC_AILERON_RIGHT_POS_NAMES[i].data());
+    idFcdcElevatorRightPos[i] = std::make_unique<LocalVariable>(FCDC_ELEVATOR_RIGHT_POS_NAMES[i].data());
+    idFcdcElevatorTrimPos[i] = std::make_unique<LocalVariable>(FCDC_ELEVATOR_TRIM_POS_NAMES[i].data());
+    idFcdcSpoilerLeft1Pos[i] = std::make_unique<LocalVariable>(FCDC_SPOILER_LEFT_1_POS_NAMES[i].data());
+    idFcdcSpoilerLeft2Pos[i] = std::make_unique<LocalVariable>(FCDC_SPOILER_LEFT_2_POS_NAMES[i].data());
+    idFcdcSpoilerLeft3Pos[i] = std::make_unique<LocalVariable>(FCDC_SPOILER_LEFT_3_POS_NAMES[i].data());
+    idFcdcSpoilerLeft4Pos[i] = std::make_unique<LocalVariable>(FCDC_SPOILER_LEFT_4_POS_NAMES[i].data());
+    idFcdcSpoilerLeft5Pos[i] = std::make_unique<LocalVariable>(FCDC_SPOILER_LEFT_5_POS_NAMES[i].data());
+    idFcdcSpoilerRight1Pos[i] = std::make_unique<LocalVariable>(FCDC_SPOILER_RIGHT_1_POS_NAMES[i].data());
+    idFcdcSpoilerRight2Pos[i] = std::make_unique<LocalVariable>(FCDC_SPOILER_RIGHT_2_POS_NAMES[i].data());
+    idFcdcSpoilerRight3Pos[i] = std::make_unique<LocalVariable>(FCDC_SPOILER_RIGHT_3_POS_NAMES[i].data());
+    idFcdcSpoilerRight4Pos[i] = std::make_unique<LocalVariable>(FCDC_SPOILER_RIGHT_4_POS_NAMES[i].data());
+    idFcdcSpoilerRight5Pos[i] = std::make_unique<LocalVariable>(FCDC_SPOILER_RIGHT_5_POS_NAMES[i].data());
+
+    idFcdcPriorityCaptGreen[i] = std::make_unique<LocalVariable>(FCDC_PRIORITY_CAPT_GREEN_NAMES[i].data());
+    idFcdcPriorityCaptRed[i] = std::make_unique<LocalVariable>(FCDC_PRIORITY_CAPT_RED_NAMES[i].data());
+    idFcdcPriorityFoGreen[i] = std::make_unique<LocalVariable>(FCDC_PRIORITY_FO_GREEN_NAMES[i].data());
+    idFcdcPriorityFoRed[i] = std::make_unique<LocalVariable>(FCDC_PRIORITY_FO_RED_NAMES[i].data());
   }
 
   idThsOverrideActive = std::make_unique<LocalVariable>("A32NX_HYD_THS_TRIM_MANUAL_OVERRIDE");
 
   for (int i = 0; i < 2; i++) {
-    std::string idString = std::to_string(i + 1);
-
-    idElacPushbuttonPressed[i] = std::make_unique<LocalVariable>("A32NX_ELAC_" + idString + "_PUSHBUTTON_PRESSED");
-    idElacDigitalOpValidated[i] = std::make_unique<LocalVariable>("A32NX_ELAC_" + idString + "_DIGITAL_OP_VALIDATED");
+    idElacPushbuttonPressed[i] = std::make_unique<LocalVariable>(ELAC_PUSHBUTTON_PRESSED_NAMES[i].data());
+    idElacDigitalOpValidated[i] = std::make_unique<LocalVariable>(ELAC_DIGITAL_OP_VALIDATED_NAMES[i].data());
   }
 
   for (int i = 0; i < 3; i++) {
-    std::string idString = std::to_string(i + 1);
-
-    idSecPushbuttonPressed[i] = std::make_unique<LocalVariable>("A32NX_SEC_" + idString + "_PUSHBUTTON_PRESSED");
-    idSecFaultLightOn[i] = std::make_unique<LocalVariable>("A32NX_SEC_" + idString + "_FAULT_LIGHT_ON");
-    idSecGroundSpoilersOut[i] = std::make_unique<LocalVariable>("A32NX_SEC_" + idString + "_GROUND_SPOILER_OUT");
+    idSecPushbuttonPressed[i] = std::make_unique<LocalVariable>(SEC_PUSHBUTTON_PRESSED_NAMES[i].data());
+    idSecFaultLightOn[i] = std::make_unique<LocalVariable>(SEC_FAULT_LIGHT_ON_NAMES[i].data());
+    idSecGroundSpoilersOut[i] = std::make_unique<LocalVariable>(SEC_GROUND_SPOILERS_OUT_NAMES[i].data());
   }
 
   for (int i = 0; i < 2; i++) {
-    std::string idString = std::to_string(i + 1);
-
-    idFacPushbuttonPressed[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_PUSHBUTTON_PRESSED");
-    idFacHealthy[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_HEALTHY");
-
-    idFacDiscreteWord1[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_DISCRETE_WORD_1");
-    idFacGammaA[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_GAMMA_A");
-    idFacGammaT[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_GAMMA_T");
-    idFacWeight[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_WEIGHT");
-    idFacCenterOfGravity[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_CENTER_OF_GRAVITY");
-    idFacSideslipTarget[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_SIDESLIP_TARGET");
-    idFacSlatAngle[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_SLATS_ANGLE");
-    idFacFlapAngle[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_FLAPS_ANGLE");
-    idFacDiscreteWord2[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_DISCRETE_WORD_2");
-    idFacRudderTravelLimitCommand[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_RUDDER_TRAVEL_LIMIT_COMMAND");
-    idFacDeltaRYawDamperVoted[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_DELTA_R_YAW_DAMPER");
-    idFacEstimatedSideslip[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_ESTIMATED_SIDESLIP");
-    idFacVAlphaLim[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_V_ALPHA_LIM");
-    idFacVLs[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_V_LS");
-    idFacVStall[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_V_STALL_1G");
-    idFacVAlphaProt[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_V_ALPHA_PROT");
-    idFacVStallWarn[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_V_STALL_WARN");
-    idFacSpeedTrend[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_SPEED_TREND");
-    idFacV3[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_V_3");
-    idFacV4[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_V_4");
-    idFacVMan[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_V_MAN");
-    idFacVMax[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_V_MAX");
-    idFacVFeNext[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_V_FE_NEXT");
-    idFacDiscreteWord3[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_DISCRETE_WORD_3");
-    idFacDiscreteWord4[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_DISCRETE_WORD_4");
-    idFacDiscreteWord5[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_DISCRETE_WORD_5");
-    idFacDeltaRRudderTrim[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_DELTA_R_RUDDER_TRIM");
-    idFacRudderTrimPos[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_RUDDER_TRIM_POS");
-    idFacRudderTravelLimitReset[i] = std::make_unique<LocalVariable>("A32NX_FAC_" + idString + "_RTL_EMER_RESET");
+    idFacPushbuttonPressed[i] = std::make_unique<LocalVariable>(FAC_PUSHBUTTON_PRESSED_NAMES[i].data());
+    idFacHealthy[i] = std::make_unique<LocalVariable>(FAC_HEALTHY_NAMES[i].data());
+
+    idFacDiscreteWord1[i] = std::make_unique<LocalVariable>(FAC_DISCRETE_WORD_1_NAMES[i].data());
+    idFacGammaA[i] = std::make_unique<LocalVariable>(FAC_GAMMA_A_NAMES[i].data());
+    idFacGammaT[i] = std::make_unique<LocalVariable>(FAC_GAMMA_T_NAMES[i].data());
+    idFacWeight[i] = std::make_unique<LocalVariable>(FAC_WEIGHT_NAMES[i].data());
+    idFacCenterOfGravity[i] = std::make_unique<LocalVariable>(FAC_CENTER_OF_GRAVITY_NAMES[i].data());
+    idFacSideslipTarget[i] = std::make_unique<LocalVariable>(FAC_SIDESLIP_TARGET_NAMES[i].data());
+    idFacSlatAngle[i] = std::make_unique<LocalVariable>(FAC_SLAT_ANGLE_NAMES[i].data());
+    idFacFlapAngle[i] = std::make_unique<LocalVariable>(FAC_FLAP_ANGLE_NAMES[i].data());
+    idFacDiscreteWord2[i] = std::make_unique<LocalVariable>(FAC_DISCRETE_WORD_2_NAMES[i].data());
+    idFacRudderTravelLimitCommand[i] = std::make_unique<LocalVariable>(FAC_RUDDER_TRAVEL_LIMIT_COMMAND_NAMES[i].data());
+    idFacDeltaRYawDamperVoted[i] = std::make_unique<LocalVariable>(FAC_DELTA_R_YAW_DAMPER_VOTED_NAMES[i].data());
+    idFacEstimatedSideslip[i] = std::make_unique<LocalVariable>(FAC_ESTIMATED_SIDESLIP_NAMES[i].data());
+    idFacVAlphaLim[i] = std::make_unique<LocalVariable>(FAC_V_ALPHA_LIM_NAMES[i].data());
+    idFacVLs[i] = std::make_unique<LocalVariable>(FAC_V_LS_NAMES[i].data());
+    idFacVStall[i] = std::make_unique<LocalVariable>(FAC_V_STALL_NAMES[i].data());
+    idFacVAlphaProt[i] = std::make_unique<LocalVariable>(FAC_V_ALPHA_PROT_NAMES[i].data());
+    idFacVStallWarn[i] = std::make_unique<LocalVariable>(FAC_V_STALL_WARN_NAMES[i].data());
+    idFacSpeedTrend[i] = std::make_unique<LocalVariable>(FAC_SPEED_TREND_NAMES[i].data());
+    idFacV3[i] = std::make_unique<LocalVariable>(FAC_V_3_NAMES[i].data());
+    idFacV4[i] = std::make_unique<LocalVariable>(FAC_V_4_NAMES[i].data());
+    idFacVMan[i] = std::make_unique<LocalVariable>(FAC_V_MAN_NAMES[i].data());
+    idFacVMax[i] = std::make_unique<LocalVariable>(FAC_V_MAX_NAMES[i].data());
+    idFacVFeNext[i] = std::make_unique<LocalVariable>(FAC_V_FE_NEXT_NAMES[i].data());
+    idFacDiscreteWord3[i] = std::make_unique<LocalVariable>(FAC_DISCRETE_WORD_3_NAMES[i].data());
+    idFacDiscreteWord4[i] = std::make_unique<LocalVariable>(FAC_DISCRETE_WORD_4_NAMES[i].data());
+    idFacDiscreteWord5[i] = std::make_unique<LocalVariable>(FAC_DISCRETE_WORD_5_NAMES[i].data());
+    idFacDeltaRRudderTrim[i] = std::make_unique<LocalVariable>(FAC_DELTA_R_RUDDER_TRIM_NAMES[i].data());
+    idFacRudderTrimPos[i] = std::make_unique<LocalVariable>(FAC_RUDDER_TRIM_POS_NAMES[i].data());
+    idFacRudderTravelLimitReset[i] = std::make_unique<LocalVariable>(FAC_RUDDER_TRAVEL_LIMIT_RESET_NAMES[i].data());
   }
 
   for (int i = 0; i < 2; i++) {
-    std::string aileronStringLeft = i == 0 ? "BLUE" : "GREEN";
-    std::string aileronStringRight = i == 0 ? "GREEN" : "BLUE";
-    std::string elevatorStringLeft = i == 0 ? "BLUE" : "GREEN";
-    std::string elevatorStringRight = i == 0 ? "BLUE" : "YELLOW";
-    std::string yawDamperString = i == 0 ? "GREEN" : "YELLOW";
-    std::string idString = std::to_string(i + 1);
-
-    idLeftAileronSolenoidEnergized[i] =
-        std::make_unique<LocalVariable>("A32NX_LEFT_AIL_" + aileronStringLeft + "_SERVO_SOLENOID_ENERGIZED");
-    idLeftAileronCommandedPosition[i] = std::make_unique<LocalVariable>("A32NX_LEFT_AIL_" + aileronStringLeft + "_COMMANDED_POSITION");
-    idRightAileronSolenoidEnergized[i] =
-        std::make_unique<LocalVariable>("A32NX_RIGHT_AIL_" + aileronStringRight + "_SERVO_SOLENOID_ENERGIZED");
-    idRightAileronCommandedPosition[i] = std::make_unique<LocalVariable>("A32NX_RIGHT_AIL_" + aileronStringRight + "_COMMANDED_POSITION");
-    idLeftElevatorSolenoidEnergized[i] =
-        std::make_unique<LocalVariable>("A32NX_LEFT_ELEV_" + elevatorStringLeft + "_SERVO_SOLENOID_ENERGIZED");
-    idLeftElevatorCommandedPosition[i] = std::make_unique<LocalVariable>("A32NX_LEFT_ELEV_" + elevatorStringLeft + "_COMMANDED_POSITION");
-    idRightElevatorSolenoidEnergized[i] =
-        std::make_unique<LocalVariable>("A32NX_RIGHT_ELEV_" + elevatorStringRight + "_SERVO_SOLENOID_ENERGIZED");
-    idRightElevatorCommandedPosition[i] =
-        std::make_unique<LocalVariable>("A32NX_RIGHT_ELEV_" + elevatorStringRight + "_COMMANDED_POSITION");
-
-    idYawDamperSolenoidEnergized[i] = std::make_unique<LocalVariable>("A32NX_YAW_DAMPER_" + yawDamperString + "_SERVO_SOLENOID_ENERGIZED");
-    idYawDamperCommandedPosition[i] = std::make_unique<LocalVariable>("A32NX_YAW_DAMPER_" + yawDamperString + "_COMMANDED_POSITION");
-    idRudderTrimActiveModeCommanded[i] = std::make_unique<LocalVariable>("A32NX_RUDDER_TRIM_" + idString + "_ACTIVE_MODE_COMMANDED");
-    idRudderTrimCommandedPosition[i] = std::make_unique<LocalVariable>("A32NX_RUDDER_TRIM_" + idString + "_COMMANDED_POSITION");
-    idRudderTravelLimitActiveModeCommanded[i] =
-        std::make_unique<LocalVariable>("A32NX_RUDDER_TRAVEL_LIM_" + idString + "_ACTIVE_MODE_COMMANDED");
-    idRudderTravelLimCommandedPosition[i] = std::make_unique<LocalVariable>("A32NX_RUDDER_TRAVEL_LIM_" + idString + "_COMMANDED_POSITION");
+    idLeftAileronSolenoidEnergized[i] = std::make_unique<LocalVariable>(LEFT_AILERON_SOLENOID_ENERGIZED_NAMES[i]);
+    idLeftAileronCommandedPosition[i] = std::make_unique<LocalVariable>(LEFT_AILERON_COMMANDED_POSITION_NAMES[i]);
+    idRightAileronSolenoidEnergized[i] = std::make_unique<LocalVariable>(RIGHT_AILERON_SOLENOID_ENERGIZED_NAMES[i]);
+    idRightAileronCommandedPosition[i] = std::make_unique<LocalVariable>(RIGHT_AILERON_COMMANDED_POSITION_NAMES[i]);
+    idLeftElevatorSolenoidEnergized[i] = std::make_unique<LocalVariable>(LEFT_ELEVATOR_SOLENOID_ENERGIZED_NAMES[i]);
+    idLeftElevatorCommandedPosition[i] = std::make_unique<LocalVariable>(LEFT_ELEVATOR_COMMANDED_POSITION_NAMES[i]);
+    idRightElevatorSolenoidEnergized[i] = std::make_unique<LocalVariable>(RIGHT_ELEVATOR_SOLENOID_ENERGIZED_NAMES[i]);
+    idRightElevatorCommandedPosition[i] = std::make_unique<LocalVariable>(RIGHT_ELEVATOR_COMMANDED_POSITION_NAMES[i]);
+
+    idYawDamperSolenoidEnergized[i] = std::make_unique<LocalVariable>(YAW_DAMPER_SOLENOID_ENERGIZED_NAMES[i]);
+    idYawDamperCommandedPosition[i] = std::make_unique<LocalVariable>(YAW_DAMPER_COMMANDED_POSITION_NAMES[i]);
+    idRudderTrimActiveModeCommanded[i] = std::make_unique<LocalVariable>(RUDDER_TRIM_ACTIVE_MODE_COMMANDED_NAMES[i].data());
+    idRudderTrimCommandedPosition[i] = std::make_unique<LocalVariable>(RUDDER_TRIM_COMMANDED_POSITION_NAMES[i].data());
+    idRudderTravelLimitActiveModeCommanded[i] = std::make_unique<LocalVariable>(RUDDER_TRAVEL_LIMIT_ACTIVE_MODE_COMMANDED_NAMES[i].data());
+    idRudderTravelLimCommandedPosition[i] = std::make_unique<LocalVariable>(RUDDER_TRAVEL_LIM_COMMANDED_POSITION_NAMES[i].data());
   }
 
   for (int i = 0; i < 3; i++) {
-    std::string idString = std::to_string(i + 1);
-
-    idTHSActiveModeCommanded[i] = std::make_unique<LocalVariable>("A32NX_THS_" + idString + "_ACTIVE_MODE_COMMANDED");
-    idTHSCommandedPosition[i] = std::make_unique<LocalVariable>("A32NX_THS_" + idString + "_COMMANDED_POSITION");
+    idTHSActiveModeCommanded[i] = std::make_unique<LocalVariable>(THS_ACTIVE_MODE_COMMANDED_NAMES[i].data());
+    idTHSCommandedPosition[i] = std::make_unique<LocalVariable>(THS_COMMANDED_POSITION_NAMES[i].data());
   }
 
   for (int i = 0; i < 2; i++) {
-    std::string idString = std::to_string(i + 1);
-    idElevFaultLeft[i] = std::make_unique<LocalVariable>("A32NX_LEFT_ELEV_SERVO_" + idString + "_FAILED");
-    idElevFaultRight[i] = std::make_unique<LocalVariable>("A32NX_RIGHT_ELEV_SERVO_" + idString + "_FAILED");
-    idAilFaultLeft[i] = std::make_unique<LocalVariable>("A32NX_LEFT_AIL_SERVO_" + idString + "_FAILED");
-    idAilFaultRight[i] = std::make_unique<LocalVariable>("A32NX_RIGHT_AIL_SERVO_" + idString + "_FAILED");
+    idElevFaultLeft[i] = std::make_unique<LocalVariable>(ELEV_FAULT_LEFT_NAMES[i].data());
+    idElevFaultRight[i] = std::make_unique<LocalVariable>(ELEV_FAULT_RIGHT_NAMES[i].data());
+    idAilFaultLeft[i] = std::make_unique<LocalVariable>(AIL_FAULT_LEFT_NAMES[i].data());
+    idAilFaultRight[i] = std::make_unique<LocalVariable>(AIL_FAULT_RIGHT_NAMES[i].data());
   }
 
   for (int i = 0; i < 5; i++) {
-    std::string idString = std::to_string(i + 1);
-    idLeftSpoilerCommandedPosition[i] = std::make_unique<LocalVariable>("A32NX_LEFT_SPOILER_" + idString + "_COMMANDED_POSITION");
-    idRightSpoilerCommandedPosition[i] = std::make_unique<LocalVariable>("A32NX_RIGHT_SPOILER_" + idString + "_COMMANDED_POSITION");
+    idLeftSpoilerCommandedPosition[i] = std::make_unique<LocalVariable>(LEFT_SPOILER_COMMANDED_POSITION_NAMES[i].data());
+    idRightSpoilerCommandedPosition[i] = std::make_unique<LocalVariable>(RIGHT_SPOILER_COMMANDED_POSITION_NAMES[i].data());
 
-    idLeftSpoilerPosition[i] = std::make_unique<LocalVariable>("A32NX_HYD_SPOILER_" + idString + "_LEFT_DEFLECTION");
-    idRightSpoilerPosition[i] = std::make_unique<LocalVariable>("A32NX_HYD_SPOILER_" + idString + "_RIGHT_DEFLECTION");
+    idLeftSpoilerPosition[i] = std::make_unique<LocalVariable>(LEFT_SPOILER_POSITION_NAMES[i].data());
+    idRightSpoilerPosition[i] = std::make_unique<LocalVariable>(RIGHT_SPOILER_POSITION_NAMES[i].data());
 
-    idSplrFaultLeft[i] = std::make_unique<LocalVariable>("A32NX_LEFT_SPLR_" + idString + "_SERVO_FAILED");
-    idSplrFaultRight[i] = std::make_unique<LocalVariable>("A32NX_RIGHT_SPLR_" + idString + "_SERVO_FAILED");
+    idSplrFaultLeft[i] = std::make_unique<LocalVariable>(LEFT_SPOILER_FAULT_NAMES[i].data());
+    idSplrFaultRight[i] = std::make_unique<LocalVariable>(RIGHT_SPOILER_FAULT_NAMES[i].data());
   }
 
   idLeftAileronPosition = std::make_unique<LocalVariable>("A32NX_HYD_AILERON_LEFT_DEFLECTION");
@@ -722,7 +1004,7 @@ bool FlyByWireInterface::handleFcuInitialization(double sampleTime) {
   }
 
   // get sim data
-  auto simData = simConnectInterface.getSimData();
+  const auto& simData = simConnectInterface.getSimData();
 
   // remember simulation of ready signal
   if (simulationTimeReady == 0.0) {
@@ -772,6 +1054,112 @@ bool FlyByWireInterface::handleFcuInitialization(double sampleTime) {
   return true;
 }
 
+void FlyByWireInterface::setupFrameProfiler() {
+  frameProfiler.initialize("A32NX_FBW_PROFILER", "\\work\\FlyByWireProfile.txt", 10);
+
+  profilerStageReadData = frameProfiler.addStage("READ_DATA");
+  profilerStageAutopilotStateMachine = frameProfiler.addStage("AUTOPILOT_STATE_MACHINE");
+  profilerStageAutopilotLaws = frameProfiler.addStage("AUTOPILOT_LAWS");
+  profilerStageFlyByWire = frameProfiler.addStage("FLY_BY_WIRE");
+  profilerStageAutothrust = frameProfiler.addStage("AUTOTHRUST");
+  for (int i = 0; i < 2; i++) {
+    profilerStageElac[i] = frameProfiler.addStage("ELAC_" + std::to_string(i + 1));
+  }
+  for (int i = 0; i < 3; i++) {
+    profilerStageSec[i] = frameProfiler.addStage("SEC_" + std::to_string(i + 1));
+  }
+  for (int i = 0; i < 2; i++) {
+    profilerStageFac[i] = frameProfiler.addStage("FAC_" + std::to_string(i + 1));
+  }
+  for (int i = 0; i < 2; i++) {
+    profilerStageFcdc[i] = frameProfiler.addStage("FCDC_" + std::to_string(i + 1));
+  }
+  profilerStageDeferredWork = frameProfiler.addStage("DEFERRED_WORK");
+  profilerStageFlightDataRecorder = frameProfiler.addStage("FLIGHT_DATA_RECORDER");
+  profilerStageWriteLocalVariables = frameProfiler.addStage("WRITE_LOCAL_VARIABLES");
+}
+
+void FlyByWireInterface::setupFrameScheduler() {
+  frameScheduler.initialize(DEFERRED_WORK_BUDGET);
+
+  // stages that neither feed the laws, the computers nor the flight data recorder in the same frame, with their maximum
+  // staleness in frames. The tasks run after the additional data was updated, which FO_SIDE reads.
+  frameScheduler.addTask("ALTIMETER_SETTING", 10, [this](double sampleTime) { return updateAltimeterSetting(sampleTime); });
+  frameScheduler.addTask("FO_SIDE", 4, [this](double sampleTime) { return updateFoSide(sampleTime); });
+  // the compression and file management of the flight data recorder, the frames are buffered in the meantime
+  frameScheduler.addTask("FLIGHT_DATA_RECORDER", 20, [this](double) { return flightDataRecorder.flush(); });
+}
+
+void FlyByWireInterface::setupBusRoutes() {
+  for (int i = 0; i < 2; i++) {
+    base_elac_bus_inputs& busInputs = elacs[i].modelInputs.in.bus_inputs;
+    elacBusRouters[i].addRoute(adrBusOutputs[0], busInputs.adr_1_bus);
+    elacBusRouters[i].addRoute(adrBusOutputs[1], busInputs.adr_2_bus);
+    elacBusRouters[i].addRoute(adrBusOutputs[2], busInputs.adr_3_bus);
+    elacBusRouters[i].addRoute(irBusOutputs[0], busInputs.ir_1_bus);
+    elacBusRouters[i].addRoute(irBusOutputs[1], busInputs.ir_2_bus);
+    elacBusRouters[i].addRoute(irBusOutputs[2], busInputs.ir_3_bus);
+    elacBusRouters[i].addRoute(fmgcBBusOutputs, busInputs.fmgc_1_bus);
+    elacBusRouters[i].addRoute(fmgcBBusOutputs, busInputs.fmgc_2_bus);
+    elacBusRouters[i].addRoute(raBusOutputs[0], busInputs.ra_1_bus);
+    elacBusRouters[i].addRoute(raBusOutputs[1], busInputs.ra_2_bus);
+    elacBusRouters[i].addRoute(sfccBusOutputs[0], busInputs.sfcc_1_bus);
+    elacBusRouters[i].addRoute(sfccBusOutputs[1], busInputs.sfcc_2_bus);
+    elacBusRouters[i].addRoute(fcdcsBusOutputs[0], busInputs.fcdc_1_bus);
+    elacBusRouters[i].addRoute(fcdcsBusOutputs[1], busInputs.fcdc_2_bus);
+    elacBusRouters[i].addRoute(secsBusOutputs[0], busInputs.sec_1_bus);
+    elacBusRouters[i].addRoute(secsBusOutputs[1], busInputs.sec_2_bus);
+    elacBusRouters[i].addRoute(elacsBusOutputs[i == 0 ? 1 : 0], busInputs.elac_opp_bus);
+  }
+
+  // ADR and IR sources of the SECs: SEC 1 uses 1 and 3, SEC 2 uses 1 and 2, SEC 3 uses 2 and 3
+  const int secAdirs[3][2] = {{0, 2}, {0, 1}, {1, 2}};
+  for (int i = 0; i < 3; i++) {
+    base_sec_bus_inputs& busInputs = secs[i].modelInputs.in.bus_inputs;
+    secBusRouters[i].addRoute(adrBusOutputs[secAdirs[i][0]], busInputs.adr_1_bus);
+    secBusRouters[i].addRoute(adrBusOutputs[secAdirs[i][1]], busInputs.adr_2_bus);
+    secBusRouters[i].addRoute(irBusOutputs[secAdirs[i][0]], busInputs.ir_1_bus);
+    secBusRouters[i].addRoute(irBusOutputs[secAdirs[i][1]], busInputs.ir_2_bus);
+    secBusRouters[i].addRoute(fcdcsBusOutputs[0], busInputs.fcdc_1_bus);
+    secBusRouters[i].addRoute(fcdcsBusOutputs[1], busInputs.fcdc_2_bus);
+    secBusRouters[i].addRoute(elacsBusOutputs[0], busInputs.elac_1_bus);
+    secBusRouters[i].addRoute(elacsBusOutputs[1], busInputs.elac_2_bus);
+    secBusRouters[i].addRoute(sfccBusOutputs[0], busInputs.sfcc_1_bus);
+    secBusRouters[i].addRoute(sfccBusOutputs[1], busInputs.sfcc_2_bus);
+    secBusRouters[i].addRoute(lgciuBusOutputs[0], busInputs.lgciu_1_bus);
+    secBusRouters[i].addRoute(lgciuBusOutputs[1], busInputs.lgciu_2_bus);
+  }
+
+  for (int i = 0; i < 2; i++) {
+    FcdcBusInputs& busInputs = fcdcs[i].busInputs;
+    fcdcBusRouters[i].addRoute(elacsBusOutputs[0], busInputs.elac1);
+    fcdcBusRouters[i].addRoute(secsBusOutputs[0], busInputs.sec1);
+    fcdcBusRouters[i].addRoute(fcdcsBusOutputs[i == 0 ? 1 : 0], busInputs.fcdcOpp);
+    fcdcBusRouters[i].addRoute(elacsBusOutputs[1], busInputs.elac2);
+    fcdcBusRouters[i].addRoute(secsBusOutputs[1], busInputs.sec2);
+    fcdcBusRouters[i].addRoute(secsBusOutputs[2], busInputs.sec3);
+  }
+
+  for (int i = 0; i < 2; i++) {
+    const int own = i;
+    const int opp = i == 0 ? 1 : 0;
+    base_fac_bus_inputs& busInputs = facs[i].modelInputs.in.bus_inputs;
+    facBusRouters[i].addRoute(facsBusOutputs[opp], busInputs.fac_opp_bus);
+    facBusRouters[i].addRoute(adrBusOutputs[own], busInputs.adr_own_bus);
+    facBusRouters[i].addRoute(adrBusOutputs[opp], busInputs.adr_opp_bus);
+    facBusRouters[i].addRoute(adrBusOutputs[2], busInputs.adr_3_bus);
+    facBusRouters[i].addRoute(irBusOutputs[own], busInputs.ir_own_bus);
+    facBusRouters[i].addRoute(irBusOutputs[opp], busInputs.ir_opp_bus);
+    facBusRouters[i].addRoute(irBusOutputs[2], busInputs.ir_3_bus);
+    facBusRouters[i].addRoute(fmgcBBusOutputs, busInputs.fmgc_own_bus);
+    facBusRouters[i].addRoute(fmgcBBusOutputs, busInputs.fmgc_opp_bus);
+    facBusRouters[i].addRoute(sfccBusOutputs[own], busInputs.sfcc_own_bus);
+    facBusRouters[i].addRoute(lgciuBusOutputs[own], busInputs.lgciu_own_bus);
+    facBusRouters[i].addRoute(elacsBusOutputs[0], busInputs.elac_1_bus);
+    facBusRouters[i].addRoute(elacsBusOutputs[1], busInputs.elac_2_bus);
+  }
+}
+
 bool FlyByWireInterface::readDataAndLocalVariables(double sampleTime) {
   // set sample time
   simConnectInterface.setSampleTime(sampleTime);
@@ -798,7 +1186,7 @@ bool FlyByWireInterface::readDataAndLocalVariables(double sampleTime) {
   }
 
   // get sim data
-  SimData simData = simConnectInterface.getSimData();
+  const SimData& simData = simConnectInterface.getSimData();
 
   // update all local variables
   LocalVariable::readAll();
@@ -902,9 +1290,21 @@ bool FlyByWireInterface::updatePerformanceMonitoring(double sampleTime) {
   return true;
 }
 
+bool FlyByWireInterface::updateLocalVariableStatistics() {
+  // gauge API calls issued for local variables in the previous frame, and the writes saved by change detection and
+  // coalescing
+  LocalVariable::FrameStatistics statistics = LocalVariable::getFrameStatistics();
+  idLocalVariableReads->set(statistics.reads);
+  idLocalVariableWrites->set(statistics.writes);
+  idLocalVariableWritesAvoided->set(statistics.unchangedWrites + statistics.coalescedSets);
+
+  // success
+  return true;
+}
+
 bool FlyByWireInterface::handleSimulationRate(double sampleTime) {
   // get sim data
-  auto simData = simConnectInterface.getSimData();
+  const auto& simData = simConnectInterface.getSimData();
 
   // check if target simulation rate was modified and there is a mismatch
   if (targetSimulationRateModified && simData.simulation_rate != targetSimulationRate) {
@@ -916,6 +1316,39 @@ bool FlyByWireInterface::handleSimulationRate(double sampleTime) {
   targetSimulationRate = simData.simulation_rate;
   targetSimulationRateModified = false;
 
+  bool elac1ProtActive = false;
+  bool elac2ProtActive = false;
+
+  // the simulation rate is reduced in an abnormal situation if enabled, and never increased during one
+  bool abnormalSituation = abs(simData.Phi_deg) > 33 || simData.Theta_deg < -20 || simData.Theta_deg > 10 || elac1ProtActive ||
+                           elac2ProtActive || autopilotStateMachineOutput.speed_protection_mode == 1;
+  bool performanceWarning = idPerformanceWarningActive->get() == 1;
+
+  // step the simulation rate towards the requested one as far as the measured performance allows
+  if (simulationRateGovernorEnabled) {
+    auto command = simulationRateGovernor.update(sampleTime, frameComputeTime, simData.simulation_rate,
+                                                 min(idMaximumSimulationRate->get(), simConnectInterface.getRequestedSimulationRate()),
+                                                 !abnormalSituation && !performanceWarning, simulationRateReductionEnabled);
+    idSimulationRateGovernorMaximumRate->set(std::round(simulationRateGovernor.getMaximumSimulationRate() * 10) / 10);
+    idSimulationRateGovernorComputeTime->set(std::round(simulationRateGovernor.getComputeTime() * 1000000));
+
+    if (command == SimulationRateGovernor::Command::INCREASE) {
+      targetSimulationRateModified = true;
+      targetSimulationRate = simData.simulation_rate * 2;
+      simConnectInterface.sendEvent(SimConnectInterface::Events::SIM_RATE_INCR, 0, SIMCONNECT_GROUP_PRIORITY_DEFAULT);
+      std::cout << "WASM: Increasing simulation rate to " << targetSimulationRate;
+      std::cout << " (stable up to " << simulationRateGovernor.getMaximumSimulationRate() << ")" << std::endl;
+      return true;
+    } else if (command == SimulationRateGovernor::Command::DECREASE) {
+      targetSimulationRateModified = true;
+      targetSimulationRate = max(1, simData.simulation_rate / 2);
+      simConnectInterface.sendEvent(SimConnectInterface::Events::SIM_RATE_DECR, 0, SIMCONNECT_GROUP_PRIORITY_DEFAULT);
+      std::cout << "WASM: WARNING Reducing simulation rate to " << targetSimulationRate;
+      std::cout << " (stable up to " << simulationRateGovernor.getMaximumSimulationRate() << ")" << std::endl;
+      return true;
+    }
+  }
+
   // nothing to do if simulation rate is '1x'
   if (simData.simulation_rate == 1) {
     return true;
@@ -938,13 +1371,9 @@ bool FlyByWireInterface::handleSimulationRate(double sampleTime) {
     return true;
   }
 
-  bool elac1ProtActive = false;
-  bool elac2ProtActive = false;
-
-  // check if simulation rate should be reduced
-  if (idPerformanceWarningActive->get() == 1 || abs(simConnectInterface.getSimData().Phi_deg) > 33 ||
-      simConnectInterface.getSimData().Theta_deg < -20 || simConnectInterface.getSimData().Theta_deg > 10 || elac1ProtActive ||
-      elac2ProtActive || autopilotStateMachineOutput.speed_protection_mode == 1) {
+  // check if simulation rate should be reduced, performance issues are handled by the governor if enabled
+  bool performanceIssue = !simulationRateGovernorEnabled && performanceWarning;
+  if (performanceIssue || abnormalSituation) {
     // set target simulation rate
     targetSimulationRateModified = true;
     targetSimulationRate = max(1, simData.simulation_rate / 2);
@@ -952,6 +1381,8 @@ bool FlyByWireInterface::handleSimulationRate(double sampleTime) {
     simConnectInterface.sendEvent(SimConnectInterface::Events::SIM_RATE_DECR, 0, SIMCONNECT_GROUP_PRIORITY_DEFAULT);
     // reset low performance timer
     lowPerformanceTimer = 0;
+    // an abnormal situation is not left at the higher rate again
+    simConnectInterface.setRequestedSimulationRate(targetSimulationRate);
     // log event of reduction
     std::cout << "WASM: WARNING Reducing simulation rate from " << simData.simulation_rate;
     std::cout << " to " << simData.simulation_rate / 2;
@@ -964,7 +1395,7 @@ bool FlyByWireInterface::handleSimulationRate(double sampleTime) {
 
 bool FlyByWireInterface::updateRadioReceiver(double sampleTime) {
   // get sim data
-  auto simData = simConnectInterface.getSimData();
+  const auto& simData = simConnectInterface.getSimData();
 
   // get localizer data
   auto localizer = radioReceiver.calculateLocalizerDeviation(
@@ -996,7 +1427,7 @@ bool FlyByWireInterface::updateRadioReceiver(double sampleTime) {
 }
 
 bool FlyByWireInterface::updateAdditionalData(double sampleTime) {
-  auto simData = simConnectInterface.getSimData();
+  const auto& simData = simConnectInterface.getSimData();
   additionalData.master_warning_active = idMasterWarning->get();
   additionalData.master_caution_active = idMasterCaution->get();
   additionalData.park_brake_lever_pos = idParkBrakeLeverPos->get();
@@ -1038,9 +1469,9 @@ bool FlyByWireInterface::updateAdditionalData(double sampleTime) {
   additionalData.wingAntiIce = idWingAntiIce->get();
 
   // Fix missing data for FDR Analysis
-  auto simInputs = simConnectInterface.getSimInput();
-  auto clientDataFlyByWire = simConnectInterface.getClientDataFlyByWire();
-  auto clientDataAutothrust = simConnectInterface.getClientDataAutothrust();
+  const auto& simInputs = simConnectInterface.getSimInput();
+  const auto& clientDataFlyByWire = simConnectInterface.getClientDataFlyByWire();
+  const auto& clientDataAutothrust = simConnectInterface.getClientDataAutothrust();
 
   // controller input data
   additionalData.inputElevator = simInputs.inputs[0];
@@ -1071,7 +1502,7 @@ bool FlyByWireInterface::updateAdditionalData(double sampleTime) {
 }
 
 bool FlyByWireInterface::updateEngineData(double sampleTime) {
-  auto simData = simConnectInterface.getSimData();
+  const auto& simData = simConnectInterface.getSimData();
   engineData.generalEngineElapsedTime_1 = simData.generalEngineElapsedTime_1;
   engineData.generalEngineElapsedTime_2 = simData.generalEngineElapsedTime_2;
   engineData.standardAtmTemperature = simData.standardAtmTemperature;
@@ -1125,7 +1556,7 @@ bool FlyByWireInterface::updateEngineData(double sampleTime) {
 }
 
 bool FlyByWireInterface::updateRa(int raIndex) {
-  raBusOutputs[raIndex].radio_height_ft = Arinc429Utils::fromSimVar(idRadioAltimeterHeight[raIndex]->get());
+  raBusDecoders[raIndex].decode(raBusOutputs[raIndex]);
 
   if (clientDataEnabled) {
     simConnectInterface.setClientDataRa(raBusOutputs[raIndex], raIndex);
@@ -1135,9 +1566,7 @@ bool FlyByWireInterface::updateRa(int raIndex) {
 }
 
 bool FlyByWireInterface::updateLgciu(int lgciuIndex) {
-  lgciuBusOutputs[lgciuIndex].discrete_word_1 = Arinc429Utils::fromSimVar(idLgciuDiscreteWord1[lgciuIndex]->get());
-  lgciuBusOutputs[lgciuIndex].discrete_word_2 = Arinc429Utils::fromSimVar(idLgciuDiscreteWord2[lgciuIndex]->get());
-  lgciuBusOutputs[lgciuIndex].discrete_word_3 = Arinc429Utils::fromSimVar(idLgciuDiscreteWord3[lgciuIndex]->get());
+  lgciuBusDecoders[lgciuIndex].decode(lgciuBusOutputs[lgciuIndex]);
   lgciuBusOutputs[lgciuIndex].discrete_word_4.SSM = Arinc429SignStatus::NormalOperation;
   lgciuBusOutputs[lgciuIndex].discrete_word_4.Data = 0;
 
@@ -1149,11 +1578,7 @@ bool FlyByWireInterface::updateLgciu(int lgciuIndex) {
 }
 
 bool FlyByWireInterface::updateSfcc(int sfccIndex) {
-  sfccBusOutputs[sfccIndex].slat_flap_component_status_word = Arinc429Utils::fromSimVar(idSfccSlatFlapComponentStatusWord->get());
-  sfccBusOutputs[sfccIndex].slat_flap_system_status_word = Arinc429Utils::fromSimVar(idSfccSlatFlapSystemStatusWord->get());
-  sfccBusOutputs[sfccIndex].slat_flap_actual_position_word = Arinc429Utils::fromSimVar(idSfccSlatFlapActualPositionWord->get());
-  sfccBusOutputs[sfccIndex].slat_actual_position_deg = Arinc429Utils::fromSimVar(idSfccSlatActualPositionWord->get());
-  sfccBusOutputs[sfccIndex].flap_actual_position_deg = Arinc429Utils::fromSimVar(idSfccFlapActualPositionWord->get());
+  sfccBusDecoder.decode(sfccBusOutputs[sfccIndex]);
 
   if (clientDataEnabled) {
     simConnectInterface.setClientDataSfcc(sfccBusOutputs[sfccIndex], sfccIndex);
@@ -1163,36 +1588,8 @@ bool FlyByWireInterface::updateSfcc(int sfccIndex) {
 }
 
 bool FlyByWireInterface::updateAdirs(int adirsIndex) {
-  adrBusOutputs[adirsIndex].altitude_corrected_ft = Arinc429Utils::fromSimVar(idAdrAltitudeCorrected[adirsIndex]->get());
-  adrBusOutputs[adirsIndex].mach = Arinc429Utils::fromSimVar(idAdrMach[adirsIndex]->get());
-  adrBusOutputs[adirsIndex].airspeed_computed_kn = Arinc429Utils::fromSimVar(idAdrAirspeedComputed[adirsIndex]->get());
-  adrBusOutputs[adirsIndex].airspeed_true_kn = Arinc429Utils::fromSimVar(idAdrAirspeedTrue[adirsIndex]->get());
-  adrBusOutputs[adirsIndex].vertical_speed_ft_min = Arinc429Utils::fromSimVar(idAdrVerticalSpeed[adirsIndex]->get());
-  adrBusOutputs[adirsIndex].aoa_corrected_deg = Arinc429Utils::fromSimVar(idAdrAoaCorrected[adirsIndex]->get());
-  adrBusOutputs[adirsIndex].corrected_average_static_pressure =
-      Arinc429Utils::fromSimVar(idAdrCorrectedAverageStaticPressure[adirsIndex]->get());
-
-  irBusOutputs[adirsIndex].latitude_deg = Arinc429Utils::fromSimVar(idIrLatitude[adirsIndex]->get());
-  irBusOutputs[adirsIndex].longitude_deg = Arinc429Utils::fromSimVar(idIrLongitude[adirsIndex]->get());
-  irBusOutputs[adirsIndex].ground_speed_kn = Arinc429Utils::fromSimVar(idIrGroundSpeed[adirsIndex]->get());
-  irBusOutputs[adirsIndex].wind_speed_kn = Arinc429Utils::fromSimVar(idIrWindSpeed[adirsIndex]->get());
-  irBusOutputs[adirsIndex].wind_direction_true_deg = Arinc429Utils::fromSimVar(idIrWindDirectionTrue[adirsIndex]->get());
-  irBusOutputs[adirsIndex].track_angle_magnetic_deg = Arinc429Utils::fromSimVar(idIrTrackAngleMagnetic[adirsIndex]->get());
-  irBusOutputs[adirsIndex].heading_magnetic_deg = Arinc429Utils::fromSimVar(idIrHeadingMagnetic[adirsIndex]->get());
-  irBusOutputs[adirsIndex].drift_angle_deg = Arinc429Utils::fromSimVar(idIrDriftAngle[adirsIndex]->get());
-  irBusOutputs[adirsIndex].flight_path_angle_deg = Arinc429Utils::fromSimVar(idIrFlightPathAngle[adirsIndex]->get());
-  irBusOutputs[adirsIndex].pitch_angle_deg = Arinc429Utils::fromSimVar(idIrPitchAngle[adirsIndex]->get());
-  irBusOutputs[adirsIndex].roll_angle_deg = Arinc429Utils::fromSimVar(idIrRollAngle[adirsIndex]->get());
-  irBusOutputs[adirsIndex].body_pitch_rate_deg_s = Arinc429Utils::fromSimVar(idIrBodyPitchRate[adirsIndex]->get());
-  irBusOutputs[adirsIndex].body_roll_rate_deg_s = Arinc429Utils::fromSimVar(idIrBodyRollRate[adirsIndex]->get());
-  irBusOutputs[adirsIndex].body_yaw_rate_deg_s = Arinc429Utils::fromSimVar(idIrBodyYawRate[adirsIndex]->get());
-  irBusOutputs[adirsIndex].body_long_accel_g = Arinc429Utils::fromSimVar(idIrBodyLongAccel[adirsIndex]->get());
-  irBusOutputs[adirsIndex].body_lat_accel_g = Arinc429Utils::fromSimVar(idIrBodyLatAccel[adirsIndex]->get());
-  irBusOutputs[adirsIndex].body_normal_accel_g = Arinc429Utils::fromSimVar(idIrBodyNormalAccel[adirsIndex]->get());
-  irBusOutputs[adirsIndex].track_angle_rate_deg_s = Arinc429Utils::fromSimVar(idIrTrackAngleRate[adirsIndex]->get());
-  irBusOutputs[adirsIndex].pitch_att_rate_deg_s = Arinc429Utils::fromSimVar(idIrPitchAttRate[adirsIndex]->get());
-  irBusOutputs[adirsIndex].roll_att_rate_deg_s = Arinc429Utils::fromSimVar(idIrRollAttRate[adirsIndex]->get());
-  irBusOutputs[adirsIndex].inertial_vertical_speed_ft_s = Arinc429Utils::fromSimVar(idIrInertialVerticalSpeed[adirsIndex]->get());
+  adrBusDecoders[adirsIndex].decode(adrBusOutputs[adirsIndex]);
+  irBusDecoders[adirsIndex].decode(irBusOutputs[adirsIndex]);
 
   if (clientDataEnabled) {
     simConnectInterface.setClientDataAdr(adrBusOutputs[adirsIndex], adirsIndex);
@@ -1203,9 +1600,11 @@ bool FlyByWireInterface::updateAdirs(int adirsIndex) {
 }
 
 bool FlyByWireInterface::updateElac(double sampleTime, int elacIndex) {
+  FrameProfiler::Scope profilerScope(frameProfiler, profilerStageElac[elacIndex]);
+
   const int oppElacIndex = elacIndex == 0 ? 1 : 0;
-  SimData simData = simConnectInterface.getSimData();
-  SimInput simInput = simConnectInterface.getSimInput();
+  const SimData& simData = simConnectInterface.getSimData();
+  const SimInput& simInput = simConnectInterface.getSimInput();
 
   elacs[elacIndex].modelInputs.in.time.dt = sampleTime;
   elacs[elacIndex].modelInputs.in.time.simulation_time = simData.simulationTime;
@@ -1268,23 +1667,7 @@ bool FlyByWireInterface::updateElac(double sampleTime, int elacIndex) {
   elacs[elacIndex].modelInputs.in.analog_inputs.green_hyd_pressure_psi = idHydGreenSystemPressure->get();
   elacs[elacIndex].modelInputs.in.analog_inputs.yellow_hyd_pressure_psi = idHydYellowSystemPressure->get();
 
-  elacs[elacIndex].modelInputs.in.bus_inputs.adr_1_bus = adrBusOutputs[0];
-  elacs[elacIndex].modelInputs.in.bus_inputs.adr_2_bus = adrBusOutputs[1];
-  elacs[elacIndex].modelInputs.in.bus_inputs.adr_3_bus = adrBusOutputs[2];
-  elacs[elacIndex].modelInputs.in.bus_inputs.ir_1_bus = irBusOutputs[0];
-  elacs[elacIndex].modelInputs.in.bus_inputs.ir_2_bus = irBusOutputs[1];
-  elacs[elacIndex].modelInputs.in.bus_inputs.ir_3_bus = irBusOutputs[2];
-  elacs[elacIndex].modelInputs.in.bus_inputs.fmgc_1_bus = fmgcBBusOutputs;
-  elacs[elacIndex].modelInputs.in.bus_inputs.fmgc_2_bus = fmgcBBusOutputs;
-  elacs[elacIndex].modelInputs.in.bus_inputs.ra_1_bus = raBusOutputs[0];
-  elacs[elacIndex].modelInputs.in.bus_inputs.ra_2_bus = raBusOutputs[1];
-  elacs[elacIndex].modelInputs.in.bus_inputs.sfcc_1_bus = sfccBusOutputs[0];
-  elacs[elacIndex].modelInputs.in.bus_inputs.sfcc_2_bus = sfccBusOutputs[1];
-  elacs[elacIndex].modelInputs.in.bus_inputs.fcdc_1_bus = fcdcsBusOutputs[0];
-  elacs[elacIndex].modelInputs.in.bus_inputs.fcdc_2_bus = fcdcsBusOutputs[1];
-  elacs[elacIndex].modelInputs.in.bus_inputs.sec_1_bus = secsBusOutputs[0];
-  elacs[elacIndex].modelInputs.in.bus_inputs.sec_2_bus = secsBusOutputs[1];
-  elacs[elacIndex].modelInputs.in.bus_inputs.elac_opp_bus = elacsBusOutputs[oppElacIndex];
+  elacBusRouters[elacIndex].route();
 
   if (elacIndex == elacDisabled) {
     simConnectInterface.setClientDataElacDiscretes(elacs[elacIndex].modelInputs.in.discrete_inputs);
@@ -1320,9 +1703,11 @@ bool FlyByWireInterface::updateElac(double sampleTime, int elacIndex) {
 }
 
 bool FlyByWireInterface::updateSec(double sampleTime, int secIndex) {
+  FrameProfiler::Scope profilerScope(frameProfiler, profilerStageSec[secIndex]);
+
   const int oppSecIndex = secIndex == 0 ? 1 : 0;
-  SimData simData = simConnectInterface.getSimData();
-  SimInput simInput = simConnectInterface.getSimInput();
+  const SimData& simData = simConnectInterface.getSimData();
+  const SimInput& simInput = simConnectInterface.getSimInput();
 
   secs[secIndex].modelInputs.in.time.dt = sampleTime;
   secs[secIndex].modelInputs.in.time.simulation_time = simData.simulationTime;
@@ -1413,31 +1798,7 @@ bool FlyByWireInterface::updateSec(double sampleTime, int secIndex) {
   secs[secIndex].modelInputs.in.analog_inputs.wheel_speed_left = simData.wheelRpmLeft * 0.118921;
   secs[secIndex].modelInputs.in.analog_inputs.wheel_speed_right = simData.wheelRpmRight * 0.118921;
 
-  if (secIndex == 0) {
-    secs[secIndex].modelInputs.in.bus_inputs.adr_1_bus = adrBusOutputs[0];
-    secs[secIndex].modelInputs.in.bus_inputs.adr_2_bus = adrBusOutputs[2];
-    secs[secIndex].modelInputs.in.bus_inputs.ir_1_bus = irBusOutputs[0];
-    secs[secIndex].modelInputs.in.bus_inputs.ir_2_bus = irBusOutputs[2];
-  } else if (secIndex == 1) {
-    secs[secIndex].modelInputs.in.bus_inputs.adr_1_bus = adrBusOutputs[0];
-    secs[secIndex].modelInputs.in.bus_inputs.adr_2_bus = adrBusOutputs[1];
-    secs[secIndex].modelInputs.in.bus_inputs.ir_1_bus = irBusOutputs[0];
-    secs[secIndex].modelInputs.in.bus_inputs.ir_2_bus = irBusOutputs[1];
-  } else if (secIndex == 2) {
-    secs[secIndex].modelInputs.in.bus_inputs.adr_1_bus = adrBusOutputs[1];
-    secs[secIndex].modelInputs.in.bus_inputs.adr_2_bus = adrBusOutputs[2];
-    secs[secIndex].modelInputs.in.bus_inputs.ir_1_bus = irBusOutputs[1];
-    secs[secIndex].modelInputs.in.bus_inputs.ir_2_bus = irBusOutputs[2];
-  }
-
-  secs[secIndex].modelInputs.in.bus_inputs.fcdc_1_bus = fcdcsBusOutputs[0];
-  secs[secIndex].modelInputs.in.bus_inputs.fcdc_2_bus = fcdcsBusOutputs[1];
-  secs[secIndex].modelInputs.in.bus_inputs.elac_1_bus = elacsBusOutputs[0];
-  secs[secIndex].modelInputs.in.bus_inputs.elac_2_bus = elacsBusOutputs[1];
-  secs[secIndex].modelInputs.in.bus_inputs.sfcc_1_bus = sfccBusOutputs[0];
-  secs[secIndex].modelInputs.in.bus_inputs.sfcc_2_bus = sfccBusOutputs[1];
-  secs[secIndex].modelInputs.in.bus_inputs.lgciu_1_bus = lgciuBusOutputs[0];
-  secs[secIndex].modelInputs.in.bus_inputs.lgciu_2_bus = lgciuBusOutputs[1];
+  secBusRouters[secIndex].route();
 
   if (secIndex == secDisabled) {
     simConnectInterface.setClientDataSecDiscretes(secs[secIndex].modelInputs.in.discrete_inputs);
@@ -1474,6 +1835,8 @@ bool FlyByWireInterface::updateSec(double sampleTime, int secIndex) {
 }
 
 bool FlyByWireInterface::updateFcdc(double sampleTime, int fcdcIndex) {
+  FrameProfiler::Scope profilerScope(frameProfiler, profilerStageFcdc[fcdcIndex]);
+
   const int oppFcdcIndex = fcdcIndex == 0 ? 1 : 0;
 
   fcdcs[fcdcIndex].discreteInputs.elac1Off = !idElacPushbuttonPressed[0]->get();
@@ -1491,12 +1854,7 @@ bool FlyByWireInterface::updateFcdc(double sampleTime, int fcdcIndex) {
   fcdcs[fcdcIndex].discreteInputs.elac2Off = !idElacPushbuttonPressed[1]->get();
   fcdcs[fcdcIndex].discreteInputs.sec2Off = !idSecPushbuttonPressed[1]->get();
 
-  fcdcs[fcdcIndex].busInputs.elac1 = elacsBusOutputs[0];
-  fcdcs[fcdcIndex].busInputs.sec1 = secsBusOutputs[0];
-  fcdcs[fcdcIndex].busInputs.fcdcOpp = fcdcsBusOutputs[oppFcdcIndex];
-  fcdcs[fcdcIndex].busInputs.elac2 = elacsBusOutputs[1];
-  fcdcs[fcdcIndex].busInputs.sec2 = secsBusOutputs[1];
-  fcdcs[fcdcIndex].busInputs.sec3 = secsBusOutputs[2];
+  fcdcBusRouters[fcdcIndex].route();
 
   fcdcs[fcdcIndex].update(sampleTime, failuresConsumer.isActive(fcdcIndex == 0 ? Failures::Fcdc1 : Failures::Fcdc2),
                           fcdcIndex == 0 ? idElecDcEssShedBusPowered->get() : idElecDcBus2Powered->get());
@@ -1540,9 +1898,11 @@ bool FlyByWireInterface::updateFcdc(double sampleTime, int fcdcIndex) {
 }
 
 bool FlyByWireInterface::updateFac(double sampleTime, int facIndex) {
+  FrameProfiler::Scope profilerScope(frameProfiler, profilerStageFac[facIndex]);
+
   const int oppFacIndex = facIndex == 0 ? 1 : 0;
-  SimData simData = simConnectInterface.getSimData();
-  SimInputRudderTrim trimInput = simConnectInterface.getSimInputRudderTrim();
+  const SimData& simData = simConnectInterface.getSimData();
+  const SimInputRudderTrim& trimInput = simConnectInterface.getSimInputRudderTrim();
 
   facs[facIndex].modelInputs.in.time.dt = sampleTime;
   facs[facIndex].modelInputs.in.time.simulation_time = simData.simulationTime;
@@ -1583,19 +1943,7 @@ bool FlyByWireInterface::updateFac(double sampleTime, int facIndex) {
   facs[facIndex].modelInputs.in.analog_inputs.rudder_trim_position_deg = -idRudderTrimPosition->get();
   facs[facIndex].modelInputs.in.analog_inputs.rudder_travel_lim_position_deg = idRudderTravelLimiterPosition->get();
 
-  facs[facIndex].modelInputs.in.bus_inputs.fac_opp_bus = facsBusOutputs[oppFacIndex];
-  facs[facIndex].modelInputs.in.bus_inputs.adr_own_bus = facIndex == 0 ? adrBusOutputs[0] : adrBusOutputs[1];
-  facs[facIndex].modelInputs.in.bus_inputs.adr_opp_bus = facIndex == 0 ? adrBusOutputs[1] : adrBusOutputs[0];
-  facs[facIndex].modelInputs.in.bus_inputs.adr_3_bus = adrBusOutputs[2];
-  facs[facIndex].modelInputs.in.bus_inputs.ir_own_bus = facIndex == 0 ? irBusOutputs[0] : irBusOutputs[1];
-  facs[facIndex].modelInputs.in.bus_inputs.ir_opp_bus = facIndex == 0 ? irBusOutputs[1] : irBusOutputs[0];
-  facs[facIndex].modelInputs.in.bus_inputs.ir_3_bus = irBusOutputs[2];
-  facs[facIndex].modelInputs.in.bus_inputs.fmgc_own_bus = fmgcBBusOutputs;
-  facs[facIndex].modelInputs.in.bus_inputs.fmgc_opp_bus = fmgcBBusOutputs;
-  facs[facIndex].modelInputs.in.bus_inputs.sfcc_own_bus = sfccBusOutputs[facIndex];
-  facs[facIndex].modelInputs.in.bus_inputs.lgciu_own_bus = lgciuBusOutputs[facIndex];
-  facs[facIndex].modelInputs.in.bus_inputs.elac_1_bus = elacsBusOutputs[0];
-  facs[facIndex].modelInputs.in.bus_inputs.elac_2_bus = elacsBusOutputs[1];
+  facBusRouters[facIndex].route();
 
   if (facIndex == facDisabled) {
     simConnectInterface.setClientDataFacDiscretes(facs[facIndex].modelInputs.in.discrete_inputs);
@@ -1724,10 +2072,12 @@ bool FlyByWireInterface::updateServoSolenoidStatus() {
 }
 
 bool FlyByWireInterface::updateAutopilotStateMachine(double sampleTime) {
+  FrameProfiler::Scope profilerScope(frameProfiler, profilerStageAutopilotStateMachine);
+
   // get data from interface ------------------------------------------------------------------------------------------
-  SimData simData = simConnectInterface.getSimData();
-  SimInput simInput = simConnectInterface.getSimInput();
-  SimInputAutopilot simInputAutopilot = simConnectInterface.getSimInputAutopilot();
+  const SimData& simData = simConnectInterface.getSimData();
+  const SimInput& simInput = simConnectInterface.getSimInput();
+  const SimInputAutopilot& simInputAutopilot = simConnectInterface.getSimInputAutopilot();
 
   // determine disconnection conditions -------------------------------------------------------------------------------
 
@@ -1874,7 +2224,7 @@ bool FlyByWireInterface::updateAutopilotStateMachine(double sampleTime) {
     autopilotStateMachineOutput = autopilotStateMachine.getExternalOutputs().out.output;
   } else {
     // read client data written by simulink
-    ClientDataAutopilotStateMachine clientData = simConnectInterface.getClientDataAutopilotStateMachine();
+    const ClientDataAutopilotStateMachine& clientData = simConnectInterface.getClientDataAutopilotStateMachine();
     autopilotStateMachineOutput.enabled_AP1 = clientData.enabled_AP1;
     autopilotStateMachineOutput.enabled_AP2 = clientData.enabled_AP2;
     autopilotStateMachineOutput.lateral_law = clientData.lateral_law;
@@ -2084,8 +2434,10 @@ bool FlyByWireInterface::updateAutopilotStateMachine(double sampleTime) {
 }
 
 bool FlyByWireInterface::updateAutopilotLaws(double sampleTime) {
+  FrameProfiler::Scope profilerScope(frameProfiler, profilerStageAutopilotLaws);
+
   // get data from interface ------------------------------------------------------------------------------------------
-  SimData simData = simConnectInterface.getSimData();
+  const SimData& simData = simConnectInterface.getSimData();
 
   // update laws ------------------------------------------------------------------------------------------------------
   if (autopilotLawsEnabled) {
@@ -2224,7 +2576,7 @@ bool FlyByWireInterface::updateAutopilotLaws(double sampleTime) {
       simConnectInterface.setClientDataAutopilotStateMachine(clientDataStateMachine);
     }
     // read client data written by simulink
-    ClientDataAutopilotLaws clientDataLaws = simConnectInterface.getClientDataAutopilotLaws();
+    const ClientDataAutopilotLaws& clientDataLaws = simConnectInterface.getClientDataAutopilotLaws();
     autopilotLawsOutput.ap_on = clientDataLaws.enableAutopilot;
     autopilotLawsOutput.flight_director.Theta_c_deg = clientDataLaws.flightDirectorTheta;
     autopilotLawsOutput.autopilot.Theta_c_deg = clientDataLaws.autopilotTheta;
@@ -2286,9 +2638,11 @@ bool FlyByWireInterface::updateAutopilotLaws(double sampleTime) {
 }
 
 bool FlyByWireInterface::updateFlyByWire(double sampleTime) {
+  FrameProfiler::Scope profilerScope(frameProfiler, profilerStageFlyByWire);
+
   // get data from interface ------------------------------------------------------------------------------------------
-  SimData simData = simConnectInterface.getSimData();
-  SimInput simInput = simConnectInterface.getSimInput();
+  const SimData& simData = simConnectInterface.getSimData();
+  const SimInput& simInput = simConnectInterface.getSimInput();
 
   // write sidestick position
   idSideStickPositionX->set(-1.0 * simInput.inputs[1]);
@@ -2312,8 +2666,10 @@ bool FlyByWireInterface::updateFlyByWire(double sampleTime) {
 }
 
 bool FlyByWireInterface::updateAutothrust(double sampleTime) {
+  FrameProfiler::Scope profilerScope(frameProfiler, profilerStageAutothrust);
+
   // get sim data
-  SimData simData = simConnectInterface.getSimData();
+  const SimData& simData = simConnectInterface.getSimData();
 
   // set ground / flight for throttle handling
   if (idLgciuLeftMainGearCompressed[0]->get() || idLgciuLeftMainGearCompressed[1]->get() || idLgciuRightMainGearCompressed[0]->get() ||
@@ -2458,7 +2814,7 @@ bool FlyByWireInterface::updateAutothrust(double sampleTime) {
     }
   } else {
     // read data from client data
-    ClientDataAutothrust clientData = simConnectInterface.getClientDataAutothrust();
+    const ClientDataAutothrust& clientData = simConnectInterface.getClientDataAutothrust();
     autoThrustOutput.N1_TLA_1_percent = clientData.N1_TLA_1_percent;
     autoThrustOutput.N1_TLA_2_percent = clientData.N1_TLA_2_percent;
     autoThrustOutput.is_in_reverse_1 = clientData.is_in_reverse_1;
@@ -2504,7 +2860,7 @@ bool FlyByWireInterface::updateAutothrust(double sampleTime) {
 
 bool FlyByWireInterface::updateSpoilers(double sampleTime) {
   // get sim data
-  auto simData = simConnectInterface.getSimData();
+  const auto& simData = simConnectInterface.getSimData();
 
   // initialize position if needed
   if (!spoilersHandler->getIsInitialized()) {
@@ -2521,7 +2877,7 @@ bool FlyByWireInterface::updateSpoilers(double sampleTime) {
 
 bool FlyByWireInterface::updateAltimeterSetting(double sampleTime) {
   // get sim data
-  auto simData = simConnectInterface.getSimData();
+  const auto& simData = simConnectInterface.getSimData();
 
   // determine if change is needed
   if (simData.kohlsmanSettingStd_3 == 0) {
@@ -2535,7 +2891,7 @@ bool FlyByWireInterface::updateAltimeterSetting(double sampleTime) {
 
 bool FlyByWireInterface::updateFoSide(double sampleTime) {
   // get sim data
-  auto simData = simConnectInterface.getSimData();
+  const auto& simData = simConnectInterface.getSimData();
 
   // FD Button
   if (additionalData.syncFoEfisEnabled && simData.ap_fd_1_active != simData.ap_fd_2_active) {
@@ -9,8 +9,6 @@ Elac::Elac(const Elac& obj) : isUnit1(obj.isUnit1) {
   elacComputer.initialize();
 }
 
-void Elac::clearMemory() {}
-
 // If the power supply is valid, perform the self-test-sequence.
 // If at least one hydraulic source is pressurised, perform a short test.
 // If no hydraulic supply is pressurised, and the outage was more than 3 seconds (or the switch was turned off),
@@ -36,10 +34,13 @@ void Elac::update(double deltaTime, double simulationTime, bool faultActive, boo
   updateSelfTest(deltaTime);
   monitorSelf(faultActive);
 
-  elacComputer.setExternalInputs(&modelInputs);
+  if (modelStepGate.update(modelInputs.in.sim_data.computer_running)) {
+    elacComputer.setExternalInputs(&modelInputs);
+    elacComputer.step();
+    modelOutputs = elacComputer.getExternalOutputs().out;
+  }
+  // the model gets the running state with the inputs of the next frame
   modelInputs.in.sim_data.computer_running = monitoringHealthy;
-  elacComputer.step();
-  modelOutputs = elacComputer.getExternalOutputs().out;
 }
 
 // Perform self monitoring
@@ -159,3 +160,17 @@ base_elac_analog_outputs Elac::getAnalogOutputs() {
 
   return output;
 }
+
+// Save the model and computer state (self-monitoring, power supply and self-test vars) into the arena.
+bool Elac::saveState(SnapshotArena& arena) const {
+  return arena.save(elacComputer) && arena.save(modelInputs) && arena.save(modelOutputs) && arena.save(monitoringHealthy) &&
+         arena.save(prevEngageButtonWasPressed) && arena.save(powerSupplyOutageTime) && arena.save(powerSupplyFault) &&
+         arena.save(selfTestTimer) && arena.save(selfTestComplete) && arena.save(modelStepGate);
+}
+
+// Restore the state saved by saveState, in the same order.
+bool Elac::restoreState(SnapshotArena& arena) {
+  return arena.restore(elacComputer) && arena.restore(modelInputs) && arena.restore(modelOutputs) && arena.restore(monitoringHealthy) &&
+         arena.restore(prevEngageButtonWasPressed) && arena.restore(powerSupplyOutageTime) && arena.restore(powerSupplyFault) &&
+         arena.restore(selfTestTimer) && arena.restore(selfTestComplete) && arena.restore(modelStepGate);
+}
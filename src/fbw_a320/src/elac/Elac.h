@@ -6,8 +6,10 @@
 #include "../model/ElacComputer.h"
 #include "../utils/ConfirmNode.h"
 #include "../utils/HysteresisNode.h"
+#include "../utils/ModelStepGate.h"
 #include "../utils/PulseNode.h"
 #include "../utils/SRFlipFlop.h"
+#include "SnapshotArena.h"
 
 class Elac {
  public:
@@ -23,13 +25,15 @@ class Elac {
 
   base_elac_analog_outputs getAnalogOutputs();
 
+  bool saveState(SnapshotArena& arena) const;
+
+  bool restoreState(SnapshotArena& arena);
+
   ElacComputer::ExternalInputs_ElacComputer_T modelInputs = {};
 
  private:
   void initSelfTests(bool viaPushButton);
 
-  void clearMemory();
-
   void monitorButtonStatus();
 
   void monitorPowerSupply(double deltaTime, bool isPowered);
@@ -45,6 +49,8 @@ class Elac {
   // Computer Self-monitoring vars
   bool monitoringHealthy;
 
+  ModelStepGate modelStepGate;
+
   bool prevEngageButtonWasPressed;
 
   // Power Supply monitoring
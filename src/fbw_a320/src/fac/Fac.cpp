@@ -18,7 +18,7 @@ void Fac::update(double deltaTime, double simulationTime, bool faultActive, bool
   updateSelfTest(deltaTime);
   monitorSelf(faultActive);
 
-  if (!shortPowerFailure) {
+  if (!shortPowerFailure && modelStepGate.update(modelInputs.in.sim_data.computer_running)) {
     facComputer.setExternalInputs(&modelInputs);
     facComputer.step();
     modelOutputs = facComputer.getExternalOutputs().out;
@@ -153,3 +153,19 @@ base_fac_analog_outputs Fac::getAnalogOutputs() {
 
   return output;
 }
+
+// Save the model and computer state (self-monitoring, power supply and self-test vars) into the arena.
+bool Fac::saveState(SnapshotArena& arena) const {
+  return arena.save(facComputer) && arena.save(modelInputs) && arena.save(modelOutputs) && arena.save(facHealthy) &&
+         arena.save(facHealthyFlipFlop) && arena.save(pushbuttonPulse) && arena.save(powerSupplyOutageTime) &&
+         arena.save(longPowerFailure) && arena.save(shortPowerFailure) && arena.save(selfTestTimer) && arena.save(selfTestComplete) &&
+         arena.save(modelStepGate);
+}
+
+// Restore the state saved by saveState, in the same order.
+bool Fac::restoreState(SnapshotArena& arena) {
+  return arena.restore(facComputer) && arena.restore(modelInputs) && arena.restore(modelOutputs) && arena.restore(facHealthy) &&
+         arena.restore(facHealthyFlipFlop) && arena.restore(pushbuttonPulse) && arena.restore(powerSupplyOutageTime) &&
+         arena.restore(longPowerFailure) && arena.restore(shortPowerFailure) && arena.restore(selfTestTimer) &&
+         arena.restore(selfTestComplete) && arena.restore(modelStepGate);
+}
@@ -2,9 +2,11 @@
 
 #include "../Arinc429.h"
 #include "../model/FacComputer.h"
+#include "../utils/ModelStepGate.h"
 #include "../utils/PulseNode.h"
 #include "../utils/SRFlipFlop.h"
 #include "FacIO.h"
+#include "SnapshotArena.h"
 
 class Fac {
  public:
@@ -20,6 +22,10 @@ class Fac {
 
   base_fac_analog_outputs getAnalogOutputs();
 
+  bool saveState(SnapshotArena& arena) const;
+
+  bool restoreState(SnapshotArena& arena);
+
   FacComputer::ExternalInputs_FacComputer_T modelInputs = {};
 
  private:
@@ -40,6 +46,8 @@ class Fac {
   // Computer Self-monitoring vars
   bool facHealthy;
 
+  ModelStepGate modelStepGate;
+
   SRFlipFlop facHealthyFlipFlop = SRFlipFlop(false);
 
   PulseNode pushbuttonPulse = PulseNode(true);
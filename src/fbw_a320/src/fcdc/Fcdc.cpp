@@ -795,3 +795,42 @@ FcdcDiscreteOutputs Fcdc::getDiscreteOutputs() {
 
   return output;
 }
+
+// Save the computer state (engagement, consolidated data, priority logic, monitoring and self-test vars) into the arena.
+bool Fcdc::saveState(SnapshotArena& arena) const {
+  return arena.save(discreteInputs) && arena.save(busInputs) && arena.save(elac1EngagedInRoll) && arena.save(elac2EngagedInRoll) &&
+         arena.save(sec1EngagedInRoll) && arena.save(sec2EngagedInRoll) && arena.save(sec3EngagedInRoll) &&
+         arena.save(elac1EngagedInPitch) && arena.save(elac2EngagedInPitch) && arena.save(sec1EngagedInPitch) &&
+         arena.save(sec2EngagedInPitch) && arena.save(systemPitchLaw) && arena.save(systemLateralLaw) && arena.save(leftAileronPos) &&
+         arena.save(leftAileronPosValid) && arena.save(rightAileronPos) && arena.save(rightAileronPosValid) &&
+         arena.save(leftElevatorPos) && arena.save(leftElevatorPosValid) && arena.save(rightElevatorPos) &&
+         arena.save(rightElevatorPosValid) && arena.save(thsPos) && arena.save(thsPosValid) && arena.save(rollSidestickPosCapt) &&
+         arena.save(rollSidestickPosCaptValid) && arena.save(rollSidestickPosFo) && arena.save(rollSidestickPosFoValid) &&
+         arena.save(pitchSidestickPosCapt) && arena.save(pitchSidestickPosCaptValid) && arena.save(pitchSidestickPosFo) &&
+         arena.save(pitchSidestickPosFoValid) && arena.save(rudderPedalPos) && arena.save(rudderPedalPosValid) &&
+         arena.save(leftSidestickDisabled) && arena.save(rightSidestickDisabled) && arena.save(leftSidestickPriorityLocked) &&
+         arena.save(rightSidestickPriorityLocked) && arena.save(leftRedPriorityLightOn) && arena.save(rightRedPriorityLightOn) &&
+         arena.save(leftGreenPriorityLightOn) && arena.save(rightGreenPriorityLightOn) && arena.save(priorityLightFlashingClock) &&
+         arena.save(monitoringHealthy) && arena.save(powerSupplyOutageTime) && arena.save(powerSupplyFault) && arena.save(selfTestTimer) &&
+         arena.save(selfTestComplete);
+}
+
+// Restore the state saved by saveState, in the same order.
+bool Fcdc::restoreState(SnapshotArena& arena) {
+  return arena.restore(discreteInputs) && arena.restore(busInputs) && arena.restore(elac1EngagedInRoll) &&
+         arena.restore(elac2EngagedInRoll) && arena.restore(sec1EngagedInRoll) && arena.restore(sec2EngagedInRoll) &&
+         arena.restore(sec3EngagedInRoll) && arena.restore(elac1EngagedInPitch) && arena.restore(elac2EngagedInPitch) &&
+         arena.restore(sec1EngagedInPitch) && arena.restore(sec2EngagedInPitch) && arena.restore(systemPitchLaw) &&
+         arena.restore(systemLateralLaw) && arena.restore(leftAileronPos) && arena.restore(leftAileronPosValid) &&
+         arena.restore(rightAileronPos) && arena.restore(rightAileronPosValid) && arena.restore(leftElevatorPos) &&
+         arena.restore(leftElevatorPosValid) && arena.restore(rightElevatorPos) && arena.restore(rightElevatorPosValid) &&
+         arena.restore(thsPos) && arena.restore(thsPosValid) && arena.restore(rollSidestickPosCapt) &&
+         arena.restore(rollSidestickPosCaptValid) && arena.restore(rollSidestickPosFo) && arena.restore(rollSidestickPosFoValid) &&
+         arena.restore(pitchSidestickPosCapt) && arena.restore(pitchSidestickPosCaptValid) && arena.restore(pitchSidestickPosFo) &&
+         arena.restore(pitchSidestickPosFoValid) && arena.restore(rudderPedalPos) && arena.restore(rudderPedalPosValid) &&
+         arena.restore(leftSidestickDisabled) && arena.restore(rightSidestickDisabled) && arena.restore(leftSidestickPriorityLocked) &&
+         arena.restore(rightSidestickPriorityLocked) && arena.restore(leftRedPriorityLightOn) && arena.restore(rightRedPriorityLightOn) &&
+         arena.restore(leftGreenPriorityLightOn) && arena.restore(rightGreenPriorityLightOn) && arena.restore(priorityLightFlashingClock) &&
+         arena.restore(monitoringHealthy) && arena.restore(powerSupplyOutageTime) && arena.restore(powerSupplyFault) &&
+         arena.restore(selfTestTimer) && arena.restore(selfTestComplete);
+}
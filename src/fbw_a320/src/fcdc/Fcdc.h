@@ -1,6 +1,7 @@
 #pragma once
 
 #include "FcdcIO.h"
+#include "SnapshotArena.h"
 
 const double LIGHT_FLASHING_PERIOD = 0.25;
 
@@ -14,6 +15,10 @@ class Fcdc {
 
   FcdcDiscreteOutputs getDiscreteOutputs();
 
+  bool saveState(SnapshotArena& arena) const;
+
+  bool restoreState(SnapshotArena& arena);
+
   FcdcDiscreteInputs discreteInputs;
 
   FcdcBusInputs busInputs;
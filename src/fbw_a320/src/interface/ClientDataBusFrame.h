@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "../model/ElacComputer_types.h"
+#include "../model/FacComputer_types.h"
+#include "../model/SecComputer_types.h"
+
+// All outbound bus words of a frame in split-computer mode and the discrete and analog inputs of the disabled ELAC, SEC
+// and FAC, written into one client data area instead of one area per bus or input block. The version has to be raised
+// whenever the layout changes, the sequence counts the written frames.
+struct ClientDataBusFrame {
+  static constexpr uint32_t VERSION = 2;
+
+  uint32_t version;
+  uint32_t sequence;
+  base_adr_bus adr[3];
+  base_ir_bus ir[3];
+  base_ra_bus ra[2];
+  base_lgciu_bus lgciu[2];
+  base_sfcc_bus sfcc[2];
+  base_fmgc_b_bus fmgcB[2];
+  base_elac_out_bus elac[2];
+  base_sec_out_bus sec[2];
+  base_fac_bus fac[2];
+  base_elac_discrete_inputs elacDiscreteInputs;
+  base_elac_analog_inputs elacAnalogInputs;
+  base_sec_discrete_inputs secDiscreteInputs;
+  base_sec_analog_inputs secAnalogInputs;
+  base_fac_discrete_inputs facDiscreteInputs;
+  base_fac_analog_inputs facAnalogInputs;
+};
+
+static_assert(std::is_trivially_copyable<ClientDataBusFrame>::value, "bus frame is sent as raw bytes");
+// a client data area holds at most 8 kB
+static_assert(sizeof(ClientDataBusFrame) <= 8192, "bus frame does not fit into a client data area");
+
+// Receiving side of the bus frame, used by the loopback and as reference for the external side. Frames with an unknown
+// layout are rejected, frames missing in the sequence are counted.
+class ClientDataBusFrameReceiver {
+ public:
+  bool receive(const ClientDataBusFrame& received) {
+    if (received.version != ClientDataBusFrame::VERSION) {
+      return false;
+    }
+    // a lower sequence means the sender was restarted
+    if (receivedFrames > 0 && received.sequence > frame.sequence + 1) {
+      lostFrames += received.sequence - frame.sequence - 1;
+    }
+    frame = received;
+    receivedFrames++;
+    return true;
+  }
+
+  const ClientDataBusFrame& getFrame() const { return frame; }
+
+  uint32_t getReceivedFrames() const { return receivedFrames; }
+
+  uint32_t getLostFrames() const { return lostFrames; }
+
+ private:
+  ClientDataBusFrame frame = {};
+  uint32_t receivedFrames = 0;
+  uint32_t lostFrames = 0;
+};
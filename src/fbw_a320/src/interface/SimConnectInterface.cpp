@@ -12,6 +12,8 @@ SimInput SimConnectInterface::simInput = {};
 double SimConnectInterface::flightControlsKeyChangeAileron = 0.0;
 
 bool SimConnectInterface::connect(bool clientDataEnabled,
+                                  bool clientDataPacked,
+                                  bool clientDataLoopback,
                                   bool autopilotStateMachineEnabled,
                                   bool autopilotLawsEnabled,
                                   bool flyByWireEnabled,
@@ -47,6 +49,8 @@ bool SimConnectInterface::connect(bool clientDataEnabled,
     this->limitSimulationRateByPerformance = limitSimulationRateByPerformance;
     // store is client data is enabled
     this->clientDataEnabled = clientDataEnabled;
+    this->clientDataPacked = clientDataPacked;
+    this->clientDataLoopback = clientDataLoopback;
     this->elacDisabled = elacDisabled;
     this->secDisabled = secDisabled;
     this->facDisabled = facDisabled;
@@ -114,6 +118,14 @@ void SimConnectInterface::updateSimulationRateLimits(double minSimulationRate, d
   this->maxSimulationRate = maxSimulationRate;
 }
 
+double SimConnectInterface::getRequestedSimulationRate() const {
+  return requestedSimulationRate;
+}
+
+void SimConnectInterface::setRequestedSimulationRate(double simulationRate) {
+  requestedSimulationRate = simulationRate;
+}
+
 bool SimConnectInterface::prepareSimDataSimConnectDataDefinitions() {
   bool result = true;
 
@@ -1078,6 +1090,24 @@ bool SimConnectInterface::prepareClientDataDefinitions() {
 
   // ------------------------------------------------------------------------------------------------------------------
 
+  if (clientDataPacked) {
+    // map client id
+    result &= SimConnect_MapClientDataNameToID(hSimConnect, "A32NX_CLIENT_DATA_BUS_FRAME", ClientData::BUS_FRAME);
+    // create client data
+    result &= SimConnect_CreateClientData(hSimConnect, ClientData::BUS_FRAME, sizeof(ClientDataBusFrame),
+                                          SIMCONNECT_CREATE_CLIENT_DATA_FLAG_DEFAULT);
+    // add data definitions, the frame is a single block of bytes
+    result &= SimConnect_AddToClientDataDefinition(hSimConnect, ClientData::BUS_FRAME, 0, sizeof(ClientDataBusFrame));
+
+    // request data to be updated when set, the loopback receives its own frames
+    if (clientDataLoopback) {
+      result &= SimConnect_RequestClientData(hSimConnect, ClientData::BUS_FRAME, ClientData::BUS_FRAME, ClientData::BUS_FRAME,
+                                             SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET);
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------------------------------
+
   // return result
   return SUCCEEDED(result);
 }
@@ -1195,23 +1225,23 @@ bool SimConnectInterface::setClientDataLocalVariablesAutothrust(ClientDataLocalV
   return sendClientData(ClientData::LOCAL_VARIABLES_AUTOTHRUST, sizeof(output), &output);
 }
 
-SimData SimConnectInterface::getSimData() {
+const SimData& SimConnectInterface::getSimData() const {
   return simData;
 }
 
-SimInput SimConnectInterface::getSimInput() {
+const SimInput& SimConnectInterface::getSimInput() const {
   return simInput;
 }
 
-SimInputAutopilot SimConnectInterface::getSimInputAutopilot() {
+const SimInputAutopilot& SimConnectInterface::getSimInputAutopilot() const {
   return simInputAutopilot;
 }
 
-SimInputRudderTrim SimConnectInterface::getSimInputRudderTrim() {
+const SimInputRudderTrim& SimConnectInterface::getSimInputRudderTrim() const {
   return simInputRudderTrim;
 }
 
-SimInputThrottles SimConnectInterface::getSimInputThrottles() {
+const SimInputThrottles& SimConnectInterface::getSimInputThrottles() const {
   return simInputThrottles;
 }
 
@@ -1249,7 +1279,7 @@ bool SimConnectInterface::setClientDataAutopilotLaws(ClientDataAutopilotLaws out
   return sendClientData(ClientData::AUTOPILOT_LAWS, sizeof(output), &output);
 }
 
-ClientDataAutopilotLaws SimConnectInterface::getClientDataAutopilotLaws() {
+const ClientDataAutopilotLaws& SimConnectInterface::getClientDataAutopilotLaws() const {
   return clientDataAutopilotLaws;
 }
 
@@ -1258,40 +1288,64 @@ bool SimConnectInterface::setClientDataAutopilotStateMachine(ClientDataAutopilot
   return sendClientData(ClientData::AUTOPILOT_STATE_MACHINE, sizeof(output), &output);
 }
 
-ClientDataAutopilotStateMachine SimConnectInterface::getClientDataAutopilotStateMachine() {
+const ClientDataAutopilotStateMachine& SimConnectInterface::getClientDataAutopilotStateMachine() const {
   return clientDataAutopilotStateMachine;
 }
 
-ClientDataAutothrust SimConnectInterface::getClientDataAutothrust() {
+const ClientDataAutothrust& SimConnectInterface::getClientDataAutothrust() const {
   return clientDataAutothrust;
 }
 
-ClientDataFlyByWire SimConnectInterface::getClientDataFlyByWire() {
+const ClientDataFlyByWire& SimConnectInterface::getClientDataFlyByWire() const {
   return clientDataFlyByWire;
 }
 
 bool SimConnectInterface::setClientDataElacDiscretes(base_elac_discrete_inputs output) {
+  if (clientDataPacked) {
+    clientDataBusFrame.elacDiscreteInputs = output;
+    return true;
+  }
   return sendClientData(ClientData::ELAC_DISCRETE_INPUTS, sizeof(output), &output);
 }
 
 bool SimConnectInterface::setClientDataElacAnalog(base_elac_analog_inputs output) {
+  if (clientDataPacked) {
+    clientDataBusFrame.elacAnalogInputs = output;
+    return true;
+  }
   return sendClientData(ClientData::ELAC_ANALOG_INPUTS, sizeof(output), &output);
 }
 
 bool SimConnectInterface::setClientDataElacBusInput(base_elac_out_bus output, int elacIndex) {
+  if (clientDataPacked) {
+    clientDataBusFrame.elac[elacIndex] = output;
+    return true;
+  }
   return sendClientData(ClientData::ELAC_1_BUS_OUTPUT + elacIndex, sizeof(output), &output);
 }
 
 bool SimConnectInterface::setClientDataSecDiscretes(base_sec_discrete_inputs output) {
+  if (clientDataPacked) {
+    clientDataBusFrame.secDiscreteInputs = output;
+    return true;
+  }
   return sendClientData(ClientData::SEC_DISCRETE_INPUTS, sizeof(output), &output);
 }
 
 bool SimConnectInterface::setClientDataSecAnalog(base_sec_analog_inputs output) {
+  if (clientDataPacked) {
+    clientDataBusFrame.secAnalogInputs = output;
+    return true;
+  }
   return sendClientData(ClientData::SEC_ANALOG_INPUTS, sizeof(output), &output);
 }
 
 bool SimConnectInterface::setClientDataSecBus(base_sec_out_bus output, int secIndex) {
   if (secIndex < 2) {
+    if (clientDataPacked) {
+      clientDataBusFrame.sec[secIndex] = output;
+      return true;
+    }
     return sendClientData(ClientData::SEC_1_BUS_OUTPUT + secIndex, sizeof(output), &output);
   } else {
     return false;
@@ -1299,77 +1353,124 @@ bool SimConnectInterface::setClientDataSecBus(base_sec_out_bus output, int secIn
 }
 
 bool SimConnectInterface::setClientDataFacDiscretes(base_fac_discrete_inputs output) {
+  if (clientDataPacked) {
+    clientDataBusFrame.facDiscreteInputs = output;
+    return true;
+  }
   return sendClientData(ClientData::FAC_DISCRETE_INPUTS, sizeof(output), &output);
 }
 
 bool SimConnectInterface::setClientDataFacAnalog(base_fac_analog_inputs output) {
+  if (clientDataPacked) {
+    clientDataBusFrame.facAnalogInputs = output;
+    return true;
+  }
   return sendClientData(ClientData::FAC_ANALOG_INPUTS, sizeof(output), &output);
 }
 
 bool SimConnectInterface::setClientDataFacBus(base_fac_bus output, int facIndex) {
+  if (clientDataPacked) {
+    clientDataBusFrame.fac[facIndex] = output;
+    return true;
+  }
   return sendClientData(ClientData::FAC_1_BUS_OUTPUT + facIndex, sizeof(output), &output);
 }
 
-base_elac_discrete_outputs SimConnectInterface::getClientDataElacDiscretesOutput() {
+const base_elac_discrete_outputs& SimConnectInterface::getClientDataElacDiscretesOutput() const {
   return clientDataElacDiscreteOutputs;
 }
 
-base_elac_analog_outputs SimConnectInterface::getClientDataElacAnalogsOutput() {
+const base_elac_analog_outputs& SimConnectInterface::getClientDataElacAnalogsOutput() const {
   return clientDataElacAnalogOutputs;
 }
 
-base_elac_out_bus SimConnectInterface::getClientDataElacBusOutput() {
+const base_elac_out_bus& SimConnectInterface::getClientDataElacBusOutput() const {
   return clientDataElacBusOutputs;
 }
 
-base_sec_discrete_outputs SimConnectInterface::getClientDataSecDiscretesOutput() {
+const base_sec_discrete_outputs& SimConnectInterface::getClientDataSecDiscretesOutput() const {
   return clientDataSecDiscreteOutputs;
 }
 
-base_sec_analog_outputs SimConnectInterface::getClientDataSecAnalogsOutput() {
+const base_sec_analog_outputs& SimConnectInterface::getClientDataSecAnalogsOutput() const {
   return clientDataSecAnalogOutputs;
 }
 
-base_sec_out_bus SimConnectInterface::getClientDataSecBusOutput() {
+const base_sec_out_bus& SimConnectInterface::getClientDataSecBusOutput() const {
   return clientDataSecBusOutputs;
 }
 
-base_fac_discrete_outputs SimConnectInterface::getClientDataFacDiscretesOutput() {
+const base_fac_discrete_outputs& SimConnectInterface::getClientDataFacDiscretesOutput() const {
   return clientDataFacDiscreteOutputs;
 }
 
-base_fac_analog_outputs SimConnectInterface::getClientDataFacAnalogsOutput() {
+const base_fac_analog_outputs& SimConnectInterface::getClientDataFacAnalogsOutput() const {
   return clientDataFacAnalogOutputs;
 }
 
-base_fac_bus SimConnectInterface::getClientDataFacBusOutput() {
+const base_fac_bus& SimConnectInterface::getClientDataFacBusOutput() const {
   return clientDataFacBusOutputs;
 }
 
 bool SimConnectInterface::setClientDataAdr(base_adr_bus output, int adrIndex) {
+  if (clientDataPacked) {
+    clientDataBusFrame.adr[adrIndex] = output;
+    return true;
+  }
   return sendClientData(ClientData::ADR_1_INPUTS + adrIndex, sizeof(output), &output);
 }
 
 bool SimConnectInterface::setClientDataIr(base_ir_bus output, int irIndex) {
+  if (clientDataPacked) {
+    clientDataBusFrame.ir[irIndex] = output;
+    return true;
+  }
   return sendClientData(ClientData::IR_1_INPUTS + irIndex, sizeof(output), &output);
 }
 
 bool SimConnectInterface::setClientDataRa(base_ra_bus output, int raIndex) {
+  if (clientDataPacked) {
+    clientDataBusFrame.ra[raIndex] = output;
+    return true;
+  }
   return sendClientData(ClientData::RA_1_BUS + raIndex, sizeof(output), &output);
 }
 
 bool SimConnectInterface::setClientDataLgciu(base_lgciu_bus output, int lgciuIndex) {
+  if (clientDataPacked) {
+    clientDataBusFrame.lgciu[lgciuIndex] = output;
+    return true;
+  }
   return sendClientData(ClientData::LGCIU_1_BUS + lgciuIndex, sizeof(output), &output);
 }
 
 bool SimConnectInterface::setClientDataSfcc(base_sfcc_bus output, int sfccIndex) {
+  if (clientDataPacked) {
+    clientDataBusFrame.sfcc[sfccIndex] = output;
+    return true;
+  }
   return sendClientData(ClientData::SFCC_1_BUS + sfccIndex, sizeof(output), &output);
 }
 
 bool SimConnectInterface::setClientDataFmgcB(base_fmgc_b_bus output, int fmgcIndex) {
+  if (clientDataPacked) {
+    clientDataBusFrame.fmgcB[fmgcIndex] = output;
+    return true;
+  }
   return sendClientData(ClientData::FMGC_1_B_BUS + fmgcIndex, sizeof(output), &output);
 }
 
+bool SimConnectInterface::sendClientDataBusFrame() {
+  if (!clientDataPacked) {
+    return true;
+  }
+
+  clientDataBusFrame.version = ClientDataBusFrame::VERSION;
+  clientDataBusFrame.sequence++;
+
+  return sendClientData(ClientData::BUS_FRAME, sizeof(clientDataBusFrame), &clientDataBusFrame);
+}
+
 void SimConnectInterface::setLoggingFlightControlsEnabled(bool enabled) {
   loggingFlightControlsEnabled = enabled;
 }
@@ -1803,6 +1904,8 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
 
     case Events::A32NX_FCU_SPD_SET: {
       idFcuEventSetSPEED->set(static_cast<long>(event->dwData));
+      // the H event reads the value, so it has to be published right away
+      idFcuEventSetSPEED->write();
       execute_calculator_code("(>H:A320_Neo_FCU_SPEED_SET)", nullptr, nullptr, nullptr);
       std::cout << "WASM: event triggered: A32NX_FCU_SPD_SET: " << static_cast<long>(event->dwData) << std::endl;
       break;
@@ -1847,6 +1950,8 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
 
     case Events::A32NX_FCU_HDG_SET: {
       idFcuEventSetHDG->set(static_cast<long>(event->dwData));
+      // the H event reads the value, so it has to be published right away
+      idFcuEventSetHDG->write();
       execute_calculator_code("(>H:A320_Neo_FCU_HDG_SET)", nullptr, nullptr, nullptr);
       std::cout << "WASM: event triggered: A32NX_FCU_HDG_SET: " << static_cast<long>(event->dwData) << std::endl;
       break;
@@ -2005,6 +2110,8 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
 
     case Events::A32NX_FCU_VS_SET: {
       idFcuEventSetVS->set(static_cast<long>(event->dwData));
+      // the H event reads the value, so it has to be published right away
+      idFcuEventSetVS->write();
       execute_calculator_code("(>H:A320_Neo_FCU_VS_SET) (>H:A320_Neo_CDU_VS)", nullptr, nullptr, nullptr);
       std::cout << "WASM: event triggered: A32NX_FCU_VS_SET: " << static_cast<long>(event->dwData) << std::endl;
       break;
@@ -2684,6 +2791,8 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::SIM_RATE_INCR: {
       // calculate frame rate that will be seen by FBW / AP
       double theoreticalFrameRate = (1 / sampleTime) / (simData.simulation_rate * 2);
+      // remember the request, it may be granted later when the performance allows it
+      requestedSimulationRate = std::fmin(maxSimulationRate, simData.simulation_rate * 2);
       // determine if an increase of simulation rate can be allowed
       if ((simData.simulation_rate < maxSimulationRate && theoreticalFrameRate >= 8) || simData.simulation_rate < 1 ||
           !limitSimulationRateByPerformance) {
@@ -2700,6 +2809,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     }
 
     case Events::SIM_RATE_DECR: {
+      requestedSimulationRate = std::fmax(minSimulationRate, simData.simulation_rate / 2);
       if (simData.simulation_rate > minSimulationRate) {
         sendEvent(Events::SIM_RATE_DECR, 0, SIMCONNECT_GROUP_PRIORITY_DEFAULT);
         std::cout << "WASM: Simulation rate " << simData.simulation_rate;
@@ -2715,6 +2825,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
 
     case Events::SIM_RATE_SET: {
       long targetSimulationRate = min(maxSimulationRate, max(1, static_cast<long>(event->dwData)));
+      requestedSimulationRate = targetSimulationRate;
       sendEvent(Events::SIM_RATE_SET, targetSimulationRate, SIMCONNECT_GROUP_PRIORITY_DEFAULT);
       std::cout << "WASM: Simulation Rate set to " << targetSimulationRate << std::endl;
       break;
@@ -2819,6 +2930,16 @@ void SimConnectInterface::simConnectProcessClientData(const SIMCONNECT_RECV_CLIE
       clientDataFacBusOutputs = *((base_fac_bus*)&data->dwData);
       return;
 
+    case ClientData::BUS_FRAME:
+      // loopback of the bus frame, only requested for testing
+      if (!clientDataBusFrameLoopback.receive(*((ClientDataBusFrame*)&data->dwData))) {
+        std::cout << "WASM: Bus frame loopback received unknown version!" << std::endl;
+      } else if (clientDataBusFrameLoopback.getReceivedFrames() % 1000 == 0) {
+        std::cout << "WASM: Bus frame loopback received " << clientDataBusFrameLoopback.getReceivedFrames() << " frames, lost ";
+        std::cout << clientDataBusFrameLoopback.getLostFrames() << std::endl;
+      }
+      return;
+
     default:
       // print unknown request id
       std::cout << "WASM: Unknown request id in SimConnect connection: ";
@@ -8,6 +8,7 @@
 #include "../LocalVariable.h"
 #include "../SpoilersHandler.h"
 #include "../ThrottleAxisMapping.h"
+#include "ClientDataBusFrame.h"
 #include "SimConnectData.h"
 
 #include "../model/ElacComputer_types.h"
@@ -182,6 +183,8 @@ class SimConnectInterface {
   ~SimConnectInterface() = default;
 
   bool connect(bool clientDataEnabled,
+               bool clientDataPacked,
+               bool clientDataLoopback,
                bool autopilotStateMachineEnabled,
                bool autopilotLawsEnabled,
                bool flyByWireEnabled,
@@ -234,52 +237,54 @@ class SimConnectInterface {
 
   void resetSimInputThrottles();
 
-  SimData getSimData();
+  // The data and inputs are read once per frame by readData(). The returned references stay valid and unchanged until
+  // the next readData() (or reset of the inputs), so all stages of a frame share the same snapshot without copying it.
+  const SimData& getSimData() const;
 
-  SimInput getSimInput();
+  const SimInput& getSimInput() const;
 
-  SimInputAutopilot getSimInputAutopilot();
+  const SimInputAutopilot& getSimInputAutopilot() const;
 
-  SimInputRudderTrim getSimInputRudderTrim();
+  const SimInputRudderTrim& getSimInputRudderTrim() const;
 
-  SimInputThrottles getSimInputThrottles();
+  const SimInputThrottles& getSimInputThrottles() const;
 
   bool setClientDataAutopilotStateMachine(ClientDataAutopilotStateMachine output);
-  ClientDataAutopilotStateMachine getClientDataAutopilotStateMachine();
+  const ClientDataAutopilotStateMachine& getClientDataAutopilotStateMachine() const;
 
   bool setClientDataAutopilotLaws(ClientDataAutopilotLaws output);
-  ClientDataAutopilotLaws getClientDataAutopilotLaws();
+  const ClientDataAutopilotLaws& getClientDataAutopilotLaws() const;
 
-  ClientDataAutothrust getClientDataAutothrust();
+  const ClientDataAutothrust& getClientDataAutothrust() const;
 
   bool setClientDataFlyByWireInput(ClientDataFlyByWireInput output);
 
   bool setClientDataFlyByWire(ClientDataFlyByWire output);
-  ClientDataFlyByWire getClientDataFlyByWire();
+  const ClientDataFlyByWire& getClientDataFlyByWire() const;
 
   bool setClientDataElacDiscretes(base_elac_discrete_inputs output);
   bool setClientDataElacAnalog(base_elac_analog_inputs output);
   bool setClientDataElacBusInput(base_elac_out_bus output, int elacIndex);
 
-  base_elac_discrete_outputs getClientDataElacDiscretesOutput();
-  base_elac_analog_outputs getClientDataElacAnalogsOutput();
-  base_elac_out_bus getClientDataElacBusOutput();
+  const base_elac_discrete_outputs& getClientDataElacDiscretesOutput() const;
+  const base_elac_analog_outputs& getClientDataElacAnalogsOutput() const;
+  const base_elac_out_bus& getClientDataElacBusOutput() const;
 
   bool setClientDataSecDiscretes(base_sec_discrete_inputs output);
   bool setClientDataSecAnalog(base_sec_analog_inputs output);
   bool setClientDataSecBus(base_sec_out_bus output, int secIndex);
 
-  base_sec_discrete_outputs getClientDataSecDiscretesOutput();
-  base_sec_analog_outputs getClientDataSecAnalogsOutput();
-  base_sec_out_bus getClientDataSecBusOutput();
+  const base_sec_discrete_outputs& getClientDataSecDiscretesOutput() const;
+  const base_sec_analog_outputs& getClientDataSecAnalogsOutput() const;
+  const base_sec_out_bus& getClientDataSecBusOutput() const;
 
   bool setClientDataFacDiscretes(base_fac_discrete_inputs output);
   bool setClientDataFacAnalog(base_fac_analog_inputs output);
   bool setClientDataFacBus(base_fac_bus output, int facIndex);
 
-  base_fac_discrete_outputs getClientDataFacDiscretesOutput();
-  base_fac_analog_outputs getClientDataFacAnalogsOutput();
-  base_fac_bus getClientDataFacBusOutput();
+  const base_fac_discrete_outputs& getClientDataFacDiscretesOutput() const;
+  const base_fac_analog_outputs& getClientDataFacAnalogsOutput() const;
+  const base_fac_bus& getClientDataFacBusOutput() const;
 
   bool setClientDataAdr(base_adr_bus output, int adrIndex);
   bool setClientDataIr(base_ir_bus output, int irIndex);
@@ -288,6 +293,9 @@ class SimConnectInterface {
   bool setClientDataSfcc(base_sfcc_bus output, int sfccIndex);
   bool setClientDataFmgcB(base_fmgc_b_bus output, int fmgcIndex);
 
+  // Writes the bus words and computer inputs collected during the frame when packed client data is enabled.
+  bool sendClientDataBusFrame();
+
   void setLoggingFlightControlsEnabled(bool enabled);
   bool getLoggingFlightControlsEnabled();
 
@@ -299,6 +307,10 @@ class SimConnectInterface {
 
   void updateSimulationRateLimits(double minSimulationRate, double maxSimulationRate);
 
+  // Simulation rate last requested by the user, it may not have been applied due to the limits.
+  double getRequestedSimulationRate() const;
+  void setRequestedSimulationRate(double simulationRate);
+
  private:
   enum ClientData {
     AUTOPILOT_STATE_MACHINE,
@@ -338,6 +350,7 @@ class SimConnectInterface {
     FMGC_2_B_BUS,
     LOCAL_VARIABLES,
     LOCAL_VARIABLES_AUTOTHRUST,
+    BUS_FRAME,
   };
 
   bool isConnected = false;
@@ -347,8 +360,11 @@ class SimConnectInterface {
 
   double minSimulationRate = 0;
   double maxSimulationRate = 0;
+  double requestedSimulationRate = 1;
   bool limitSimulationRateByPerformance = true;
   bool clientDataEnabled = false;
+  bool clientDataPacked = false;
+  bool clientDataLoopback = false;
 
   int elacDisabled = -1;
   int secDisabled = -1;
@@ -386,6 +402,9 @@ class SimConnectInterface {
   base_fac_analog_outputs clientDataFacAnalogOutputs = {};
   base_fac_bus clientDataFacBusOutputs = {};
 
+  ClientDataBusFrame clientDataBusFrame = {};
+  ClientDataBusFrameReceiver clientDataBusFrameLoopback;
+
   // change to non-static when aileron events can be processed via SimConnect
   static double flightControlsKeyChangeAileron;
   double flightControlsKeyChangeElevator = 0.0;
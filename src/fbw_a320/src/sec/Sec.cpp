@@ -32,9 +32,11 @@ void Sec::update(double deltaTime, double simulationTime, bool faultActive, bool
   updateSelfTest(deltaTime);
   monitorSelf(faultActive);
 
-  secComputer.setExternalInputs(&modelInputs);
-  secComputer.step();
-  modelOutputs = secComputer.getExternalOutputs().out;
+  if (modelStepGate.update(modelInputs.in.sim_data.computer_running)) {
+    secComputer.setExternalInputs(&modelInputs);
+    secComputer.step();
+    modelOutputs = secComputer.getExternalOutputs().out;
+  }
 }
 
 // Perform self monitoring. If
@@ -157,3 +159,18 @@ base_sec_analog_outputs Sec::getAnalogOutputs() {
 
   return output;
 }
+
+// Save the model and computer state (self-monitoring, power supply and self-test vars) into the arena.
+bool Sec::saveState(SnapshotArena& arena) const {
+  return arena.save(secComputer) && arena.save(modelInputs) && arena.save(modelOutputs) && arena.save(monitoringHealthy) &&
+         arena.save(cpuStopped) && arena.save(cpuStoppedFlipFlop) && arena.save(resetPulseNode) && arena.save(powerSupplyOutageTime) &&
+         arena.save(powerSupplyFault) && arena.save(selfTestTimer) && arena.save(selfTestComplete) && arena.save(modelStepGate);
+}
+
+// Restore the state saved by saveState, in the same order.
+bool Sec::restoreState(SnapshotArena& arena) {
+  return arena.restore(secComputer) && arena.restore(modelInputs) && arena.restore(modelOutputs) && arena.restore(monitoringHealthy) &&
+         arena.restore(cpuStopped) && arena.restore(cpuStoppedFlipFlop) && arena.restore(resetPulseNode) &&
+         arena.restore(powerSupplyOutageTime) && arena.restore(powerSupplyFault) && arena.restore(selfTestTimer) &&
+         arena.restore(selfTestComplete) && arena.restore(modelStepGate);
+}
@@ -5,8 +5,10 @@
 #include "../Arinc429.h"
 #include "../model/SecComputer.h"
 #include "../utils/ConfirmNode.h"
+#include "../utils/ModelStepGate.h"
 #include "../utils/PulseNode.h"
 #include "../utils/SRFlipFlop.h"
+#include "SnapshotArena.h"
 
 class Sec {
  public:
@@ -22,6 +24,10 @@ class Sec {
 
   base_sec_analog_outputs getAnalogOutputs();
 
+  bool saveState(SnapshotArena& arena) const;
+
+  bool restoreState(SnapshotArena& arena);
+
   SecComputer::ExternalInputs_SecComputer_T modelInputs = {};
 
  private:
@@ -44,6 +50,8 @@ class Sec {
 
   bool cpuStopped;
 
+  ModelStepGate modelStepGate;
+
   SRFlipFlop cpuStoppedFlipFlop = SRFlipFlop(true);
 
   PulseNode resetPulseNode = PulseNode(false);
@@ -0,0 +1,7 @@
+#include "ModelStepGate.h"
+
+bool ModelStepGate::update(bool computerRunning) {
+  bool step = computerRunning || !modelStopped;
+  modelStopped = !computerRunning;
+  return step;
+}
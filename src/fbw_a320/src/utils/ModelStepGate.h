@@ -0,0 +1,14 @@
+#pragma once
+
+// Skips the steps of a generated computer model that cannot change it.
+// While sim_data.computer_running is false, the step function of the models only clears their Runtime_MODE flag. The
+// first step with computer_running set again then resets all states of the model, as at power-up. So after one step
+// with computer_running cleared, further steps leave the model and its outputs unchanged until the computer runs again.
+class ModelStepGate {
+ public:
+  // Returns true if the model has to be stepped with the given computer_running input.
+  bool update(bool computerRunning);
+
+ private:
+  bool modelStopped = false;
+};
@@ -122,6 +122,11 @@ clang++ \
   "${DIR}/src/FlightDataRecorder.cpp" \
   "${DIR}/src/Arinc429Utils.cpp" \
   "${COMMON_DIR}/src/LocalVariable.cpp" \
+  "${COMMON_DIR}/src/FrameProfiler.cpp" \
+  "${COMMON_DIR}/src/FrameScheduler.cpp" \
+  "${COMMON_DIR}/src/Arinc429BusDecoder.cpp" \
+  "${COMMON_DIR}/src/Arinc429BusRouter.cpp" \
+  "${COMMON_DIR}/src/SimulationRateGovernor.cpp" \
   "${COMMON_DIR}/src/InterpolatingLookupTable.cpp" \
   "${DIR}/src/SpoilersHandler.cpp" \
   "${COMMON_DIR}/src/ThrottleAxisMapping.cpp" \
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <fstream>
+#include <vector>
 
 #include "AdditionalData.h"
 #include "EngineData.h"
@@ -16,12 +17,16 @@ class FlightDataRecorder {
 
   void initialize();
 
+  // Buffers the data of this frame, the buffered frames are written to the file by flush().
   void update(AutopilotStateMachineModelClass* autopilotStateMachine,
               AutopilotLawsModelClass* autopilotLaws,
               Autothrust* autoThrust,
               const EngineData& engineData,
               const AdditionalData& additionalData);
 
+  // Compresses the buffered frames into the file.
+  bool flush();
+
   void terminate();
 
  private:
@@ -32,6 +37,10 @@ class FlightDataRecorder {
   int maximumSampleCounter = 0;
   int maximumFileCount = 0;
   std::shared_ptr<gzofstream> fileStream;
+  std::vector<char> pendingFrames;
+  size_t frameSize = 0;
+
+  void appendToPendingFrames(const void* data, size_t size);
 
   void manageFlightDataRecorderFiles();
 
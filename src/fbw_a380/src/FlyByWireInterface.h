@@ -4,12 +4,18 @@
 #include <SimConnect.h>
 
 #include "AdditionalData.h"
+#include "Arinc429BusDecoder.h"
+#include "Arinc429BusRouter.h"
 #include "CalculatedRadioReceiver.h"
 #include "EngineData.h"
 #include "FlightDataRecorder.h"
+#include "FrameProfiler.h"
+#include "FrameScheduler.h"
 #include "InterpolatingLookupTable.h"
 #include "LocalVariable.h"
 #include "RateLimiter.h"
+#include "SimulationRateGovernor.h"
+#include "SnapshotArena.h"
 #include "SpoilersHandler.h"
 #include "ThrottleAxisMapping.h"
 #include "fac/Fac.h"
@@ -32,6 +38,10 @@ class FlyByWireInterface {
 
   bool update(double sampleTime);
 
+  bool saveState(SnapshotArena& arena) const;
+
+  bool restoreState(SnapshotArena& arena);
+
  private:
   const std::string CONFIGURATION_FILEPATH = "\\work\\ModelConfiguration.ini";
 
@@ -48,11 +58,22 @@ class FlyByWireInterface {
   double previousApproachCapabilityUpdateTime = 0;
 
   bool simulationRateReductionEnabled = true;
+  bool simulationRateGovernorEnabled = true;
   bool limitSimulationRateByPerformance = true;
 
   double targetSimulationRate = 1;
   bool targetSimulationRateModified = false;
 
+  SimulationRateGovernor simulationRateGovernor;
+  // start of the current frame and the time the previous frame took to compute in s
+  std::chrono::steady_clock::time_point frameStart;
+  double frameComputeTime = 0;
+
+  // start of connect(), time the local variables took to set up in s, reported with the first frame
+  std::chrono::steady_clock::time_point startupStart;
+  double startupLocalVariablesTime = 0;
+  bool isStartupReported = false;
+
   bool autopilotStateMachineEnabled = false;
   bool autopilotLawsEnabled = false;
   bool flyByWireEnabled = false;
@@ -144,6 +165,9 @@ class FlyByWireInterface {
   base_fac_analog_outputs facsAnalogOutputs[2] = {};
   base_fac_bus facsBusOutputs[2] = {};
 
+  Arinc429BusRouter primBusRouters[3];
+  Arinc429BusRouter facBusRouters[2];
+
   InterpolatingLookupTable throttleLookupTable;
 
   RadioReceiver radioReceiver;
@@ -169,6 +193,28 @@ class FlyByWireInterface {
   std::unique_ptr<LocalVariable> idMaximumSimulationRate;
 
   std::unique_ptr<LocalVariable> idPerformanceWarningActive;
+  std::unique_ptr<LocalVariable> idSimulationRateGovernorMaximumRate;
+  std::unique_ptr<LocalVariable> idSimulationRateGovernorComputeTime;
+
+  std::unique_ptr<LocalVariable> idLocalVariableReads;
+  std::unique_ptr<LocalVariable> idLocalVariableWrites;
+  std::unique_ptr<LocalVariable> idLocalVariableWritesAvoided;
+
+  // budget of a frame until which deferrable work is run in s
+  static constexpr double DEFERRED_WORK_BUDGET = 0.002;
+  FrameScheduler frameScheduler;
+
+  FrameProfiler frameProfiler;
+  FrameProfiler::Stage profilerStageReadData = 0;
+  FrameProfiler::Stage profilerStageAutopilotStateMachine = 0;
+  FrameProfiler::Stage profilerStageAutopilotLaws = 0;
+  FrameProfiler::Stage profilerStageFlyByWire = 0;
+  FrameProfiler::Stage profilerStageAutothrust = 0;
+  FrameProfiler::Stage profilerStagePrim[3] = {};
+  FrameProfiler::Stage profilerStageFac[2] = {};
+  FrameProfiler::Stage profilerStageDeferredWork = 0;
+  FrameProfiler::Stage profilerStageFlightDataRecorder = 0;
+  FrameProfiler::Stage profilerStageWriteLocalVariables = 0;
 
   std::unique_ptr<LocalVariable> idTrackingMode;
   std::unique_ptr<LocalVariable> idExternalOverride;
@@ -375,54 +421,22 @@ class FlyByWireInterface {
   std::unique_ptr<LocalVariable> idWingAntiIce;
 
   // RA bus inputs
-  std::unique_ptr<LocalVariable> idRadioAltimeterHeight[3];
+  Arinc429BusDecoder raBusDecoders[3];
 
   // LGCIU inputs
   std::unique_ptr<LocalVariable> idLgciuNoseGearCompressed[2];
   std::unique_ptr<LocalVariable> idLgciuLeftMainGearCompressed[2];
   std::unique_ptr<LocalVariable> idLgciuRightMainGearCompressed[2];
-  std::unique_ptr<LocalVariable> idLgciuDiscreteWord1[2];
-  std::unique_ptr<LocalVariable> idLgciuDiscreteWord2[2];
-  std::unique_ptr<LocalVariable> idLgciuDiscreteWord3[2];
+  Arinc429BusDecoder lgciuBusDecoders[2];
 
   // SFCC inputs
-  std::unique_ptr<LocalVariable> idSfccSlatFlapComponentStatusWord;
-  std::unique_ptr<LocalVariable> idSfccSlatFlapSystemStatusWord;
-  std::unique_ptr<LocalVariable> idSfccSlatFlapActualPositionWord;
-  std::unique_ptr<LocalVariable> idSfccSlatActualPositionWord;
-  std::unique_ptr<LocalVariable> idSfccFlapActualPositionWord;
+  Arinc429BusDecoder sfccBusDecoder;
 
   // ADR bus inputs
-  std::unique_ptr<LocalVariable> idAdrAltitudeCorrected[3];
-  std::unique_ptr<LocalVariable> idAdrMach[3];
-  std::unique_ptr<LocalVariable> idAdrAirspeedComputed[3];
-  std::unique_ptr<LocalVariable> idAdrAirspeedTrue[3];
-  std::unique_ptr<LocalVariable> idAdrVerticalSpeed[3];
-  std::unique_ptr<LocalVariable> idAdrAoaCorrected[3];
-  std::unique_ptr<LocalVariable> idAdrCorrectedAverageStaticPressure[3];
+  Arinc429BusDecoder adrBusDecoders[3];
 
   // IR bus inputs
-  std::unique_ptr<LocalVariable> idIrLatitude[3];
-  std::unique_ptr<LocalVariable> idIrLongitude[3];
-  std::unique_ptr<LocalVariable> idIrGroundSpeed[3];
-  std::unique_ptr<LocalVariable> idIrWindSpeed[3];
-  std::unique_ptr<LocalVariable> idIrWindDirectionTrue[3];
-  std::unique_ptr<LocalVariable> idIrTrackAngleMagnetic[3];
-  std::unique_ptr<LocalVariable> idIrHeadingMagnetic[3];
-  std::unique_ptr<LocalVariable> idIrDriftAngle[3];
-  std::unique_ptr<LocalVariable> idIrFlightPathAngle[3];
-  std::unique_ptr<LocalVariable> idIrPitchAngle[3];
-  std::unique_ptr<LocalVariable> idIrRollAngle[3];
-  std::unique_ptr<LocalVariable> idIrBodyPitchRate[3];
-  std::unique_ptr<LocalVariable> idIrBodyRollRate[3];
-  std::unique_ptr<LocalVariable> idIrBodyYawRate[3];
-  std::unique_ptr<LocalVariable> idIrBodyLongAccel[3];
-  std::unique_ptr<LocalVariable> idIrBodyLatAccel[3];
-  std::unique_ptr<LocalVariable> idIrBodyNormalAccel[3];
-  std::unique_ptr<LocalVariable> idIrTrackAngleRate[3];
-  std::unique_ptr<LocalVariable> idIrPitchAttRate[3];
-  std::unique_ptr<LocalVariable> idIrRollAttRate[3];
-  std::unique_ptr<LocalVariable> idIrInertialVerticalSpeed[3];
+  Arinc429BusDecoder irBusDecoders[3];
 
   // FCDC bus label Lvars
   std::unique_ptr<LocalVariable> idFcdcDiscreteWord1[2];
@@ -575,7 +589,16 @@ class FlyByWireInterface {
 
   bool readDataAndLocalVariables(double sampleTime);
 
+  void setupFrameProfiler();
+
+  void setupFrameScheduler();
+
+  void setupBusRoutes();
+
+  bool updateFrame(double sampleTime);
+
   bool updatePerformanceMonitoring(double sampleTime);
+  bool updateLocalVariableStatistics();
   bool handleSimulationRate(double sampleTime);
 
   bool updateRadioReceiver(double sampleTime);
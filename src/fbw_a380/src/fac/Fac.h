@@ -4,6 +4,7 @@
 #include "../model/FacComputer.h"
 #include "../utils/PulseNode.h"
 #include "../utils/SRFlipFlop.h"
+#include "SnapshotArena.h"
 
 class Fac {
  public:
@@ -19,6 +20,10 @@ class Fac {
 
   base_fac_analog_outputs getAnalogOutputs();
 
+  bool saveState(SnapshotArena& arena) const;
+
+  bool restoreState(SnapshotArena& arena);
+
   FacComputer::ExternalInputs_FacComputer_T modelInputs = {};
 
  private:
@@ -114,6 +114,14 @@ void SimConnectInterface::updateSimulationRateLimits(double minSimulationRate, d
   this->maxSimulationRate = maxSimulationRate;
 }
 
+double SimConnectInterface::getRequestedSimulationRate() const {
+  return requestedSimulationRate;
+}
+
+void SimConnectInterface::setRequestedSimulationRate(double simulationRate) {
+  requestedSimulationRate = simulationRate;
+}
+
 bool SimConnectInterface::prepareSimDataSimConnectDataDefinitions() {
   bool result = true;
 
@@ -1215,23 +1223,23 @@ bool SimConnectInterface::setClientDataLocalVariablesAutothrust(ClientDataLocalV
   return sendClientData(ClientData::LOCAL_VARIABLES_AUTOTHRUST, sizeof(output), &output);
 }
 
-SimData SimConnectInterface::getSimData() {
+const SimData& SimConnectInterface::getSimData() const {
   return simData;
 }
 
-SimInput SimConnectInterface::getSimInput() {
+const SimInput& SimConnectInterface::getSimInput() const {
   return simInput;
 }
 
-SimInputAutopilot SimConnectInterface::getSimInputAutopilot() {
+const SimInputAutopilot& SimConnectInterface::getSimInputAutopilot() const {
   return simInputAutopilot;
 }
 
-SimInputRudderTrim SimConnectInterface::getSimInputRudderTrim() {
+const SimInputRudderTrim& SimConnectInterface::getSimInputRudderTrim() const {
   return simInputRudderTrim;
 }
 
-SimInputThrottles SimConnectInterface::getSimInputThrottles() {
+const SimInputThrottles& SimConnectInterface::getSimInputThrottles() const {
   return simInputThrottles;
 }
 
@@ -1269,7 +1277,7 @@ bool SimConnectInterface::setClientDataAutopilotLaws(ClientDataAutopilotLaws out
   return sendClientData(ClientData::AUTOPILOT_LAWS, sizeof(output), &output);
 }
 
-ClientDataAutopilotLaws SimConnectInterface::getClientDataAutopilotLaws() {
+const ClientDataAutopilotLaws& SimConnectInterface::getClientDataAutopilotLaws() const {
   return clientDataAutopilotLaws;
 }
 
@@ -1278,15 +1286,15 @@ bool SimConnectInterface::setClientDataAutopilotStateMachine(ClientDataAutopilot
   return sendClientData(ClientData::AUTOPILOT_STATE_MACHINE, sizeof(output), &output);
 }
 
-ClientDataAutopilotStateMachine SimConnectInterface::getClientDataAutopilotStateMachine() {
+const ClientDataAutopilotStateMachine& SimConnectInterface::getClientDataAutopilotStateMachine() const {
   return clientDataAutopilotStateMachine;
 }
 
-ClientDataAutothrust SimConnectInterface::getClientDataAutothrust() {
+const ClientDataAutothrust& SimConnectInterface::getClientDataAutothrust() const {
   return clientDataAutothrust;
 }
 
-ClientDataFlyByWire SimConnectInterface::getClientDataFlyByWire() {
+const ClientDataFlyByWire& SimConnectInterface::getClientDataFlyByWire() const {
   return clientDataFlyByWire;
 }
 
@@ -1330,15 +1338,15 @@ bool SimConnectInterface::setClientDataFacBus(base_fac_bus output, int facIndex)
   return sendClientData(ClientData::FAC_1_BUS_OUTPUT + facIndex, sizeof(output), &output);
 }
 
-base_prim_discrete_outputs SimConnectInterface::getClientDataPrimDiscretesOutput() {
+const base_prim_discrete_outputs& SimConnectInterface::getClientDataPrimDiscretesOutput() const {
   return clientDataPrimDiscreteOutputs;
 }
 
-base_prim_analog_outputs SimConnectInterface::getClientDataPrimAnalogsOutput() {
+const base_prim_analog_outputs& SimConnectInterface::getClientDataPrimAnalogsOutput() const {
   return clientDataPrimAnalogOutputs;
 }
 
-base_prim_out_bus SimConnectInterface::getClientDataPrimBusOutput() {
+const base_prim_out_bus& SimConnectInterface::getClientDataPrimBusOutput() const {
   return clientDataPrimBusOutputs;
 }
 
@@ -1354,15 +1362,15 @@ base_prim_out_bus SimConnectInterface::getClientDataPrimBusOutput() {
 //   return clientDataSecBusOutputs;
 // }
 
-base_fac_discrete_outputs SimConnectInterface::getClientDataFacDiscretesOutput() {
+const base_fac_discrete_outputs& SimConnectInterface::getClientDataFacDiscretesOutput() const {
   return clientDataFacDiscreteOutputs;
 }
 
-base_fac_analog_outputs SimConnectInterface::getClientDataFacAnalogsOutput() {
+const base_fac_analog_outputs& SimConnectInterface::getClientDataFacAnalogsOutput() const {
   return clientDataFacAnalogOutputs;
 }
 
-base_fac_bus SimConnectInterface::getClientDataFacBusOutput() {
+const base_fac_bus& SimConnectInterface::getClientDataFacBusOutput() const {
   return clientDataFacBusOutputs;
 }
 
@@ -1823,6 +1831,8 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
 
     case Events::A32NX_FCU_SPD_SET: {
       idFcuEventSetSPEED->set(static_cast<long>(event->dwData));
+      // the H event reads the value, so it has to be published right away
+      idFcuEventSetSPEED->write();
       execute_calculator_code("(>H:A320_Neo_FCU_SPEED_SET)", nullptr, nullptr, nullptr);
       std::cout << "WASM: event triggered: A32NX_FCU_SPD_SET: " << static_cast<long>(event->dwData) << std::endl;
       break;
@@ -1867,6 +1877,8 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
 
     case Events::A32NX_FCU_HDG_SET: {
       idFcuEventSetHDG->set(static_cast<long>(event->dwData));
+      // the H event reads the value, so it has to be published right away
+      idFcuEventSetHDG->write();
       execute_calculator_code("(>H:A320_Neo_FCU_HDG_SET)", nullptr, nullptr, nullptr);
       std::cout << "WASM: event triggered: A32NX_FCU_HDG_SET: " << static_cast<long>(event->dwData) << std::endl;
       break;
@@ -2025,6 +2037,8 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
 
     case Events::A32NX_FCU_VS_SET: {
       idFcuEventSetVS->set(static_cast<long>(event->dwData));
+      // the H event reads the value, so it has to be published right away
+      idFcuEventSetVS->write();
       execute_calculator_code("(>H:A320_Neo_FCU_VS_SET) (>H:A320_Neo_CDU_VS)", nullptr, nullptr, nullptr);
       std::cout << "WASM: event triggered: A32NX_FCU_VS_SET: " << static_cast<long>(event->dwData) << std::endl;
       break;
@@ -2752,6 +2766,8 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     case Events::SIM_RATE_INCR: {
       // calculate frame rate that will be seen by FBW / AP
       double theoreticalFrameRate = (1 / sampleTime) / (simData.simulation_rate * 2);
+      // remember the request, it may be granted later when the performance allows it
+      requestedSimulationRate = std::fmin(maxSimulationRate, simData.simulation_rate * 2);
       // determine if an increase of simulation rate can be allowed
       if ((simData.simulation_rate < maxSimulationRate && theoreticalFrameRate >= 8) || simData.simulation_rate < 1 ||
           !limitSimulationRateByPerformance) {
@@ -2768,6 +2784,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
     }
 
     case Events::SIM_RATE_DECR: {
+      requestedSimulationRate = std::fmax(minSimulationRate, simData.simulation_rate / 2);
       if (simData.simulation_rate > minSimulationRate) {
         sendEvent(Events::SIM_RATE_DECR, 0, SIMCONNECT_GROUP_PRIORITY_DEFAULT);
         std::cout << "WASM: Simulation rate " << simData.simulation_rate;
@@ -2783,6 +2800,7 @@ void SimConnectInterface::simConnectProcessEvent(const SIMCONNECT_RECV_EVENT* ev
 
     case Events::SIM_RATE_SET: {
       long targetSimulationRate = min(maxSimulationRate, max(1, static_cast<long>(event->dwData)));
+      requestedSimulationRate = targetSimulationRate;
       sendEvent(Events::SIM_RATE_SET, targetSimulationRate, SIMCONNECT_GROUP_PRIORITY_DEFAULT);
       std::cout << "WASM: Simulation Rate set to " << targetSimulationRate << std::endl;
       break;
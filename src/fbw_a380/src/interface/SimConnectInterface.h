@@ -238,36 +238,38 @@ class SimConnectInterface {
 
   void resetSimInputThrottles();
 
-  SimData getSimData();
+  // The data and inputs are read once per frame by readData(). The returned references stay valid and unchanged until
+  // the next readData() (or reset of the inputs), so all stages of a frame share the same snapshot without copying it.
+  const SimData& getSimData() const;
 
-  SimInput getSimInput();
+  const SimInput& getSimInput() const;
 
-  SimInputAutopilot getSimInputAutopilot();
+  const SimInputAutopilot& getSimInputAutopilot() const;
 
-  SimInputRudderTrim getSimInputRudderTrim();
+  const SimInputRudderTrim& getSimInputRudderTrim() const;
 
-  SimInputThrottles getSimInputThrottles();
+  const SimInputThrottles& getSimInputThrottles() const;
 
   bool setClientDataAutopilotStateMachine(ClientDataAutopilotStateMachine output);
-  ClientDataAutopilotStateMachine getClientDataAutopilotStateMachine();
+  const ClientDataAutopilotStateMachine& getClientDataAutopilotStateMachine() const;
 
   bool setClientDataAutopilotLaws(ClientDataAutopilotLaws output);
-  ClientDataAutopilotLaws getClientDataAutopilotLaws();
+  const ClientDataAutopilotLaws& getClientDataAutopilotLaws() const;
 
-  ClientDataAutothrust getClientDataAutothrust();
+  const ClientDataAutothrust& getClientDataAutothrust() const;
 
   bool setClientDataFlyByWireInput(ClientDataFlyByWireInput output);
 
   bool setClientDataFlyByWire(ClientDataFlyByWire output);
-  ClientDataFlyByWire getClientDataFlyByWire();
+  const ClientDataFlyByWire& getClientDataFlyByWire() const;
 
   bool setClientDataPrimDiscretes(base_prim_discrete_inputs output);
   bool setClientDataPrimAnalog(base_prim_analog_inputs output);
   bool setClientDataPrimBusInput(base_prim_out_bus output, int primIndex);
 
-  base_prim_discrete_outputs getClientDataPrimDiscretesOutput();
-  base_prim_analog_outputs getClientDataPrimAnalogsOutput();
-  base_prim_out_bus getClientDataPrimBusOutput();
+  const base_prim_discrete_outputs& getClientDataPrimDiscretesOutput() const;
+  const base_prim_analog_outputs& getClientDataPrimAnalogsOutput() const;
+  const base_prim_out_bus& getClientDataPrimBusOutput() const;
 
   // bool setClientDataSecDiscretes(base_sec_discrete_inputs output);
   // bool setClientDataSecAnalog(base_sec_analog_inputs output);
@@ -281,9 +283,9 @@ class SimConnectInterface {
   bool setClientDataFacAnalog(base_fac_analog_inputs output);
   bool setClientDataFacBus(base_fac_bus output, int facIndex);
 
-  base_fac_discrete_outputs getClientDataFacDiscretesOutput();
-  base_fac_analog_outputs getClientDataFacAnalogsOutput();
-  base_fac_bus getClientDataFacBusOutput();
+  const base_fac_discrete_outputs& getClientDataFacDiscretesOutput() const;
+  const base_fac_analog_outputs& getClientDataFacAnalogsOutput() const;
+  const base_fac_bus& getClientDataFacBusOutput() const;
 
   bool setClientDataAdr(base_adr_bus output, int adrIndex);
   bool setClientDataIr(base_ir_bus output, int irIndex);
@@ -303,6 +305,10 @@ class SimConnectInterface {
 
   void updateSimulationRateLimits(double minSimulationRate, double maxSimulationRate);
 
+  // Simulation rate last requested by the user, it may not have been applied due to the limits.
+  double getRequestedSimulationRate() const;
+  void setRequestedSimulationRate(double simulationRate);
+
  private:
   enum ClientData {
     AUTOPILOT_STATE_MACHINE,
@@ -354,6 +360,7 @@ class SimConnectInterface {
 
   double minSimulationRate = 0;
   double maxSimulationRate = 0;
+  double requestedSimulationRate = 1;
   bool limitSimulationRateByPerformance = true;
   bool clientDataEnabled = false;
 
@@ -207,3 +207,17 @@ base_prim_analog_outputs Prim::getAnalogOutputs() {
 
   return output;
 }
+
+// Save the model and computer state (self-monitoring, power supply and self-test vars) into the arena.
+bool Prim::saveState(SnapshotArena& arena) const {
+  return arena.save(primComputer) && arena.save(modelInputs) && arena.save(modelOutputs) && arena.save(monitoringHealthy) &&
+         arena.save(prevEngageButtonWasPressed) && arena.save(powerSupplyOutageTime) && arena.save(powerSupplyFault) &&
+         arena.save(selfTestTimer) && arena.save(selfTestComplete);
+}
+
+// Restore the state saved by saveState, in the same order.
+bool Prim::restoreState(SnapshotArena& arena) {
+  return arena.restore(primComputer) && arena.restore(modelInputs) && arena.restore(modelOutputs) && arena.restore(monitoringHealthy) &&
+         arena.restore(prevEngageButtonWasPressed) && arena.restore(powerSupplyOutageTime) && arena.restore(powerSupplyFault) &&
+         arena.restore(selfTestTimer) && arena.restore(selfTestComplete);
+}
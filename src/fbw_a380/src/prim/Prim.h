@@ -5,6 +5,7 @@
 #include "../utils/HysteresisNode.h"
 #include "../utils/PulseNode.h"
 #include "../utils/SRFlipFlop.h"
+#include "SnapshotArena.h"
 
 class Prim {
  public:
@@ -20,6 +21,10 @@ class Prim {
 
   base_prim_analog_outputs getAnalogOutputs();
 
+  bool saveState(SnapshotArena& arena) const;
+
+  bool restoreState(SnapshotArena& arena);
+
   A380PrimComputer::ExternalInputs_A380PrimComputer_T modelInputs = {};
 
  private:
@@ -7,6 +7,7 @@
 #include "../utils/ConfirmNode.h"
 #include "../utils/PulseNode.h"
 #include "../utils/SRFlipFlop.h"
+#include "SnapshotArena.h"
 
 class Sec {
  public:
@@ -22,6 +23,10 @@ class Sec {
 
   base_sec_analog_outputs getAnalogOutputs();
 
+  bool saveState(SnapshotArena& arena) const;
+
+  bool restoreState(SnapshotArena& arena);
+
   SecComputer::ExternalInputs_SecComputer_T modelInputs = {};
 
  private:
@@ -0,0 +1,18 @@
+#include "Arinc429BusDecoder.h"
+
+#include <cstring>
+
+void Arinc429BusDecoder::initialize(const std::string& prefix, const Field* fields, size_t fieldCount) {
+  for (size_t i = 0; i < fieldCount; i++) {
+    // the values are refreshed with the other local variables of the frame
+    variables.push_back(std::make_unique<LocalVariable>(prefix + fields[i].name, true, LocalVariable::READ_GROUP_FRAME));
+    slots.push_back({variables.back()->getHandle(), static_cast<uint32_t>(fields[i].word)});
+  }
+}
+
+void Arinc429BusDecoder::decodeWords(uint8_t* bus) const {
+  const double* values = LocalVariable::getValues();
+  for (const Slot& slot : slots) {
+    std::memcpy(bus + slot.word * WORD_SIZE, &values[slot.handle], WORD_SIZE);
+  }
+}
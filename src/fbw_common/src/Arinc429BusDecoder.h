@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "LocalVariable.h"
+
+// Decodes the ARINC 429 words of a bus of the generated models from local variables. A word is stored in its local
+// variable as the bit pattern of a double (SSM and data, 8 bytes), so decoding is a plain copy of the value into the
+// word. The fields are given as a table of local variable name and word index in the bus, decode() then copies all
+// fields in one loop over the values in the local variable registry.
+class Arinc429BusDecoder {
+ public:
+  static constexpr size_t WORD_SIZE = 8;
+
+  struct Field {
+    const char* name;
+    size_t word;
+  };
+
+  // Registers the local variable <prefix><name> for every field.
+  void initialize(const std::string& prefix, const Field* fields, size_t fieldCount);
+
+  template <typename Bus>
+  void decode(Bus& bus) const {
+    static_assert(sizeof(Bus) % WORD_SIZE == 0, "bus must consist of ARINC 429 words");
+    decodeWords(reinterpret_cast<uint8_t*>(&bus));
+  }
+
+ private:
+  struct Slot {
+    uint32_t handle;
+    uint32_t word;
+  };
+
+  std::vector<std::unique_ptr<LocalVariable>> variables;
+  std::vector<Slot> slots;
+
+  void decodeWords(uint8_t* bus) const;
+};
+
+// Word index of a field in a bus, for the field tables.
+#define ARINC429_BUS_WORD(Bus, field) (offsetof(Bus, field) / Arinc429BusDecoder::WORD_SIZE)
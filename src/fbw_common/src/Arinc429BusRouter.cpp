@@ -0,0 +1,18 @@
+#include "Arinc429BusRouter.h"
+
+#include <cstring>
+
+uint32_t Arinc429BusRouter::route() {
+  uint32_t changedWords = 0;
+
+  for (const Route& route : routes) {
+    for (size_t offset = 0; offset < route.wordCount * WORD_SIZE; offset += WORD_SIZE) {
+      if (std::memcmp(route.producer + offset, route.consumer + offset, WORD_SIZE) != 0) {
+        std::memcpy(route.consumer + offset, route.producer + offset, WORD_SIZE);
+        changedWords++;
+      }
+    }
+  }
+
+  return changedWords;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Copies ARINC 429 buses from their producers into the bus inputs of the consumers. The routes are set up once as a
+// table of producer bus and consumer slot. route() then copies only the words whose value or SSM changed since they
+// were last routed, the remaining words of the consumer slot are left untouched.
+//
+// The buses of the generated models are plain arrays of base_arinc_429 words (SSM and data, 8 bytes), which is all the
+// router relies on. Producer and consumer must outlive the router.
+class Arinc429BusRouter {
+ public:
+  static constexpr size_t WORD_SIZE = 8;
+
+  template <typename Bus>
+  void addRoute(const Bus& producer, Bus& consumer) {
+    static_assert(sizeof(Bus) % WORD_SIZE == 0, "bus must consist of ARINC 429 words");
+    routes.push_back({reinterpret_cast<const uint8_t*>(&producer), reinterpret_cast<uint8_t*>(&consumer), sizeof(Bus) / WORD_SIZE});
+  }
+
+  // Returns the number of words that changed.
+  uint32_t route();
+
+ private:
+  struct Route {
+    const uint8_t* producer;
+    uint8_t* consumer;
+    size_t wordCount;
+  };
+
+  std::vector<Route> routes;
+};
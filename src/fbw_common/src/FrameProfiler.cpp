@@ -0,0 +1,142 @@
+#include "FrameProfiler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+
+FrameProfiler::Scope::Scope(FrameProfiler& profiler, Stage stage) : profiler(profiler), stage(stage), active(profiler.enabled) {
+  if (active) {
+    start = Clock::now();
+  }
+}
+
+FrameProfiler::Scope::~Scope() {
+  if (active) {
+    profiler.record(stage, std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+  }
+}
+
+void FrameProfiler::initialize(const std::string& localVariablePrefix, const std::string& dumpFile, double interval) {
+  prefix = localVariablePrefix;
+  dumpFilePath = dumpFile;
+  intervalSeconds = interval;
+  idEnabled = std::make_unique<LocalVariable>(prefix + "_ENABLED");
+  frameStage = addStage("FRAME");
+}
+
+FrameProfiler::Stage FrameProfiler::addStage(const std::string& name) {
+  if (stageCount >= MAX_STAGE_COUNT) {
+    std::cout << "WASM: Frame profiler is out of stages, " << name << " is not profiled!" << std::endl;
+    return frameStage;
+  }
+
+  StageStatistics& statistics = stages[stageCount];
+  statistics.name = name;
+  statistics.idAverage = std::make_unique<LocalVariable>(prefix + "_" + name + "_AVG_US");
+  statistics.idMaximum = std::make_unique<LocalVariable>(prefix + "_" + name + "_MAX_US");
+  return stageCount++;
+}
+
+void FrameProfiler::beginFrame() {
+  // the switch is read with the local variables of the previous frame
+  bool shouldBeEnabled = idEnabled->get() == 1;
+  if (shouldBeEnabled && !enabled) {
+    reset();
+    intervalStart = Clock::now();
+    std::cout << "WASM: Frame profiler enabled" << std::endl;
+  } else if (!shouldBeEnabled && enabled) {
+    std::cout << "WASM: Frame profiler disabled" << std::endl;
+  }
+  enabled = shouldBeEnabled;
+
+  if (enabled) {
+    frameStart = Clock::now();
+  }
+}
+
+void FrameProfiler::endFrame() {
+  if (!enabled) {
+    return;
+  }
+
+  Clock::time_point now = Clock::now();
+  record(frameStage, std::chrono::duration<double, std::micro>(now - frameStart).count());
+
+  if (std::chrono::duration<double>(now - intervalStart).count() >= intervalSeconds) {
+    publish();
+    dump();
+    intervalStart = now;
+  }
+}
+
+bool FrameProfiler::isEnabled() const {
+  return enabled;
+}
+
+void FrameProfiler::record(Stage stage, double durationUs) {
+  StageStatistics& statistics = stages[stage];
+
+  uint32_t bucket = std::upper_bound(BUCKET_LIMITS_US.begin(), BUCKET_LIMITS_US.end(), durationUs) - BUCKET_LIMITS_US.begin();
+  statistics.buckets[bucket]++;
+
+  statistics.count++;
+  statistics.totalUs += durationUs;
+  statistics.maximumUs = std::max(statistics.maximumUs, durationUs);
+  statistics.intervalCount++;
+  statistics.intervalTotalUs += durationUs;
+  statistics.intervalMaximumUs = std::max(statistics.intervalMaximumUs, durationUs);
+}
+
+void FrameProfiler::reset() {
+  for (uint32_t i = 0; i < stageCount; i++) {
+    StageStatistics& statistics = stages[i];
+    statistics.buckets = {};
+    statistics.count = 0;
+    statistics.totalUs = 0;
+    statistics.maximumUs = 0;
+    statistics.intervalCount = 0;
+    statistics.intervalTotalUs = 0;
+    statistics.intervalMaximumUs = 0;
+  }
+}
+
+void FrameProfiler::publish() {
+  for (uint32_t i = 0; i < stageCount; i++) {
+    StageStatistics& statistics = stages[i];
+    double average = statistics.intervalCount > 0 ? statistics.intervalTotalUs / statistics.intervalCount : 0;
+    statistics.idAverage->set(std::round(average));
+    statistics.idMaximum->set(std::round(statistics.intervalMaximumUs));
+    statistics.intervalCount = 0;
+    statistics.intervalTotalUs = 0;
+    statistics.intervalMaximumUs = 0;
+  }
+}
+
+void FrameProfiler::dump() {
+  std::ofstream file(dumpFilePath, std::ios::out | std::ios::trunc);
+  if (!file) {
+    std::cout << "WASM: Frame profiler failed to write " << dumpFilePath << std::endl;
+    return;
+  }
+
+  // one line per stage with the totals since profiling was enabled and the histogram in microseconds
+  file << std::left << std::setw(32) << "stage" << std::right << std::setw(10) << "count" << std::setw(10) << "avg"
+       << std::setw(10) << "max";
+  for (double limit : BUCKET_LIMITS_US) {
+    file << std::setw(10) << "<" + std::to_string(static_cast<int>(limit));
+  }
+  file << std::setw(10) << ">" + std::to_string(static_cast<int>(BUCKET_LIMITS_US.back())) << std::endl;
+
+  file << std::fixed << std::setprecision(1);
+  for (uint32_t i = 0; i < stageCount; i++) {
+    const StageStatistics& statistics = stages[i];
+    double average = statistics.count > 0 ? statistics.totalUs / statistics.count : 0;
+    file << std::left << std::setw(32) << statistics.name << std::right << std::setw(10) << statistics.count << std::setw(10)
+         << average << std::setw(10) << statistics.maximumUs;
+    for (uint32_t bucket : statistics.buckets) {
+      file << std::setw(10) << bucket;
+    }
+    file << std::endl;
+  }
+}
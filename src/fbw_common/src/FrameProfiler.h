@@ -0,0 +1,88 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "LocalVariable.h"
+
+// Measures the wall time of the stages of a frame. Every stage keeps a histogram with fixed buckets, so no memory is
+// allocated while profiling. Profiling is switched on and off at runtime with the <prefix>_ENABLED local variable.
+// While it is on, the average and maximum time of every stage over the last interval are published in local variables
+// and the statistics are dumped into a file once per interval.
+class FrameProfiler {
+ public:
+  using Stage = uint32_t;
+
+  static constexpr uint32_t MAX_STAGE_COUNT = 48;
+  static constexpr uint32_t BUCKET_COUNT = 12;
+  // upper limits of the histogram buckets in microseconds, the last bucket holds everything above
+  static constexpr std::array<double, BUCKET_COUNT - 1> BUCKET_LIMITS_US = {10,   25,   50,   100,   250,   500,
+                                                                            1000, 2500, 5000, 10000, 25000};
+
+  // Times the enclosing scope as the given stage, if profiling is enabled.
+  class Scope {
+   public:
+    Scope(FrameProfiler& profiler, Stage stage);
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    FrameProfiler& profiler;
+    Stage stage;
+    bool active;
+    std::chrono::steady_clock::time_point start;
+  };
+
+  void initialize(const std::string& localVariablePrefix, const std::string& dumpFilePath, double intervalSeconds);
+
+  // Adds a stage and its local variables, must be called before the first frame.
+  Stage addStage(const std::string& name);
+
+  void beginFrame();
+  void endFrame();
+
+  bool isEnabled() const;
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct StageStatistics {
+    std::string name;
+    std::array<uint32_t, BUCKET_COUNT> buckets = {};
+    uint64_t count = 0;
+    double totalUs = 0;
+    double maximumUs = 0;
+    uint64_t intervalCount = 0;
+    double intervalTotalUs = 0;
+    double intervalMaximumUs = 0;
+    std::unique_ptr<LocalVariable> idAverage;
+    std::unique_ptr<LocalVariable> idMaximum;
+  };
+
+  std::string prefix;
+  std::string dumpFilePath;
+  double intervalSeconds = 10;
+
+  bool enabled = false;
+  std::unique_ptr<LocalVariable> idEnabled;
+
+  Stage frameStage = 0;
+  Clock::time_point frameStart;
+  Clock::time_point intervalStart;
+
+  uint32_t stageCount = 0;
+  std::array<StageStatistics, MAX_STAGE_COUNT> stages;
+
+  void record(Stage stage, double durationUs);
+
+  void reset();
+
+  void publish();
+
+  void dump();
+};
@@ -0,0 +1,67 @@
+#include "FrameScheduler.h"
+
+#include <utility>
+
+void FrameScheduler::initialize(double budget) {
+  budgetSeconds = budget;
+}
+
+FrameScheduler::Task FrameScheduler::addTask(const std::string& name, uint32_t maxStaleFrames, TaskFunction function) {
+  tasks.push_back({name, maxStaleFrames, std::move(function), 0, 0});
+  return static_cast<Task>(tasks.size() - 1);
+}
+
+bool FrameScheduler::run(double sampleTime, std::chrono::steady_clock::time_point frameStart) {
+  bool result = true;
+
+  for (TaskState& task : tasks) {
+    task.staleFrames++;
+    task.accumulatedSampleTime += sampleTime;
+  }
+
+  // tasks that reached their maximum staleness run regardless of the budget
+  for (TaskState& task : tasks) {
+    if (task.staleFrames > task.maxStaleFrames) {
+      result &= runTask(task);
+    }
+  }
+
+  // the others run while budget is left, the one that waited longest relative to its staleness first
+  deferredCount = 0;
+  while (true) {
+    TaskState* next = nullptr;
+    for (TaskState& task : tasks) {
+      if (task.staleFrames > 0 &&
+          (next == nullptr || task.staleFrames * next->maxStaleFrames > next->staleFrames * task.maxStaleFrames)) {
+        next = &task;
+      }
+    }
+    if (next == nullptr) {
+      break;
+    }
+
+    if (std::chrono::duration<double>(std::chrono::steady_clock::now() - frameStart).count() >= budgetSeconds) {
+      for (const TaskState& task : tasks) {
+        if (task.staleFrames > 0) {
+          deferredCount++;
+        }
+      }
+      break;
+    }
+
+    result &= runTask(*next);
+  }
+
+  return result;
+}
+
+uint32_t FrameScheduler::getDeferredCount() const {
+  return deferredCount;
+}
+
+bool FrameScheduler::runTask(TaskState& task) {
+  bool result = task.function(task.accumulatedSampleTime);
+  task.staleFrames = 0;
+  task.accumulatedSampleTime = 0;
+  return result;
+}
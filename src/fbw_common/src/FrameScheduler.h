@@ -0,0 +1,43 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Runs the deferrable work of a frame, i.e. stages that do not feed the laws or computers within the same frame.
+// Hard real-time stages are called directly by the owner every frame, deferrable stages are added as tasks with a
+// maximum staleness in frames. A task runs when the frame still has budget left, the least recently run task first, and
+// always once it reached its maximum staleness. On busy frames the deferrable work is thereby spread across frames.
+class FrameScheduler {
+ public:
+  using Task = uint32_t;
+  // receives the sample time accumulated since the task last ran
+  using TaskFunction = std::function<bool(double)>;
+
+  void initialize(double budgetSeconds);
+
+  Task addTask(const std::string& name, uint32_t maxStaleFrames, TaskFunction function);
+
+  // Runs the due tasks, the budget is measured from the given start of the frame.
+  bool run(double sampleTime, std::chrono::steady_clock::time_point frameStart);
+
+  // Number of task runs that were deferred in the last frame.
+  uint32_t getDeferredCount() const;
+
+ private:
+  struct TaskState {
+    std::string name;
+    uint32_t maxStaleFrames;
+    TaskFunction function;
+    uint32_t staleFrames;
+    double accumulatedSampleTime;
+  };
+
+  double budgetSeconds = 0;
+  std::vector<TaskState> tasks;
+  uint32_t deferredCount = 0;
+
+  bool runTask(TaskState& task);
+};
@@ -1,69 +1,293 @@
 #include "LocalVariable.h"
 
-using std::cout;
-using std::endl;
-using std::set;
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+
 using std::string;
+using std::vector;
+
+namespace {
+struct LocalVariableRegistry {
+  // one entry per handle
+  vector<ID> ids;
+  vector<double> values;
+  // value the sim is known to hold, from the last write or read
+  vector<double> publishedValues;
+  vector<uint8_t> useDirtyState;
+  vector<uint8_t> isDirty;
+  vector<uint8_t> writePending;
+  vector<uint8_t> inUse;
+  vector<uint8_t> isRegistered;
+  vector<LocalVariable::ReadGroup> readGroups;
+  vector<string> names;
+  // released handles, reused by the next registration
+  vector<uint32_t> freeIndices;
+  // handles of the members of each read group
+  vector<vector<uint32_t>> groupMembers = vector<vector<uint32_t>>(1);
+  // handles set since the last writeAll()
+  vector<uint32_t> pendingWrites;
+
+  uint32_t registeredCount = 0;
+
+  LocalVariable::FrameStatistics statistics = {};
+  LocalVariable::FrameStatistics lastFrameStatistics = {};
+
+  // registers the variable with the sim and reads the value the sim holds
+  void registerVariable(uint32_t index) {
+    ids[index] = register_named_variable(names[index].c_str());
+    isRegistered[index] = true;
+    registeredCount++;
+    publishedValues[index] = get_named_variable_value(ids[index]);
+    statistics.reads++;
+  }
+
+  void join(uint32_t index, LocalVariable::ReadGroup group) {
+    readGroups[index] = group;
+    groupMembers[group].push_back(index);
+  }
+
+  void leave(uint32_t index) {
+    if (readGroups[index] == LocalVariable::READ_GROUP_ON_FIRST_USE) {
+      return;
+    }
+    vector<uint32_t>& members = groupMembers[readGroups[index]];
+    members.erase(std::find(members.begin(), members.end(), index));
+    readGroups[index] = LocalVariable::READ_GROUP_ON_FIRST_USE;
+  }
+};
+
+LocalVariableRegistry& registry() {
+  static LocalVariableRegistry instance;
+  return instance;
+}
 
-set<LocalVariable*> LocalVariable::LOCAL_VARIABLES;
+// Storage of the handles themselves: fixed blocks of slots instead of one heap allocation per variable. The arena is
+// never destroyed, handles may still be released during static destruction.
+struct LocalVariableArena {
+  using Slot = std::aligned_storage_t<sizeof(LocalVariable), alignof(LocalVariable)>;
+  static constexpr size_t BLOCK_SIZE = 512;
 
-LocalVariable::LocalVariable(const string& variable, bool shouldUseDirtyState) {
+  vector<std::unique_ptr<Slot[]>> blocks;
+  size_t usedInLastBlock = BLOCK_SIZE;
+  vector<void*> freeSlots;
+
+  void* allocate() {
+    if (!freeSlots.empty()) {
+      void* slot = freeSlots.back();
+      freeSlots.pop_back();
+      return slot;
+    }
+    if (usedInLastBlock == BLOCK_SIZE) {
+      blocks.push_back(std::make_unique<Slot[]>(BLOCK_SIZE));
+      usedInLastBlock = 0;
+    }
+    return &blocks.back()[usedInLastBlock++];
+  }
+
+  void release(void* slot) { freeSlots.push_back(slot); }
+};
+
+LocalVariableArena& arena() {
+  static LocalVariableArena* instance = new LocalVariableArena();
+  return *instance;
+}
+}  // namespace
+
+LocalVariable::LocalVariable(std::string_view variable, bool shouldUseDirtyState, ReadGroup readGroup) {
+  LocalVariableRegistry& r = registry();
+  // reserve a handle
+  if (!r.freeIndices.empty()) {
+    index = r.freeIndices.back();
+    r.freeIndices.pop_back();
+  } else {
+    index = static_cast<uint32_t>(r.ids.size());
+    r.ids.push_back(0);
+    r.values.push_back(0.0);
+    r.publishedValues.push_back(0.0);
+    r.useDirtyState.push_back(false);
+    r.isDirty.push_back(false);
+    r.writePending.push_back(false);
+    r.inUse.push_back(false);
+    r.isRegistered.push_back(false);
+    r.readGroups.push_back(READ_GROUP_ON_FIRST_USE);
+    r.names.emplace_back();
+  }
   // initialize variables
-  useDirtyState = shouldUseDirtyState;
-  isDirty = false;
-  value = 0.0;
-  name = variable;
-  // register variable
-  id = register_named_variable(name.c_str());
-  // read current value
-  read();
-  // remember in global list (for readAll)
-  LOCAL_VARIABLES.insert(this);
+  r.useDirtyState[index] = shouldUseDirtyState;
+  r.isDirty[index] = false;
+  r.writePending[index] = false;
+  r.inUse[index] = true;
+  r.isRegistered[index] = false;
+  r.names[index].assign(variable);
+  // variables of a read group are registered and read right away, the others on first use
+  if (readGroup != READ_GROUP_ON_FIRST_USE) {
+    read();
+    r.join(index, readGroup);
+  }
 }
 
 LocalVariable::~LocalVariable() {
-  LOCAL_VARIABLES.erase(this);
+  LocalVariableRegistry& r = registry();
+  r.leave(index);
+  r.writePending[index] = false;
+  r.inUse[index] = false;
+  r.names[index].clear();
+  r.freeIndices.push_back(index);
+}
+
+void* LocalVariable::operator new(size_t) {
+  return arena().allocate();
+}
+
+void LocalVariable::operator delete(void* pointer) {
+  if (pointer != nullptr) {
+    arena().release(pointer);
+  }
 }
 
 string LocalVariable::getName() {
-  return name;
+  return registry().names[index];
 }
 
 double LocalVariable::get(bool shouldRead) {
+  LocalVariableRegistry& r = registry();
+  if (r.readGroups[index] == READ_GROUP_ON_FIRST_USE) {
+    // first use: from now on the value is refreshed every frame, a pending local value is kept
+    if (!r.isDirty[index]) {
+      read();
+    } else if (!r.isRegistered[index]) {
+      r.registerVariable(index);
+    }
+    r.join(index, READ_GROUP_FRAME);
+  }
   if (shouldRead) {
     read();
   }
-  return value;
+  return r.values[index];
 }
 
 void LocalVariable::set(double newValue, bool shouldWrite) {
-  value = newValue;
-  isDirty = true;
-  if (shouldWrite) {
-    write();
+  LocalVariableRegistry& r = registry();
+  r.values[index] = newValue;
+  r.isDirty[index] = true;
+  if (!shouldWrite) {
+    return;
+  }
+  // the write is deferred to writeAll(), a further set in the same frame only replaces the value
+  if (r.writePending[index]) {
+    r.statistics.coalescedSets++;
+  } else {
+    r.writePending[index] = true;
+    r.pendingWrites.push_back(index);
   }
 }
 
 void LocalVariable::read() {
-  value = get_named_variable_value(id);
+  LocalVariableRegistry& r = registry();
+  if (!r.isRegistered[index]) {
+    r.registerVariable(index);
+  } else {
+    r.publishedValues[index] = get_named_variable_value(r.ids[index]);
+    r.statistics.reads++;
+  }
+  // a value set in this frame, but not yet published, is kept
+  if (!r.writePending[index]) {
+    r.values[index] = r.publishedValues[index];
+  }
 }
 
 void LocalVariable::write() {
-  if (useDirtyState && !isDirty) {
-    return;
+  LocalVariableRegistry& r = registry();
+  if (!r.isRegistered[index]) {
+    r.registerVariable(index);
+  }
+  if (r.useDirtyState[index]) {
+    if (!r.isDirty[index]) {
+      return;
+    }
+    if (r.values[index] == r.publishedValues[index]) {
+      r.isDirty[index] = false;
+      r.statistics.unchangedWrites++;
+      return;
+    }
   }
-  set_named_variable_value(id, value);
-  isDirty = false;
+  set_named_variable_value(r.ids[index], r.values[index]);
+  r.publishedValues[index] = r.values[index];
+  r.isDirty[index] = false;
+  r.statistics.writes++;
 }
 
-void LocalVariable::readAll() {
-  for (auto variable : LOCAL_VARIABLES) {
-    variable->read();
+uint32_t LocalVariable::getHandle() const {
+  return index;
+}
+
+LocalVariable::ReadGroup LocalVariable::createReadGroup() {
+  LocalVariableRegistry& r = registry();
+  r.groupMembers.emplace_back();
+  return static_cast<ReadGroup>(r.groupMembers.size() - 1);
+}
+
+void LocalVariable::readGroup(ReadGroup group) {
+  LocalVariableRegistry& r = registry();
+  const ID* ids = r.ids.data();
+  double* values = r.values.data();
+  double* publishedValues = r.publishedValues.data();
+  const uint8_t* writePending = r.writePending.data();
+  const vector<uint32_t>& members = r.groupMembers[group];
+  for (uint32_t i : members) {
+    publishedValues[i] = get_named_variable_value(ids[i]);
+    if (!writePending[i]) {
+      values[i] = publishedValues[i];
+    }
   }
+  r.statistics.reads += static_cast<uint32_t>(members.size());
+}
+
+void LocalVariable::readAll() {
+  readGroup(READ_GROUP_FRAME);
 }
 
 void LocalVariable::writeAll() {
-  for (auto variable : LOCAL_VARIABLES) {
-    variable->write();
+  LocalVariableRegistry& r = registry();
+  for (uint32_t i : r.pendingWrites) {
+    // handles released (or already written) since the set are skipped
+    if (!r.writePending[i]) {
+      continue;
+    }
+    r.writePending[i] = false;
+    if (!r.isRegistered[i]) {
+      r.registerVariable(i);
+    }
+    if (r.useDirtyState[i]) {
+      if (!r.isDirty[i]) {
+        continue;
+      }
+      if (r.values[i] == r.publishedValues[i]) {
+        r.isDirty[i] = false;
+        r.statistics.unchangedWrites++;
+        continue;
+      }
+    }
+    set_named_variable_value(r.ids[i], r.values[i]);
+    r.publishedValues[i] = r.values[i];
+    r.isDirty[i] = false;
+    r.statistics.writes++;
   }
+  r.pendingWrites.clear();
+
+  r.lastFrameStatistics = r.statistics;
+  r.statistics = {};
+}
+
+LocalVariable::FrameStatistics LocalVariable::getFrameStatistics() {
+  return registry().lastFrameStatistics;
+}
+
+const double* LocalVariable::getValues() {
+  return registry().values.data();
+}
+
+uint32_t LocalVariable::getRegisteredCount() {
+  return registry().registeredCount;
 }
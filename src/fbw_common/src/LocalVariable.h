@@ -1,17 +1,52 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
-#include <set>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #include <MSFS/Legacy/gauges.h>
 
+// Handle to a local variable. The IDs and values of all local variables are kept in a contiguous registry (parallel
+// arrays indexed by the handle), so that batched reads and writes are linear passes over plain arrays.
+//
+// Batched reads are organized in read groups. readAll() refreshes READ_GROUP_FRAME, which a variable constructed
+// without a group joins the first time its value is used. Variables that are only written are therefore never read.
+// Variables which are only needed now and then can be put in a group of their own and refreshed with readGroup().
+//
+// Writes are coalesced: set() only marks the variable, and writeAll() publishes each marked variable once at the end
+// of the frame. A value equal to the one last published (or read) is not written again, unless the variable does not
+// use the dirty state. Until it is published, a value that was set is not replaced by reads.
+//
+// A variable constructed without a group is registered with the sim only when it is first used (read or written), so
+// variables that are rarely or never used do not slow down the start. The handles are allocated from a shared arena.
 class LocalVariable {
  public:
-  explicit LocalVariable(const std::string& name, bool shouldUseDirtyState = true);
+  using ReadGroup = uint32_t;
+  static constexpr ReadGroup READ_GROUP_FRAME = 0;
+  static constexpr ReadGroup READ_GROUP_ON_FIRST_USE = UINT32_MAX;
+
+  // gauge API calls and avoided calls of one frame
+  struct FrameStatistics {
+    uint32_t reads;
+    uint32_t writes;
+    uint32_t unchangedWrites;
+    uint32_t coalescedSets;
+  };
+
+  // The name is copied, so it can be a literal, one of the constexpr name tables or a temporary string.
+  explicit LocalVariable(std::string_view name, bool shouldUseDirtyState = true, ReadGroup readGroup = READ_GROUP_ON_FIRST_USE);
   ~LocalVariable();
 
+  LocalVariable(const LocalVariable&) = delete;
+  LocalVariable& operator=(const LocalVariable&) = delete;
+
+  static void* operator new(size_t size);
+  static void operator delete(void* pointer);
+
   std::string getName();
 
   double get(bool shouldRead = false);
@@ -20,15 +55,24 @@ class LocalVariable {
   void read();
   void write();
 
+  // Handle of the variable in the registry, the index of its value in getValues().
+  uint32_t getHandle() const;
+
+  static ReadGroup createReadGroup();
+  static void readGroup(ReadGroup group);
+
   static void readAll();
+  // publishes the pending writes and completes the frame statistics
   static void writeAll();
 
- private:
-  static std::set<LocalVariable*> LOCAL_VARIABLES;
+  static FrameStatistics getFrameStatistics();
+
+  // Values of all variables indexed by handle, for bulk access. Valid until the next variable is registered.
+  static const double* getValues();
 
-  ID id;
-  std::string name;
-  bool useDirtyState;
-  bool isDirty;
-  double value;
+  // Number of variables registered with the sim so far.
+  static uint32_t getRegisteredCount();
+
+ private:
+  uint32_t index;
 };
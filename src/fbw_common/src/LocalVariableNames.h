@@ -0,0 +1,30 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+// Compile-time tables of local variable names that differ only in the unit number, e.g.
+// A32NX_LEFT_SPOILER_1_COMMANDED_POSITION to A32NX_LEFT_SPOILER_8_COMMANDED_POSITION. The names are built by the
+// compiler, so registering them does not need any string concatenation at startup.
+//
+//   constexpr auto NAMES = indexedLocalVariableNames<8>("A32NX_LEFT_SPOILER_", "_COMMANDED_POSITION");
+//   std::make_unique<LocalVariable>(NAMES[i].data());
+//
+// The unit numbers start at 1 and must be single digits.
+template <size_t COUNT, size_t PREFIX_SIZE, size_t SUFFIX_SIZE>
+constexpr std::array<std::array<char, PREFIX_SIZE + SUFFIX_SIZE>, COUNT> indexedLocalVariableNames(const char (&prefix)[PREFIX_SIZE],
+                                                                                                  const char (&suffix)[SUFFIX_SIZE]) {
+  static_assert(COUNT >= 1 && COUNT <= 9, "unit numbers must be single digits");
+  std::array<std::array<char, PREFIX_SIZE + SUFFIX_SIZE>, COUNT> names = {};
+  for (size_t i = 0; i < COUNT; i++) {
+    // both sizes include the terminating null, which leaves room for the digit
+    for (size_t j = 0; j < PREFIX_SIZE - 1; j++) {
+      names[i][j] = prefix[j];
+    }
+    names[i][PREFIX_SIZE - 1] = static_cast<char>('1' + i);
+    for (size_t j = 0; j < SUFFIX_SIZE; j++) {
+      names[i][PREFIX_SIZE + j] = suffix[j];
+    }
+  }
+  return names;
+}
@@ -0,0 +1,75 @@
+#include "SimulationRateGovernor.h"
+
+void SimulationRateGovernor::initialize(const Parameters& newParameters) {
+  parameters = newParameters;
+  isFilterInitialized = false;
+  reset();
+}
+
+SimulationRateGovernor::Command SimulationRateGovernor::update(double newFrameTime,
+                                                               double newComputeTime,
+                                                               double simulationRate,
+                                                               double requestedSimulationRate,
+                                                               bool isIncreaseAllowed,
+                                                               bool isDecreaseAllowed) {
+  if (newFrameTime <= 0) {
+    return Command::NONE;
+  }
+
+  // first order low pass, a single slow frame should not change the rate
+  if (!isFilterInitialized) {
+    frameTime = newFrameTime;
+    computeTime = newComputeTime;
+    isFilterInitialized = true;
+  } else {
+    double factor = newFrameTime / (parameters.filterTimeConstant + newFrameTime);
+    frameTime += factor * (newFrameTime - frameTime);
+    computeTime += factor * (newComputeTime - computeTime);
+  }
+
+  // decrease when the current rate exceeds the stable sample time
+  if (isDecreaseAllowed && simulationRate > 1 && simulationRate * frameTime > parameters.maxSampleTime) {
+    decreaseTimer += newFrameTime;
+  } else {
+    decreaseTimer = 0;
+  }
+
+  // increase when the doubled rate stays clearly below the stable sample time and the budget allows it
+  if (isIncreaseAllowed && simulationRate < requestedSimulationRate &&
+      2 * simulationRate * frameTime <= parameters.increaseMargin * parameters.maxSampleTime &&
+      computeTime <= parameters.computeBudgetShare * frameTime) {
+    increaseTimer += newFrameTime;
+  } else {
+    increaseTimer = 0;
+  }
+
+  if (decreaseTimer >= parameters.decreaseDelay) {
+    reset();
+    return Command::DECREASE;
+  }
+  if (increaseTimer >= parameters.increaseDelay) {
+    reset();
+    return Command::INCREASE;
+  }
+  return Command::NONE;
+}
+
+void SimulationRateGovernor::reset() {
+  increaseTimer = 0;
+  decreaseTimer = 0;
+}
+
+double SimulationRateGovernor::getMaximumSimulationRate() const {
+  if (frameTime <= 0) {
+    return 0;
+  }
+  return parameters.maxSampleTime / frameTime;
+}
+
+double SimulationRateGovernor::getFrameTime() const {
+  return frameTime;
+}
+
+double SimulationRateGovernor::getComputeTime() const {
+  return computeTime;
+}
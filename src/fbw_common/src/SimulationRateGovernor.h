@@ -0,0 +1,59 @@
+#pragma once
+
+// Predicts the highest simulation rate at which the laws still run with a stable sample time and steps the simulation
+// rate towards the rate requested by the user.
+//
+// The sample time of the laws is the real frame time multiplied by the simulation rate, so the highest stable rate
+// follows from the filtered frame time. A decrease is commanded when the current rate exceeds the stable sample time
+// for a short while, an increase only when the doubled rate stays clearly below it for a longer time and the fly-by-wire
+// stack itself does not need most of the frame. The gap between both thresholds keeps the rate from oscillating.
+class SimulationRateGovernor {
+ public:
+  enum class Command { NONE, INCREASE, DECREASE };
+
+  struct Parameters {
+    // longest sample time the laws are stable with in s
+    double maxSampleTime;
+    // share of the maximum sample time the predicted sample time must stay below for an increase
+    double increaseMargin = 0.8;
+    // share of the frame time the fly-by-wire stack may use for an increase
+    double computeBudgetShare = 0.5;
+    // time in s the conditions must hold for an increase or decrease
+    double increaseDelay = 5;
+    double decreaseDelay = 0.5;
+    // time constant in s of the frame time and compute time filters
+    double filterTimeConstant = 1;
+  };
+
+  void initialize(const Parameters& parameters);
+
+  // Frame time is the real time since the last frame, compute time the time the fly-by-wire stack needed for the last
+  // frame, both in s. The simulation rate is never increased above the requested one or decreased below 1. While an
+  // increase or decrease is not allowed, e.g. in an abnormal situation or when the user disabled the reduction, its delay
+  // does not run, so an increase always follows the full delay after the situation is normal again.
+  Command update(double frameTime,
+                 double computeTime,
+                 double simulationRate,
+                 double requestedSimulationRate,
+                 bool isIncreaseAllowed,
+                 bool isDecreaseAllowed);
+
+  // Restarts the delays, e.g. after the simulation rate was changed.
+  void reset();
+
+  // Highest simulation rate with a stable sample time for the current frame time, 0 until a frame was measured.
+  double getMaximumSimulationRate() const;
+
+  double getFrameTime() const;
+  double getComputeTime() const;
+
+ private:
+  Parameters parameters = {};
+
+  double frameTime = 0;
+  double computeTime = 0;
+  bool isFilterInitialized = false;
+
+  double increaseTimer = 0;
+  double decreaseTimer = 0;
+};
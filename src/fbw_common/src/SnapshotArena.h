@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+// Preallocated byte arena holding flat snapshots of model and computer state.
+// Objects are copied in and out with memcpy, so only types made of plain data (no pointers, no heap-owned members)
+// may be stored. An object must be restored into the instance it was taken from, or into one constructed with the
+// same arguments. Objects are read back in the order they were written; rewind() allows restoring the same snapshot
+// multiple times.
+class SnapshotArena {
+ public:
+  explicit SnapshotArena(size_t capacity) : buffer(capacity) {}
+
+  template <typename T>
+  bool save(const T& object) {
+    if (writeOffset + sizeof(T) > buffer.size()) {
+      return false;
+    }
+    std::memcpy(buffer.data() + writeOffset, static_cast<const void*>(&object), sizeof(T));
+    writeOffset += sizeof(T);
+    return true;
+  }
+
+  template <typename T>
+  bool restore(T& object) {
+    if (readOffset + sizeof(T) > writeOffset) {
+      return false;
+    }
+    std::memcpy(static_cast<void*>(&object), buffer.data() + readOffset, sizeof(T));
+    readOffset += sizeof(T);
+    return true;
+  }
+
+  void rewind() { readOffset = 0; }
+
+  void clear() {
+    writeOffset = 0;
+    readOffset = 0;
+  }
+
+  [[nodiscard]] size_t size() const { return writeOffset; }
+
+  [[nodiscard]] size_t capacity() const { return buffer.size(); }
+
+ private:
+  std::vector<unsigned char> buffer;
+  size_t writeOffset = 0;
+  size_t readOffset = 0;
+};
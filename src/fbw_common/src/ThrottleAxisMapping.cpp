@@ -33,21 +33,23 @@ ThrottleAxisMapping::ThrottleAxisMapping(unsigned int id) {
   idInputValue = std::make_unique<LocalVariable>(LVAR_INPUT_VALUE.c_str());
   idThrustLeverAngle = std::make_unique<LocalVariable>(LVAR_THRUST_LEVER_ANGLE.c_str());
   idUsingConfig = std::make_unique<LocalVariable>(LVAR_LOAD_CONFIG.c_str());
-  idUseReverseOnAxis = std::make_unique<LocalVariable>(LVAR_USE_REVERSE_ON_AXIS.c_str());
-  idIncrementNormal = std::make_unique<LocalVariable>(LVAR_INCREMENT_NORMAL.c_str());
-  idIncrementSmall = std::make_unique<LocalVariable>(LVAR_INCREMENT_SMALL.c_str());
-  idDetentReverseLow = std::make_unique<LocalVariable>(LVAR_DETENT_REVERSE_LOW.c_str());
-  idDetentReverseHigh = std::make_unique<LocalVariable>(LVAR_DETENT_REVERSE_HIGH.c_str());
-  idDetentReverseIdleLow = std::make_unique<LocalVariable>(LVAR_DETENT_REVERSEIDLE_LOW.c_str());
-  idDetentReverseIdleHigh = std::make_unique<LocalVariable>(LVAR_DETENT_REVERSEIDLE_HIGH.c_str());
-  idDetentIdleLow = std::make_unique<LocalVariable>(LVAR_DETENT_IDLE_LOW.c_str());
-  idDetentIdleHigh = std::make_unique<LocalVariable>(LVAR_DETENT_IDLE_HIGH.c_str());
-  idDetentClimbLow = std::make_unique<LocalVariable>(LVAR_DETENT_CLIMB_LOW.c_str());
-  idDetentClimbHigh = std::make_unique<LocalVariable>(LVAR_DETENT_CLIMB_HIGH.c_str());
-  idDetentFlexMctLow = std::make_unique<LocalVariable>(LVAR_DETENT_FLEXMCT_LOW.c_str());
-  idDetentFlexMctHigh = std::make_unique<LocalVariable>(LVAR_DETENT_FLEXMCT_HIGH.c_str());
-  idDetentTogaLow = std::make_unique<LocalVariable>(LVAR_DETENT_TOGA_LOW.c_str());
-  idDetentTogaHigh = std::make_unique<LocalVariable>(LVAR_DETENT_TOGA_HIGH.c_str());
+  // the configuration is only read when it is loaded
+  configurationReadGroup = LocalVariable::createReadGroup();
+  idUseReverseOnAxis = std::make_unique<LocalVariable>(LVAR_USE_REVERSE_ON_AXIS.c_str(), true, configurationReadGroup);
+  idIncrementNormal = std::make_unique<LocalVariable>(LVAR_INCREMENT_NORMAL.c_str(), true, configurationReadGroup);
+  idIncrementSmall = std::make_unique<LocalVariable>(LVAR_INCREMENT_SMALL.c_str(), true, configurationReadGroup);
+  idDetentReverseLow = std::make_unique<LocalVariable>(LVAR_DETENT_REVERSE_LOW.c_str(), true, configurationReadGroup);
+  idDetentReverseHigh = std::make_unique<LocalVariable>(LVAR_DETENT_REVERSE_HIGH.c_str(), true, configurationReadGroup);
+  idDetentReverseIdleLow = std::make_unique<LocalVariable>(LVAR_DETENT_REVERSEIDLE_LOW.c_str(), true, configurationReadGroup);
+  idDetentReverseIdleHigh = std::make_unique<LocalVariable>(LVAR_DETENT_REVERSEIDLE_HIGH.c_str(), true, configurationReadGroup);
+  idDetentIdleLow = std::make_unique<LocalVariable>(LVAR_DETENT_IDLE_LOW.c_str(), true, configurationReadGroup);
+  idDetentIdleHigh = std::make_unique<LocalVariable>(LVAR_DETENT_IDLE_HIGH.c_str(), true, configurationReadGroup);
+  idDetentClimbLow = std::make_unique<LocalVariable>(LVAR_DETENT_CLIMB_LOW.c_str(), true, configurationReadGroup);
+  idDetentClimbHigh = std::make_unique<LocalVariable>(LVAR_DETENT_CLIMB_HIGH.c_str(), true, configurationReadGroup);
+  idDetentFlexMctLow = std::make_unique<LocalVariable>(LVAR_DETENT_FLEXMCT_LOW.c_str(), true, configurationReadGroup);
+  idDetentFlexMctHigh = std::make_unique<LocalVariable>(LVAR_DETENT_FLEXMCT_HIGH.c_str(), true, configurationReadGroup);
+  idDetentTogaLow = std::make_unique<LocalVariable>(LVAR_DETENT_TOGA_LOW.c_str(), true, configurationReadGroup);
+  idDetentTogaHigh = std::make_unique<LocalVariable>(LVAR_DETENT_TOGA_HIGH.c_str(), true, configurationReadGroup);
 }
 
 void ThrottleAxisMapping::setInFlight() {
@@ -299,6 +301,7 @@ ThrottleAxisMapping::Configuration ThrottleAxisMapping::getDefaultConfiguration(
 
 ThrottleAxisMapping::Configuration ThrottleAxisMapping::loadConfigurationFromLocalVariables() {
   idUsingConfig->set(true);
+  LocalVariable::readGroup(configurationReadGroup);
   return {idUseReverseOnAxis->get() == 1, idIncrementNormal->get(),      idIncrementSmall->get(),        idDetentReverseLow->get(),
           idDetentReverseHigh->get(),     idDetentReverseIdleLow->get(), idDetentReverseIdleHigh->get(), idDetentIdleLow->get(),
           idDetentIdleHigh->get(),        idDetentClimbLow->get(),       idDetentClimbHigh->get(),       idDetentFlexMctLow->get(),
@@ -101,6 +101,7 @@ class ThrottleAxisMapping {
   std::unique_ptr<LocalVariable> idInputValue;
   std::unique_ptr<LocalVariable> idThrustLeverAngle;
 
+  LocalVariable::ReadGroup configurationReadGroup = LocalVariable::READ_GROUP_FRAME;
   std::unique_ptr<LocalVariable> idUsingConfig;
   std::unique_ptr<LocalVariable> idUseReverseOnAxis;
   std::unique_ptr<LocalVariable> idIncrementNormal;
@@ -0,0 +1,766 @@
+#include "ClosedLoopSimulation.h"
+
+#include <cmath>
+
+#include "Arinc429.h"
+
+namespace {
+constexpr double DEG_TO_RAD = M_PI / 180.0;
+constexpr double RAD_TO_DEG = 180.0 / M_PI;
+constexpr double M_TO_FT = 3.280840;
+constexpr double M_PER_NM = 1852.0;
+constexpr double M_PER_DEG_LAT = 111120.0;
+
+// reference position of the runway threshold
+constexpr double THRESHOLD_LAT = 45.0;
+constexpr double THRESHOLD_LON = 0.0;
+
+// ILS installation (runway aligned with true north, threshold at the origin)
+constexpr double LOCALIZER_NORTH_M = 3300.0;
+constexpr double GLIDE_SLOPE_NORTH_M = 300.0;
+constexpr double GLIDE_SLOPE_ANGLE_DEG = 3.0;
+
+// slat and flap feedback position pick-off angles in configuration FULL
+constexpr double SLAT_FPPU_FULL_DEG = 334.16;
+constexpr double FLAP_FPPU_FULL_DEG = 251.97;
+
+constexpr double HYD_PRESSURE_PSI = 3000;
+
+base_arinc_429 normalOperation(double data) {
+  base_arinc_429 word = {};
+  word.SSM = Arinc429SignStatus::NormalOperation;
+  word.Data = data;
+  return word;
+}
+
+base_arinc_429 discreteWord(std::initializer_list<int> bits) {
+  Arinc429DiscreteWord word;
+  word.setFromData(0, Arinc429SignStatus::NormalOperation);
+  for (int bit : bits) {
+    word.setBit(bit, true);
+  }
+  return *reinterpret_cast<base_arinc_429*>(&word);
+}
+
+double latitudeFromNorth(double north) {
+  return THRESHOLD_LAT + north / M_PER_DEG_LAT;
+}
+
+double longitudeFromEast(double east) {
+  return THRESHOLD_LON + east / (M_PER_DEG_LAT * std::cos(THRESHOLD_LAT * DEG_TO_RAD));
+}
+}  // namespace
+
+void ClosedLoopSimulation::initialize(const Scenario& scenario) {
+  massKg = scenario.massKg;
+  simulationTime = 0;
+
+  autopilotStateMachine.initialize();
+  autopilotLaws.initialize();
+  autoThrust.initialize();
+
+  double speed = scenario.approachSpeedKn / 1.943844;
+  double altitude = scenario.startAltitudeFt / M_TO_FT;
+  double rho = 1.225 * std::pow(1 - 2.25577e-5 * altitude, 4.25588);
+  double trueSpeed = speed * std::sqrt(1.225 / rho);
+
+  // trimmed 1g level flight in approach configuration
+  double liftCoefficient = massKg * 9.80665 / (0.5 * rho * trueSpeed * trueSpeed * 122.6);
+  double alpha = (liftCoefficient - 1.25) / 5.5;
+
+  PlantState initialState;
+  initialState.north = -scenario.startDistanceNm * M_PER_NM;
+  initialState.east = scenario.lateralOffsetM;
+  initialState.down = -altitude;
+  initialState.u = trueSpeed * std::cos(alpha);
+  initialState.w = trueSpeed * std::sin(alpha);
+  initialState.theta = alpha;
+  initialState.psi = scenario.headingOffsetDeg * DEG_TO_RAD;
+  initialState.thsDeg = (0.12 - 2.5 * alpha) / 0.05;
+  initialState.n1[0] = initialState.n1[1] = 55;
+  plant.reset(initialState, massKg);
+
+  crewInputs = CrewInputs();
+  crewInputs.V_fcu_kn = scenario.approachSpeedKn;
+  crewInputs.H_fcu_ft = scenario.goAroundTargetAltitudeFt;
+  crewInputs.Psi_fcu_deg = std::fmod(scenario.headingOffsetDeg + 360, 360);
+
+  approachSpeedKn = scenario.approachSpeedKn;
+}
+
+const RecordedSignal ClosedLoopSimulation::recordedSignals[RECORDED_SIGNAL_COUNT] = {
+    {"ap_theta_c_deg", 0.1},
+    {"ap_phi_c_deg", 0.1},
+    {"ap_beta_c_deg", 0.1},
+    {"athr_n1_c_1_percent", 0.2},
+    {"elac_1_left_elev_pos_order_deg", 0.1},
+    {"elac_2_left_elev_pos_order_deg", 0.1},
+    {"elac_1_ths_pos_order_deg", 0.05},
+    {"elac_2_ths_pos_order_deg", 0.05},
+    {"elac_1_left_aileron_pos_order_deg", 0.1},
+    {"elac_1_right_aileron_pos_order_deg", 0.1},
+    {"sec_1_left_spoiler_1_pos_order_deg", 0.1},
+    {"fac_1_yaw_damper_order_deg", 0.1},
+    {"fac_1_v_ls_kn", 0.5},
+    {"fac_1_v_max_kn", 0.5},
+};
+
+void ClosedLoopSimulation::update(double sampleTime) {
+  simulationTime += sampleTime;
+
+  updateComputers(sampleTime);
+  updatePlant(sampleTime);
+
+  // push buttons are momentary
+  crewInputs.AP_1_push = false;
+  crewInputs.ATHR_push = false;
+  crewInputs.APPR_push = false;
+}
+
+void ClosedLoopSimulation::replay(double sampleTime, const PlantState& state, const PlantOutputs& outputs) {
+  simulationTime += sampleTime;
+
+  plant.restore(state, outputs);
+  updateComputers(sampleTime);
+
+  crewInputs.AP_1_push = false;
+  crewInputs.ATHR_push = false;
+  crewInputs.APPR_push = false;
+}
+
+void ClosedLoopSimulation::getRecordedSignals(double (&signals)[RECORDED_SIGNAL_COUNT]) const {
+  signals[0] = autopilotLawsOutput.autopilot.Theta_c_deg;
+  signals[1] = autopilotLawsOutput.autopilot.Phi_c_deg;
+  signals[2] = autopilotLawsOutput.autopilot.Beta_c_deg;
+  signals[3] = autoThrustOutput.N1_c_1_percent;
+  signals[4] = elacsAnalogOutputs[0].left_elev_pos_order_deg;
+  signals[5] = elacsAnalogOutputs[1].left_elev_pos_order_deg;
+  signals[6] = elacsAnalogOutputs[0].ths_pos_order;
+  signals[7] = elacsAnalogOutputs[1].ths_pos_order;
+  signals[8] = elacsAnalogOutputs[0].left_aileron_pos_order;
+  signals[9] = elacsAnalogOutputs[0].right_aileron_pos_order;
+  signals[10] = secsAnalogOutputs[0].left_spoiler_1_pos_order_deg;
+  signals[11] = facsAnalogOutputs[0].yaw_damper_order_deg;
+  signals[12] = facsBusOutputs[0].v_ls_kn.Data;
+  signals[13] = facsBusOutputs[0].v_max_kn.Data;
+}
+
+bool ClosedLoopSimulation::saveState(SnapshotArena& arena) const {
+  if (!(arena.save(plant) && arena.save(crewInputs) && arena.save(simulationTime) && arena.save(localizerDeviationDeg) &&
+        arena.save(glideSlopeDeviationDeg) && arena.save(dmeDistanceNm) && arena.save(autopilotStateMachine) &&
+        arena.save(autopilotStateMachineOutput) && arena.save(autopilotLaws) && arena.save(autopilotLawsOutput) &&
+        arena.save(autoThrust) && arena.save(autoThrustOutput))) {
+    return false;
+  }
+
+  for (int i = 0; i < 2; i++) {
+    if (!elacs[i].saveState(arena)) {
+      return false;
+    }
+  }
+
+  for (int i = 0; i < 3; i++) {
+    if (!secs[i].saveState(arena)) {
+      return false;
+    }
+  }
+
+  for (int i = 0; i < 2; i++) {
+    if (!fcdcs[i].saveState(arena)) {
+      return false;
+    }
+  }
+
+  for (int i = 0; i < 2; i++) {
+    if (!facs[i].saveState(arena)) {
+      return false;
+    }
+  }
+
+  return arena.save(elacsDiscreteOutputs) && arena.save(elacsAnalogOutputs) && arena.save(elacsBusOutputs) &&
+         arena.save(secsDiscreteOutputs) && arena.save(secsAnalogOutputs) && arena.save(secsBusOutputs) &&
+         arena.save(fcdcsDiscreteOutputs) && arena.save(fcdcsBusOutputs) && arena.save(facsDiscreteOutputs) &&
+         arena.save(facsAnalogOutputs) && arena.save(facsBusOutputs);
+}
+
+bool ClosedLoopSimulation::restoreState(SnapshotArena& arena) {
+  if (!(arena.restore(plant) && arena.restore(crewInputs) && arena.restore(simulationTime) && arena.restore(localizerDeviationDeg) &&
+        arena.restore(glideSlopeDeviationDeg) && arena.restore(dmeDistanceNm) && arena.restore(autopilotStateMachine) &&
+        arena.restore(autopilotStateMachineOutput) && arena.restore(autopilotLaws) && arena.restore(autopilotLawsOutput) &&
+        arena.restore(autoThrust) && arena.restore(autoThrustOutput))) {
+    return false;
+  }
+
+  for (int i = 0; i < 2; i++) {
+    if (!elacs[i].restoreState(arena)) {
+      return false;
+    }
+  }
+
+  for (int i = 0; i < 3; i++) {
+    if (!secs[i].restoreState(arena)) {
+      return false;
+    }
+  }
+
+  for (int i = 0; i < 2; i++) {
+    if (!fcdcs[i].restoreState(arena)) {
+      return false;
+    }
+  }
+
+  for (int i = 0; i < 2; i++) {
+    if (!facs[i].restoreState(arena)) {
+      return false;
+    }
+  }
+
+  return arena.restore(elacsDiscreteOutputs) && arena.restore(elacsAnalogOutputs) && arena.restore(elacsBusOutputs) &&
+         arena.restore(secsDiscreteOutputs) && arena.restore(secsAnalogOutputs) && arena.restore(secsBusOutputs) &&
+         arena.restore(fcdcsDiscreteOutputs) && arena.restore(fcdcsBusOutputs) && arena.restore(facsDiscreteOutputs) &&
+         arena.restore(facsAnalogOutputs) && arena.restore(facsBusOutputs);
+}
+
+void ClosedLoopSimulation::updateComputers(double sampleTime) {
+  updateNavigation();
+  updateSensors();
+
+  updateAutopilotStateMachine(sampleTime);
+  updateAutopilotLaws(sampleTime);
+  updateAutothrust(sampleTime);
+
+  for (int i = 0; i < 2; i++) {
+    updateElac(sampleTime, i);
+  }
+
+  for (int i = 0; i < 3; i++) {
+    updateSec(sampleTime, i);
+  }
+
+  for (int i = 0; i < 2; i++) {
+    updateFcdc(sampleTime, i);
+  }
+
+  for (int i = 0; i < 2; i++) {
+    updateFac(sampleTime, i);
+  }
+}
+
+void ClosedLoopSimulation::updateNavigation() {
+  const PlantState& state = plant.getState();
+
+  double height = -state.down;
+  double distanceToLocalizer = LOCALIZER_NORTH_M - state.north;
+  double distanceToGlideSlope = GLIDE_SLOPE_NORTH_M - state.north;
+
+  // same sign convention as the simulator: positive when the aircraft is left of the localizer course or above the
+  // glide slope
+  localizerDeviationDeg = std::atan2(-state.east, distanceToLocalizer) * RAD_TO_DEG;
+  glideSlopeDeviationDeg = std::atan2(height, distanceToGlideSlope) * RAD_TO_DEG - GLIDE_SLOPE_ANGLE_DEG;
+  dmeDistanceNm = std::sqrt(distanceToLocalizer * distanceToLocalizer + state.east * state.east + height * height) / M_PER_NM;
+}
+
+void ClosedLoopSimulation::updateSensors() {
+  const PlantState& state = plant.getState();
+  const PlantOutputs& outputs = plant.getOutputs();
+
+  for (int i = 0; i < 2; i++) {
+    raBusOutputs[i].radio_height_ft = normalOperation(outputs.radioHeightFt);
+
+    // left, right and nose gear compressed (word 1 bits 26-28, word 2 bits 11-14), gear down and locked
+    if (state.onGround) {
+      lgciuBusOutputs[i].discrete_word_1 = discreteWord({23, 24, 25, 26, 27, 28, 29});
+      lgciuBusOutputs[i].discrete_word_2 = discreteWord({11, 12, 13, 14, 15});
+    } else {
+      lgciuBusOutputs[i].discrete_word_1 = discreteWord({23, 24, 25, 29});
+      lgciuBusOutputs[i].discrete_word_2 = discreteWord({15});
+    }
+    lgciuBusOutputs[i].discrete_word_3 = discreteWord({11, 12, 13});
+    lgciuBusOutputs[i].discrete_word_4 = normalOperation(0);
+
+    // configuration FULL, slats and flaps fully extended
+    sfccBusOutputs[i].slat_flap_component_status_word = discreteWord({});
+    sfccBusOutputs[i].slat_flap_system_status_word = discreteWord({21, 28, 29});
+    sfccBusOutputs[i].slat_flap_actual_position_word = discreteWord({11, 13, 14, 15, 18, 20, 21, 22, 23});
+    sfccBusOutputs[i].slat_actual_position_deg = normalOperation(SLAT_FPPU_FULL_DEG);
+    sfccBusOutputs[i].flap_actual_position_deg = normalOperation(FLAP_FPPU_FULL_DEG);
+  }
+
+  for (int i = 0; i < 3; i++) {
+    adrBusOutputs[i].altitude_corrected_ft = normalOperation(outputs.altitudeFt);
+    adrBusOutputs[i].mach = normalOperation(outputs.mach);
+    adrBusOutputs[i].airspeed_computed_kn = normalOperation(outputs.indicatedAirspeedKn);
+    adrBusOutputs[i].airspeed_true_kn = normalOperation(outputs.trueAirspeedKn);
+    adrBusOutputs[i].vertical_speed_ft_min = normalOperation(outputs.verticalSpeedFtMin);
+    adrBusOutputs[i].aoa_corrected_deg = normalOperation(outputs.alphaDeg);
+    adrBusOutputs[i].corrected_average_static_pressure = normalOperation(outputs.staticPressureHpa);
+
+    irBusOutputs[i].latitude_deg = normalOperation(latitudeFromNorth(state.north));
+    irBusOutputs[i].longitude_deg = normalOperation(longitudeFromEast(state.east));
+    irBusOutputs[i].ground_speed_kn = normalOperation(outputs.groundSpeedKn);
+    irBusOutputs[i].wind_speed_kn = normalOperation(0);
+    irBusOutputs[i].wind_direction_true_deg = normalOperation(0);
+    irBusOutputs[i].track_angle_magnetic_deg = normalOperation(outputs.trackDeg);
+    irBusOutputs[i].heading_magnetic_deg = normalOperation(outputs.headingDeg);
+    irBusOutputs[i].drift_angle_deg = normalOperation(std::remainder(outputs.trackDeg - outputs.headingDeg, 360.0));
+    irBusOutputs[i].flight_path_angle_deg = normalOperation(outputs.flightPathAngleDeg);
+    irBusOutputs[i].pitch_angle_deg = normalOperation(outputs.pitchDeg);
+    irBusOutputs[i].roll_angle_deg = normalOperation(outputs.rollDeg);
+    irBusOutputs[i].body_pitch_rate_deg_s = normalOperation(outputs.pitchRateDegS);
+    irBusOutputs[i].body_roll_rate_deg_s = normalOperation(outputs.rollRateDegS);
+    irBusOutputs[i].body_yaw_rate_deg_s = normalOperation(outputs.yawRateDegS);
+    irBusOutputs[i].body_long_accel_g = normalOperation(outputs.longAccelG);
+    irBusOutputs[i].body_lat_accel_g = normalOperation(outputs.latAccelG);
+    irBusOutputs[i].body_normal_accel_g = normalOperation(outputs.normalAccelG);
+    irBusOutputs[i].track_angle_rate_deg_s = normalOperation(outputs.yawRateDegS);
+    irBusOutputs[i].pitch_att_rate_deg_s = normalOperation(outputs.pitchAttRateDegS);
+    irBusOutputs[i].roll_att_rate_deg_s = normalOperation(outputs.rollAttRateDegS);
+    irBusOutputs[i].inertial_vertical_speed_ft_s = normalOperation(outputs.verticalSpeedFtMin / 60);
+  }
+}
+
+void ClosedLoopSimulation::fillAutopilotData(ap_raw_data& data) const {
+  const PlantState& state = plant.getState();
+  const PlantOutputs& outputs = plant.getOutputs();
+
+  // the autopilot models use the raw simulator conventions: pitch is positive nose down, bank is positive left wing
+  // down and the body rates are in the simulator axes (x right, y up, z forward)
+  data.aircraft_position.lat = latitudeFromNorth(state.north);
+  data.aircraft_position.lon = longitudeFromEast(state.east);
+  data.aircraft_position.alt = -state.down;
+  data.Theta_deg = -outputs.pitchDeg;
+  data.Phi_deg = -outputs.rollDeg;
+  data.q_rad_s = -state.q;
+  data.r_rad_s = state.r;
+  data.p_rad_s = -state.p;
+  data.V_ias_kn = outputs.indicatedAirspeedKn;
+  data.V_tas_kn = outputs.trueAirspeedKn;
+  data.V_mach = outputs.mach;
+  data.V_gnd_kn = outputs.groundSpeedKn;
+  data.alpha_deg = outputs.alphaDeg;
+  data.beta_deg = outputs.betaDeg;
+  data.H_ft = outputs.altitudeFt;
+  data.H_ind_ft = outputs.altitudeFt;
+  data.H_radio_ft = outputs.radioHeightFt;
+  data.H_dot_ft_min = outputs.verticalSpeedFtMin;
+  data.Psi_magnetic_deg = outputs.headingDeg;
+  data.Psi_magnetic_track_deg = outputs.trackDeg;
+  data.Psi_true_deg = outputs.headingDeg;
+  data.bx_m_s2 = outputs.bodyAccelX;
+  data.by_m_s2 = outputs.bodyAccelY;
+  data.bz_m_s2 = outputs.bodyAccelZ;
+  data.nav_valid = true;
+  data.nav_loc_deg = 0;
+  data.nav_gs_deg = GLIDE_SLOPE_ANGLE_DEG;
+  data.nav_dme_valid = true;
+  data.nav_dme_nmi = dmeDistanceNm;
+  data.nav_loc_valid = true;
+  data.nav_loc_error_deg = localizerDeviationDeg;
+  data.nav_gs_valid = true;
+  data.nav_gs_error_deg = glideSlopeDeviationDeg;
+  data.nav_loc_magvar_deg = 0;
+  data.nav_loc_position.lat = latitudeFromNorth(LOCALIZER_NORTH_M);
+  data.nav_loc_position.lon = THRESHOLD_LON;
+  data.nav_loc_position.alt = 0;
+  data.nav_gs_position.lat = latitudeFromNorth(GLIDE_SLOPE_NORTH_M);
+  data.nav_gs_position.lon = THRESHOLD_LON;
+  data.nav_gs_position.alt = 0;
+  data.flight_phase = 5;
+  data.V2_kn = approachSpeedKn;
+  data.VAPP_kn = approachSpeedKn;
+  data.VLS_kn = facsDiscreteOutputs[0].fac_healthy ? facsBusOutputs[0].v_ls_kn.Data : facsBusOutputs[1].v_ls_kn.Data;
+  data.VMAX_kn = facsDiscreteOutputs[0].fac_healthy ? facsBusOutputs[0].v_max_kn.Data : facsBusOutputs[1].v_max_kn.Data;
+  data.thrust_reduction_altitude = 1500;
+  data.thrust_reduction_altitude_go_around = 1500;
+  data.acceleration_altitude = 1500;
+  data.acceleration_altitude_engine_out = 1500;
+  data.acceleration_altitude_go_around = 1500;
+  data.acceleration_altitude_go_around_engine_out = 1500;
+  data.cruise_altitude = 10000;
+  data.throttle_lever_1_pos = crewInputs.thrustLeverAngle;
+  data.throttle_lever_2_pos = crewInputs.thrustLeverAngle;
+  data.gear_strut_compression_1 = state.onGround ? 1.0 : 0.5;
+  data.gear_strut_compression_2 = state.onGround ? 1.0 : 0.5;
+  data.zeta_pos = 0;
+  data.flaps_handle_index = 5;
+  data.is_engine_operative_1 = true;
+  data.is_engine_operative_2 = true;
+  data.altimeter_setting_left_mbar = 1013;
+  data.altimeter_setting_right_mbar = 1013;
+  data.total_weight_kg = massKg;
+}
+
+void ClosedLoopSimulation::updateAutopilotStateMachine(double sampleTime) {
+  bool doDisconnect = false;
+  if (autopilotStateMachineOutput.enabled_AP1 || autopilotStateMachineOutput.enabled_AP2) {
+    doDisconnect = !(elacsDiscreteOutputs[0].ap_1_authorised || elacsDiscreteOutputs[1].ap_1_authorised);
+  }
+
+  autopilotStateMachineInput.in.time.dt = sampleTime;
+  autopilotStateMachineInput.in.time.simulation_time = simulationTime;
+
+  fillAutopilotData(autopilotStateMachineInput.in.data);
+
+  autopilotStateMachineInput.in.input.FD_active = true;
+  autopilotStateMachineInput.in.input.AP_1_push = crewInputs.AP_1_push;
+  autopilotStateMachineInput.in.input.AP_DISCONNECT_push = doDisconnect;
+  autopilotStateMachineInput.in.input.APPR_push = crewInputs.APPR_push;
+  autopilotStateMachineInput.in.input.V_fcu_kn = crewInputs.V_fcu_kn;
+  autopilotStateMachineInput.in.input.H_fcu_ft = crewInputs.H_fcu_ft;
+  autopilotStateMachineInput.in.input.Psi_fcu_deg = crewInputs.Psi_fcu_deg;
+  autopilotStateMachineInput.in.input.is_FLX_active = autoThrust.getExternalOutputs().out.data_computed.is_FLX_active;
+  autopilotStateMachineInput.in.input.ATHR_engaged = (autoThrustOutput.status == 2);
+  autopilotStateMachineInput.in.input.Phi_loc_c = autopilotLawsOutput.Phi_loc_c;
+  autopilotStateMachineInput.in.input.condition_Flare = autopilotLawsOutput.flare_law.condition_Flare;
+
+  autopilotStateMachine.setExternalInputs(&autopilotStateMachineInput);
+  autopilotStateMachine.step();
+
+  autopilotStateMachineOutput = autopilotStateMachine.getExternalOutputs().out.output;
+}
+
+void ClosedLoopSimulation::updateAutopilotLaws(double sampleTime) {
+  autopilotLawsInput.in.time.dt = sampleTime;
+  autopilotLawsInput.in.time.simulation_time = simulationTime;
+
+  fillAutopilotData(autopilotLawsInput.in.data);
+
+  autopilotLawsInput.in.input = autopilotStateMachineOutput;
+
+  autopilotLaws.setExternalInputs(&autopilotLawsInput);
+  autopilotLaws.step();
+
+  autopilotLawsOutput = autopilotLaws.getExternalOutputs().out.output;
+
+  fmgcBBusOutputs.fg_radio_height_ft = raBusOutputs[0].radio_height_ft;
+  fmgcBBusOutputs.delta_p_ail_cmd_deg = normalOperation(autopilotLawsOutput.autopilot.Phi_c_deg);
+  fmgcBBusOutputs.delta_p_splr_cmd_deg = normalOperation(0);
+  fmgcBBusOutputs.delta_r_cmd_deg = normalOperation(autopilotLawsOutput.autopilot.Beta_c_deg);
+  fmgcBBusOutputs.delta_q_cmd_deg = normalOperation(autopilotLawsOutput.autopilot.Theta_c_deg);
+  fmgcBBusOutputs.fm_weight_lbs = normalOperation(massKg * 2.20462262);
+  fmgcBBusOutputs.fm_cg_percent = normalOperation(28);
+  fmgcBBusOutputs.fac_weight_lbs = normalOperation(massKg * 2.20462262);
+  fmgcBBusOutputs.fac_cg_percent = normalOperation(28);
+}
+
+void ClosedLoopSimulation::updateAutothrust(double sampleTime) {
+  const PlantState& state = plant.getState();
+  const PlantOutputs& outputs = plant.getOutputs();
+
+  autoThrustInput.in.time.dt = sampleTime;
+  autoThrustInput.in.time.simulation_time = simulationTime;
+
+  autoThrustInput.in.data.nz_g = outputs.normalAccelG;
+  autoThrustInput.in.data.Theta_deg = -outputs.pitchDeg;
+  autoThrustInput.in.data.Phi_deg = -outputs.rollDeg;
+  autoThrustInput.in.data.V_ias_kn = outputs.indicatedAirspeedKn;
+  autoThrustInput.in.data.V_tas_kn = outputs.trueAirspeedKn;
+  autoThrustInput.in.data.V_mach = outputs.mach;
+  autoThrustInput.in.data.V_gnd_kn = outputs.groundSpeedKn;
+  autoThrustInput.in.data.alpha_deg = outputs.alphaDeg;
+  autoThrustInput.in.data.H_ft = outputs.altitudeFt;
+  autoThrustInput.in.data.H_ind_ft = outputs.altitudeFt;
+  autoThrustInput.in.data.H_radio_ft = outputs.radioHeightFt;
+  autoThrustInput.in.data.H_dot_fpm = outputs.verticalSpeedFtMin;
+  autoThrustInput.in.data.bx_m_s2 = outputs.bodyAccelX;
+  autoThrustInput.in.data.by_m_s2 = outputs.bodyAccelY;
+  autoThrustInput.in.data.bz_m_s2 = outputs.bodyAccelZ;
+  autoThrustInput.in.data.gear_strut_compression_1 = state.onGround ? 1.0 : 0.5;
+  autoThrustInput.in.data.gear_strut_compression_2 = state.onGround ? 1.0 : 0.5;
+  autoThrustInput.in.data.flap_handle_index = 5;
+  autoThrustInput.in.data.is_engine_operative_1 = true;
+  autoThrustInput.in.data.is_engine_operative_2 = true;
+  autoThrustInput.in.data.commanded_engine_N1_1_percent = autoThrustOutput.N1_c_1_percent;
+  autoThrustInput.in.data.commanded_engine_N1_2_percent = autoThrustOutput.N1_c_2_percent;
+  autoThrustInput.in.data.engine_N1_1_percent = state.n1[0];
+  autoThrustInput.in.data.engine_N1_2_percent = state.n1[1];
+  autoThrustInput.in.data.corrected_engine_N1_1_percent = state.n1[0];
+  autoThrustInput.in.data.corrected_engine_N1_2_percent = state.n1[1];
+  autoThrustInput.in.data.TAT_degC = outputs.temperatureDegC;
+  autoThrustInput.in.data.OAT_degC = outputs.temperatureDegC;
+
+  autoThrustInput.in.input.ATHR_push = crewInputs.ATHR_push;
+  autoThrustInput.in.input.ATHR_disconnect = false;
+  autoThrustInput.in.input.TLA_1_deg = crewInputs.thrustLeverAngle;
+  autoThrustInput.in.input.TLA_2_deg = crewInputs.thrustLeverAngle;
+  autoThrustInput.in.input.V_c_kn = crewInputs.V_fcu_kn;
+  autoThrustInput.in.input.V_LS_kn = facsDiscreteOutputs[0].fac_healthy ? facsBusOutputs[0].v_ls_kn.Data : facsBusOutputs[1].v_ls_kn.Data;
+  autoThrustInput.in.input.V_MAX_kn =
+      facsDiscreteOutputs[0].fac_healthy ? facsBusOutputs[0].v_max_kn.Data : facsBusOutputs[1].v_max_kn.Data;
+  autoThrustInput.in.input.thrust_limit_REV_percent = 70;
+  autoThrustInput.in.input.thrust_limit_IDLE_percent = 20;
+  autoThrustInput.in.input.thrust_limit_CLB_percent = 89;
+  autoThrustInput.in.input.thrust_limit_MCT_percent = 93;
+  autoThrustInput.in.input.thrust_limit_FLEX_percent = 93;
+  autoThrustInput.in.input.thrust_limit_TOGA_percent = 95;
+  autoThrustInput.in.input.flex_temperature_degC = 0;
+  autoThrustInput.in.input.mode_requested = autopilotStateMachineOutput.autothrust_mode;
+  autoThrustInput.in.input.is_mach_mode_active = false;
+  autoThrustInput.in.input.alpha_floor_condition =
+      reinterpret_cast<Arinc429DiscreteWord*>(&facsBusOutputs[0].discrete_word_5)->bitFromValueOr(29, false) ||
+      reinterpret_cast<Arinc429DiscreteWord*>(&facsBusOutputs[1].discrete_word_5)->bitFromValueOr(29, false);
+  autoThrustInput.in.input.is_approach_mode_active =
+      (autopilotStateMachineOutput.vertical_mode >= 30 && autopilotStateMachineOutput.vertical_mode <= 34) ||
+      autopilotStateMachineOutput.vertical_mode == 24;
+  autoThrustInput.in.input.is_SRS_TO_mode_active = autopilotStateMachineOutput.vertical_mode == 40;
+  autoThrustInput.in.input.is_SRS_GA_mode_active = autopilotStateMachineOutput.vertical_mode == 41;
+  autoThrustInput.in.input.is_LAND_mode_active = autopilotStateMachineOutput.vertical_mode == 32;
+  autoThrustInput.in.input.thrust_reduction_altitude = 1500;
+  autoThrustInput.in.input.thrust_reduction_altitude_go_around = 1500;
+  autoThrustInput.in.input.flight_phase = 5;
+  autoThrustInput.in.input.is_alt_soft_mode_active = autopilotStateMachineOutput.ALT_soft_mode_active;
+  autoThrustInput.in.input.FD_active = true;
+  autoThrustInput.in.input.target_TCAS_RA_rate_fpm = autopilotStateMachineOutput.H_dot_c_fpm;
+
+  autoThrust.setExternalInputs(&autoThrustInput);
+  autoThrust.step();
+
+  autoThrustOutput = autoThrust.getExternalOutputs().out.output;
+}
+
+void ClosedLoopSimulation::updateElac(double sampleTime, int elacIndex) {
+  const int oppElacIndex = elacIndex == 0 ? 1 : 0;
+  const PlantState& state = plant.getState();
+
+  elacs[elacIndex].modelInputs.in.time.dt = sampleTime;
+  elacs[elacIndex].modelInputs.in.time.simulation_time = simulationTime;
+  elacs[elacIndex].modelInputs.in.time.monotonic_time = simulationTime;
+
+  elacs[elacIndex].modelInputs.in.sim_data.tailstrike_protection_on = false;
+
+  elacs[elacIndex].modelInputs.in.discrete_inputs.ground_spoilers_active_1 = secsDiscreteOutputs[0].ground_spoiler_out;
+  elacs[elacIndex].modelInputs.in.discrete_inputs.ground_spoilers_active_2 =
+      elacIndex == 0 ? secsDiscreteOutputs[1].ground_spoiler_out : secsDiscreteOutputs[2].ground_spoiler_out;
+  elacs[elacIndex].modelInputs.in.discrete_inputs.is_unit_1 = elacIndex == 0;
+  elacs[elacIndex].modelInputs.in.discrete_inputs.is_unit_2 = elacIndex == 1;
+  elacs[elacIndex].modelInputs.in.discrete_inputs.opp_axis_pitch_failure = !elacsDiscreteOutputs[oppElacIndex].pitch_axis_ok;
+  elacs[elacIndex].modelInputs.in.discrete_inputs.ap_1_disengaged = !autopilotStateMachineOutput.enabled_AP1;
+  elacs[elacIndex].modelInputs.in.discrete_inputs.ap_2_disengaged = !autopilotStateMachineOutput.enabled_AP2;
+  elacs[elacIndex].modelInputs.in.discrete_inputs.opp_left_aileron_lost = !elacsDiscreteOutputs[oppElacIndex].left_aileron_ok;
+  elacs[elacIndex].modelInputs.in.discrete_inputs.opp_right_aileron_lost = !elacsDiscreteOutputs[oppElacIndex].right_aileron_ok;
+  elacs[elacIndex].modelInputs.in.discrete_inputs.fac_1_yaw_control_lost = !facsDiscreteOutputs[0].yaw_damper_avail_for_norm_law;
+  elacs[elacIndex].modelInputs.in.discrete_inputs.lgciu_1_nose_gear_pressed = state.onGround;
+  elacs[elacIndex].modelInputs.in.discrete_inputs.lgciu_2_nose_gear_pressed = state.onGround;
+  elacs[elacIndex].modelInputs.in.discrete_inputs.fac_2_yaw_control_lost = !facsDiscreteOutputs[1].yaw_damper_avail_for_norm_law;
+  elacs[elacIndex].modelInputs.in.discrete_inputs.lgciu_1_right_main_gear_pressed = state.onGround;
+  elacs[elacIndex].modelInputs.in.discrete_inputs.lgciu_2_right_main_gear_pressed = state.onGround;
+  elacs[elacIndex].modelInputs.in.discrete_inputs.lgciu_1_left_main_gear_pressed = state.onGround;
+  elacs[elacIndex].modelInputs.in.discrete_inputs.lgciu_2_left_main_gear_pressed = state.onGround;
+  elacs[elacIndex].modelInputs.in.discrete_inputs.elac_engaged_from_switch = true;
+
+  elacs[elacIndex].modelInputs.in.analog_inputs.left_elevator_pos_deg = state.leftElevatorDeg;
+  elacs[elacIndex].modelInputs.in.analog_inputs.right_elevator_pos_deg = state.rightElevatorDeg;
+  elacs[elacIndex].modelInputs.in.analog_inputs.ths_pos_deg = state.thsDeg;
+  elacs[elacIndex].modelInputs.in.analog_inputs.left_aileron_pos_deg = state.leftAileronDeg;
+  elacs[elacIndex].modelInputs.in.analog_inputs.right_aileron_pos_deg = state.rightAileronDeg;
+  elacs[elacIndex].modelInputs.in.analog_inputs.blue_hyd_pressure_psi = HYD_PRESSURE_PSI;
+  elacs[elacIndex].modelInputs.in.analog_inputs.green_hyd_pressure_psi = HYD_PRESSURE_PSI;
+  elacs[elacIndex].modelInputs.in.analog_inputs.yellow_hyd_pressure_psi = HYD_PRESSURE_PSI;
+
+  elacs[elacIndex].modelInputs.in.bus_inputs.adr_1_bus = adrBusOutputs[0];
+  elacs[elacIndex].modelInputs.in.bus_inputs.adr_2_bus = adrBusOutputs[1];
+  elacs[elacIndex].modelInputs.in.bus_inputs.adr_3_bus = adrBusOutputs[2];
+  elacs[elacIndex].modelInputs.in.bus_inputs.ir_1_bus = irBusOutputs[0];
+  elacs[elacIndex].modelInputs.in.bus_inputs.ir_2_bus = irBusOutputs[1];
+  elacs[elacIndex].modelInputs.in.bus_inputs.ir_3_bus = irBusOutputs[2];
+  elacs[elacIndex].modelInputs.in.bus_inputs.fmgc_1_bus = fmgcBBusOutputs;
+  elacs[elacIndex].modelInputs.in.bus_inputs.fmgc_2_bus = fmgcBBusOutputs;
+  elacs[elacIndex].modelInputs.in.bus_inputs.ra_1_bus = raBusOutputs[0];
+  elacs[elacIndex].modelInputs.in.bus_inputs.ra_2_bus = raBusOutputs[1];
+  elacs[elacIndex].modelInputs.in.bus_inputs.sfcc_1_bus = sfccBusOutputs[0];
+  elacs[elacIndex].modelInputs.in.bus_inputs.sfcc_2_bus = sfccBusOutputs[1];
+  elacs[elacIndex].modelInputs.in.bus_inputs.fcdc_1_bus = fcdcsBusOutputs[0];
+  elacs[elacIndex].modelInputs.in.bus_inputs.fcdc_2_bus = fcdcsBusOutputs[1];
+  elacs[elacIndex].modelInputs.in.bus_inputs.sec_1_bus = secsBusOutputs[0];
+  elacs[elacIndex].modelInputs.in.bus_inputs.sec_2_bus = secsBusOutputs[1];
+  elacs[elacIndex].modelInputs.in.bus_inputs.elac_opp_bus = elacsBusOutputs[oppElacIndex];
+
+  elacs[elacIndex].update(sampleTime, simulationTime, false, true);
+
+  elacsDiscreteOutputs[elacIndex] = elacs[elacIndex].getDiscreteOutputs();
+  elacsAnalogOutputs[elacIndex] = elacs[elacIndex].getAnalogOutputs();
+  elacsBusOutputs[elacIndex] = elacs[elacIndex].getBusOutputs();
+}
+
+void ClosedLoopSimulation::updateSec(double sampleTime, int secIndex) {
+  const int oppSecIndex = secIndex == 0 ? 1 : 0;
+  const PlantState& state = plant.getState();
+
+  secs[secIndex].modelInputs.in.time.dt = sampleTime;
+  secs[secIndex].modelInputs.in.time.simulation_time = simulationTime;
+  secs[secIndex].modelInputs.in.time.monotonic_time = simulationTime;
+
+  secs[secIndex].modelInputs.in.discrete_inputs.sec_engaged_from_switch = true;
+  secs[secIndex].modelInputs.in.discrete_inputs.is_unit_1 = secIndex == 0;
+  secs[secIndex].modelInputs.in.discrete_inputs.is_unit_2 = secIndex == 1;
+  secs[secIndex].modelInputs.in.discrete_inputs.is_unit_3 = secIndex == 2;
+  if (secIndex < 2) {
+    secs[secIndex].modelInputs.in.discrete_inputs.pitch_not_avail_elac_1 = !elacsDiscreteOutputs[0].pitch_axis_ok;
+    secs[secIndex].modelInputs.in.discrete_inputs.pitch_not_avail_elac_2 = !elacsDiscreteOutputs[1].pitch_axis_ok;
+    secs[secIndex].modelInputs.in.discrete_inputs.left_elev_not_avail_sec_opp = !secsDiscreteOutputs[oppSecIndex].left_elevator_ok;
+    secs[secIndex].modelInputs.in.discrete_inputs.right_elev_not_avail_sec_opp = !secsDiscreteOutputs[oppSecIndex].right_elevator_ok;
+
+    secs[secIndex].modelInputs.in.analog_inputs.left_elevator_pos_deg = state.leftElevatorDeg;
+    secs[secIndex].modelInputs.in.analog_inputs.right_elevator_pos_deg = state.rightElevatorDeg;
+    secs[secIndex].modelInputs.in.analog_inputs.ths_pos_deg = state.thsDeg;
+  }
+
+  secs[secIndex].modelInputs.in.discrete_inputs.digital_output_failed_elac_1 = !elacsDiscreteOutputs[0].digital_output_validated;
+  secs[secIndex].modelInputs.in.discrete_inputs.digital_output_failed_elac_2 = !elacsDiscreteOutputs[1].digital_output_validated;
+
+  secs[secIndex].modelInputs.in.analog_inputs.spd_brk_lever_pos = -0.05;
+  secs[secIndex].modelInputs.in.analog_inputs.thr_lever_1_pos = crewInputs.thrustLeverAngle;
+  secs[secIndex].modelInputs.in.analog_inputs.thr_lever_2_pos = crewInputs.thrustLeverAngle;
+  secs[secIndex].modelInputs.in.analog_inputs.wheel_speed_left = state.onGround ? plant.getOutputs().groundSpeedKn : 0;
+  secs[secIndex].modelInputs.in.analog_inputs.wheel_speed_right = state.onGround ? plant.getOutputs().groundSpeedKn : 0;
+
+  if (secIndex == 0) {
+    secs[secIndex].modelInputs.in.bus_inputs.adr_1_bus = adrBusOutputs[0];
+    secs[secIndex].modelInputs.in.bus_inputs.adr_2_bus = adrBusOutputs[2];
+    secs[secIndex].modelInputs.in.bus_inputs.ir_1_bus = irBusOutputs[0];
+    secs[secIndex].modelInputs.in.bus_inputs.ir_2_bus = irBusOutputs[2];
+  } else if (secIndex == 1) {
+    secs[secIndex].modelInputs.in.bus_inputs.adr_1_bus = adrBusOutputs[0];
+    secs[secIndex].modelInputs.in.bus_inputs.adr_2_bus = adrBusOutputs[1];
+    secs[secIndex].modelInputs.in.bus_inputs.ir_1_bus = irBusOutputs[0];
+    secs[secIndex].modelInputs.in.bus_inputs.ir_2_bus = irBusOutputs[1];
+  } else if (secIndex == 2) {
+    secs[secIndex].modelInputs.in.bus_inputs.adr_1_bus = adrBusOutputs[1];
+    secs[secIndex].modelInputs.in.bus_inputs.adr_2_bus = adrBusOutputs[2];
+    secs[secIndex].modelInputs.in.bus_inputs.ir_1_bus = irBusOutputs[1];
+    secs[secIndex].modelInputs.in.bus_inputs.ir_2_bus = irBusOutputs[2];
+  }
+
+  secs[secIndex].modelInputs.in.bus_inputs.fcdc_1_bus = fcdcsBusOutputs[0];
+  secs[secIndex].modelInputs.in.bus_inputs.fcdc_2_bus = fcdcsBusOutputs[1];
+  secs[secIndex].modelInputs.in.bus_inputs.elac_1_bus = elacsBusOutputs[0];
+  secs[secIndex].modelInputs.in.bus_inputs.elac_2_bus = elacsBusOutputs[1];
+  secs[secIndex].modelInputs.in.bus_inputs.sfcc_1_bus = sfccBusOutputs[0];
+  secs[secIndex].modelInputs.in.bus_inputs.sfcc_2_bus = sfccBusOutputs[1];
+  secs[secIndex].modelInputs.in.bus_inputs.lgciu_1_bus = lgciuBusOutputs[0];
+  secs[secIndex].modelInputs.in.bus_inputs.lgciu_2_bus = lgciuBusOutputs[1];
+
+  secs[secIndex].update(sampleTime, simulationTime, false, true);
+
+  secsDiscreteOutputs[secIndex] = secs[secIndex].getDiscreteOutputs();
+  secsAnalogOutputs[secIndex] = secs[secIndex].getAnalogOutputs();
+  secsBusOutputs[secIndex] = secs[secIndex].getBusOutputs();
+}
+
+void ClosedLoopSimulation::updateFcdc(double sampleTime, int fcdcIndex) {
+  const int oppFcdcIndex = fcdcIndex == 0 ? 1 : 0;
+
+  fcdcs[fcdcIndex].discreteInputs.elac1Off = false;
+  fcdcs[fcdcIndex].discreteInputs.elac1Valid = elacsDiscreteOutputs[0].digital_output_validated;
+  fcdcs[fcdcIndex].discreteInputs.elac2Valid = elacsDiscreteOutputs[1].digital_output_validated;
+  fcdcs[fcdcIndex].discreteInputs.sec1Off = false;
+  fcdcs[fcdcIndex].discreteInputs.sec1Valid = !secsDiscreteOutputs[0].sec_failed;
+  fcdcs[fcdcIndex].discreteInputs.sec2Valid = !secsDiscreteOutputs[1].sec_failed;
+  fcdcs[fcdcIndex].discreteInputs.eng1NotOnGroundAndNotLowOilPress = false;
+  fcdcs[fcdcIndex].discreteInputs.eng2NotOnGroundAndNotLowOilPress = false;
+  fcdcs[fcdcIndex].discreteInputs.noseGearPressed = plant.getState().onGround;
+  fcdcs[fcdcIndex].discreteInputs.oppFcdcFailed = !fcdcsDiscreteOutputs[oppFcdcIndex].fcdcValid;
+  fcdcs[fcdcIndex].discreteInputs.sec3Off = false;
+  fcdcs[fcdcIndex].discreteInputs.sec3Valid = !secsDiscreteOutputs[2].sec_failed;
+  fcdcs[fcdcIndex].discreteInputs.elac2Off = false;
+  fcdcs[fcdcIndex].discreteInputs.sec2Off = false;
+
+  fcdcs[fcdcIndex].busInputs.elac1 = elacsBusOutputs[0];
+  fcdcs[fcdcIndex].busInputs.sec1 = secsBusOutputs[0];
+  fcdcs[fcdcIndex].busInputs.fcdcOpp = fcdcsBusOutputs[oppFcdcIndex];
+  fcdcs[fcdcIndex].busInputs.elac2 = elacsBusOutputs[1];
+  fcdcs[fcdcIndex].busInputs.sec2 = secsBusOutputs[1];
+  fcdcs[fcdcIndex].busInputs.sec3 = secsBusOutputs[2];
+
+  fcdcs[fcdcIndex].update(sampleTime, false, true);
+
+  fcdcsDiscreteOutputs[fcdcIndex] = fcdcs[fcdcIndex].getDiscreteOutputs();
+  FcdcBus bus = fcdcs[fcdcIndex].getBusOutputs();
+  fcdcsBusOutputs[fcdcIndex] = *reinterpret_cast<base_fcdc_bus*>(&bus);
+}
+
+void ClosedLoopSimulation::updateFac(double sampleTime, int facIndex) {
+  const int oppFacIndex = facIndex == 0 ? 1 : 0;
+
+  facs[facIndex].modelInputs.in.time.dt = sampleTime;
+  facs[facIndex].modelInputs.in.time.simulation_time = simulationTime;
+  facs[facIndex].modelInputs.in.time.monotonic_time = simulationTime;
+
+  facs[facIndex].modelInputs.in.discrete_inputs.ap_own_engaged =
+      facIndex == 0 ? autopilotStateMachineOutput.enabled_AP1 : autopilotStateMachineOutput.enabled_AP2;
+  facs[facIndex].modelInputs.in.discrete_inputs.ap_opp_engaged =
+      facIndex == 0 ? autopilotStateMachineOutput.enabled_AP2 : autopilotStateMachineOutput.enabled_AP1;
+  facs[facIndex].modelInputs.in.discrete_inputs.yaw_damper_opp_engaged = facsDiscreteOutputs[oppFacIndex].yaw_damper_engaged;
+  facs[facIndex].modelInputs.in.discrete_inputs.rudder_trim_opp_engaged = facsDiscreteOutputs[oppFacIndex].rudder_trim_engaged;
+  facs[facIndex].modelInputs.in.discrete_inputs.rudder_travel_lim_opp_engaged = facsDiscreteOutputs[oppFacIndex].rudder_travel_lim_engaged;
+  facs[facIndex].modelInputs.in.discrete_inputs.elac_1_healthy = elacsDiscreteOutputs[0].digital_output_validated;
+  facs[facIndex].modelInputs.in.discrete_inputs.elac_2_healthy = elacsDiscreteOutputs[1].digital_output_validated;
+  facs[facIndex].modelInputs.in.discrete_inputs.engine_1_stopped = false;
+  facs[facIndex].modelInputs.in.discrete_inputs.engine_2_stopped = false;
+  facs[facIndex].modelInputs.in.discrete_inputs.fac_engaged_from_switch = true;
+  facs[facIndex].modelInputs.in.discrete_inputs.fac_opp_healthy = facsDiscreteOutputs[oppFacIndex].fac_healthy;
+  facs[facIndex].modelInputs.in.discrete_inputs.is_unit_1 = facIndex == 0;
+  facs[facIndex].modelInputs.in.discrete_inputs.rudder_trim_actuator_healthy = true;
+  facs[facIndex].modelInputs.in.discrete_inputs.rudder_travel_lim_actuator_healthy = true;
+  facs[facIndex].modelInputs.in.discrete_inputs.slats_extended = true;
+  facs[facIndex].modelInputs.in.discrete_inputs.nose_gear_pressed = plant.getState().onGround;
+  facs[facIndex].modelInputs.in.discrete_inputs.yaw_damper_has_hyd_press = true;
+
+  facs[facIndex].modelInputs.in.bus_inputs.fac_opp_bus = facsBusOutputs[oppFacIndex];
+  facs[facIndex].modelInputs.in.bus_inputs.adr_own_bus = facIndex == 0 ? adrBusOutputs[0] : adrBusOutputs[1];
+  facs[facIndex].modelInputs.in.bus_inputs.adr_opp_bus = facIndex == 0 ? adrBusOutputs[1] : adrBusOutputs[0];
+  facs[facIndex].modelInputs.in.bus_inputs.adr_3_bus = adrBusOutputs[2];
+  facs[facIndex].modelInputs.in.bus_inputs.ir_own_bus = facIndex == 0 ? irBusOutputs[0] : irBusOutputs[1];
+  facs[facIndex].modelInputs.in.bus_inputs.ir_opp_bus = facIndex == 0 ? irBusOutputs[1] : irBusOutputs[0];
+  facs[facIndex].modelInputs.in.bus_inputs.ir_3_bus = irBusOutputs[2];
+  facs[facIndex].modelInputs.in.bus_inputs.fmgc_own_bus = fmgcBBusOutputs;
+  facs[facIndex].modelInputs.in.bus_inputs.fmgc_opp_bus = fmgcBBusOutputs;
+  facs[facIndex].modelInputs.in.bus_inputs.sfcc_own_bus = sfccBusOutputs[facIndex];
+  facs[facIndex].modelInputs.in.bus_inputs.lgciu_own_bus = lgciuBusOutputs[facIndex];
+  facs[facIndex].modelInputs.in.bus_inputs.elac_1_bus = elacsBusOutputs[0];
+  facs[facIndex].modelInputs.in.bus_inputs.elac_2_bus = elacsBusOutputs[1];
+
+  facs[facIndex].update(sampleTime, simulationTime, false, true);
+
+  facsDiscreteOutputs[facIndex] = facs[facIndex].getDiscreteOutputs();
+  facsAnalogOutputs[facIndex] = facs[facIndex].getAnalogOutputs();
+  facsBusOutputs[facIndex] = facs[facIndex].getBusOutputs();
+}
+
+void ClosedLoopSimulation::updatePlant(double sampleTime) {
+  PlantCommands commands;
+
+  // each elevator has two servos, the first one is put into damping mode by the computers driving the second one
+  bool leftElevatorServo1Active = elacsDiscreteOutputs[1].left_elevator_damping_mode || secsDiscreteOutputs[1].left_elevator_damping_mode;
+  bool rightElevatorServo1Active =
+      elacsDiscreteOutputs[1].right_elevator_damping_mode || secsDiscreteOutputs[1].right_elevator_damping_mode;
+  commands.leftElevatorDeg = leftElevatorServo1Active
+                                 ? elacsAnalogOutputs[1].left_elev_pos_order_deg + secsAnalogOutputs[1].left_elev_pos_order_deg
+                                 : elacsAnalogOutputs[0].left_elev_pos_order_deg + secsAnalogOutputs[0].left_elev_pos_order_deg;
+  commands.rightElevatorDeg = rightElevatorServo1Active
+                                  ? elacsAnalogOutputs[1].right_elev_pos_order_deg + secsAnalogOutputs[1].right_elev_pos_order_deg
+                                  : elacsAnalogOutputs[0].right_elev_pos_order_deg + secsAnalogOutputs[0].right_elev_pos_order_deg;
+
+  if (elacsDiscreteOutputs[1].ths_active) {
+    commands.thsDeg = elacsAnalogOutputs[1].ths_pos_order;
+  } else if (elacsDiscreteOutputs[0].ths_active || secsDiscreteOutputs[0].ths_active) {
+    commands.thsDeg = elacsAnalogOutputs[0].ths_pos_order + secsAnalogOutputs[0].ths_pos_order_deg;
+  } else if (secsDiscreteOutputs[1].ths_active) {
+    commands.thsDeg = secsAnalogOutputs[1].ths_pos_order_deg;
+  } else {
+    commands.thsDeg = plant.getState().thsDeg;
+  }
+
+  commands.leftAileronDeg = elacsDiscreteOutputs[0].left_aileron_active_mode ? elacsAnalogOutputs[0].left_aileron_pos_order
+                                                                              : elacsAnalogOutputs[1].left_aileron_pos_order;
+  commands.rightAileronDeg = elacsDiscreteOutputs[0].right_aileron_active_mode ? elacsAnalogOutputs[0].right_aileron_pos_order
+                                                                                : elacsAnalogOutputs[1].right_aileron_pos_order;
+
+  int activeFacIndex = facsDiscreteOutputs[0].yaw_damper_engaged ? 0 : 1;
+  commands.rudderDeg = facsAnalogOutputs[activeFacIndex].yaw_damper_order_deg;
+
+  commands.n1Percent[0] = autoThrustOutput.N1_c_1_percent;
+  commands.n1Percent[1] = autoThrustOutput.N1_c_2_percent;
+
+  plant.update(sampleTime, commands);
+}
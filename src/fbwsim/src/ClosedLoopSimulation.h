@@ -0,0 +1,140 @@
+#pragma once
+
+#include "AutopilotLaws.h"
+#include "AutopilotStateMachine.h"
+#include "Autothrust.h"
+#include "Plant.h"
+#include "Scenario.h"
+#include "SnapshotArena.h"
+#include "elac/Elac.h"
+#include "fac/Fac.h"
+#include "fcdc/Fcdc.h"
+#include "sec/Sec.h"
+
+// Crew and FCU inputs, kept in memory instead of being read from local variables and SimConnect events.
+struct CrewInputs {
+  bool AP_1_push = false;
+  bool ATHR_push = false;
+  bool APPR_push = false;
+  double thrustLeverAngle = 25;
+  double V_fcu_kn = 140;
+  double H_fcu_ft = 3000;
+  double Psi_fcu_deg = 0;
+};
+
+// An output signal that is compared when replaying a recorded flight, with the deviation that is still accepted.
+struct RecordedSignal {
+  const char* name;
+  double tolerance;
+};
+
+// Runs the A320 flight control stack (AP state machine, AP laws, autothrust, ELAC, SEC, FAC and FCDC) against the
+// stand-in plant. It takes the place of FlyByWireInterface: all data that would come from SimConnect or local
+// variables is produced from the plant state, and all outputs are fed back into the plant actuators.
+class ClosedLoopSimulation {
+ public:
+  void initialize(const Scenario& scenario);
+
+  void update(double sampleTime);
+
+  // Runs the computers against a recorded plant state and output instead of the simulated plant.
+  void replay(double sampleTime, const PlantState& state, const PlantOutputs& outputs);
+
+  static constexpr int RECORDED_SIGNAL_COUNT = 14;
+  static const RecordedSignal recordedSignals[RECORDED_SIGNAL_COUNT];
+
+  void getRecordedSignals(double (&signals)[RECORDED_SIGNAL_COUNT]) const;
+
+  // Saves the plant, crew inputs, models and computers into the arena, like FlyByWireInterface::saveState.
+  bool saveState(SnapshotArena& arena) const;
+
+  // Restores the state saved by saveState. Stops at the first object that cannot be restored.
+  bool restoreState(SnapshotArena& arena);
+
+  const Plant& getPlant() const { return plant; }
+
+  CrewInputs crewInputs;
+
+  double getSimulationTime() const { return simulationTime; }
+
+  double getLocalizerDeviationDeg() const { return localizerDeviationDeg; }
+
+  double getGlideSlopeDeviationDeg() const { return glideSlopeDeviationDeg; }
+
+  const ap_raw_laws_input& getAutopilotStateMachineOutput() const { return autopilotStateMachineOutput; }
+
+  const athr_output& getAutothrustOutput() const { return autoThrustOutput; }
+
+ private:
+  void updateComputers(double sampleTime);
+
+  void updateNavigation();
+
+  void updateSensors();
+
+  void fillAutopilotData(ap_raw_data& data) const;
+
+  void updateAutopilotStateMachine(double sampleTime);
+
+  void updateAutopilotLaws(double sampleTime);
+
+  void updateAutothrust(double sampleTime);
+
+  void updateElac(double sampleTime, int elacIndex);
+
+  void updateSec(double sampleTime, int secIndex);
+
+  void updateFcdc(double sampleTime, int fcdcIndex);
+
+  void updateFac(double sampleTime, int facIndex);
+
+  void updatePlant(double sampleTime);
+
+  Plant plant;
+
+  double massKg = 0;
+  double approachSpeedKn = 0;
+  double simulationTime = 0;
+
+  double localizerDeviationDeg = 0;
+  double glideSlopeDeviationDeg = 0;
+  double dmeDistanceNm = 0;
+
+  AutopilotStateMachineModelClass autopilotStateMachine;
+  AutopilotStateMachineModelClass::ExternalInputs_AutopilotStateMachine_T autopilotStateMachineInput = {};
+  ap_raw_laws_input autopilotStateMachineOutput = {};
+
+  AutopilotLawsModelClass autopilotLaws;
+  AutopilotLawsModelClass::ExternalInputs_AutopilotLaws_T autopilotLawsInput = {};
+  ap_raw_output autopilotLawsOutput = {};
+
+  AutothrustModelClass autoThrust;
+  AutothrustModelClass::ExternalInputs_Autothrust_T autoThrustInput = {};
+  athr_output autoThrustOutput = {};
+
+  base_ra_bus raBusOutputs[2] = {};
+  base_lgciu_bus lgciuBusOutputs[2] = {};
+  base_sfcc_bus sfccBusOutputs[2] = {};
+  base_fmgc_b_bus fmgcBBusOutputs = {};
+  base_adr_bus adrBusOutputs[3] = {};
+  base_ir_bus irBusOutputs[3] = {};
+
+  Elac elacs[2] = {Elac(true), Elac(false)};
+  base_elac_discrete_outputs elacsDiscreteOutputs[2] = {};
+  base_elac_analog_outputs elacsAnalogOutputs[2] = {};
+  base_elac_out_bus elacsBusOutputs[2] = {};
+
+  Sec secs[3] = {Sec(true, false), Sec(false, false), Sec(false, true)};
+  base_sec_discrete_outputs secsDiscreteOutputs[3] = {};
+  base_sec_analog_outputs secsAnalogOutputs[3] = {};
+  base_sec_out_bus secsBusOutputs[3] = {};
+
+  Fcdc fcdcs[2] = {Fcdc(true), Fcdc(false)};
+  FcdcDiscreteOutputs fcdcsDiscreteOutputs[2] = {};
+  base_fcdc_bus fcdcsBusOutputs[2] = {};
+
+  Fac facs[2] = {Fac(true), Fac(false)};
+  base_fac_discrete_outputs facsDiscreteOutputs[2] = {};
+  base_fac_analog_outputs facsAnalogOutputs[2] = {};
+  base_fac_bus facsBusOutputs[2] = {};
+};
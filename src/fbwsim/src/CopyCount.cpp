@@ -0,0 +1,115 @@
+#include "CopyCount.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "FlyByWireInterface.h"
+#include "SimConnectData.h"
+#include "SimulatorStub.h"
+#include "fmt/include/fmt/core.h"
+
+namespace {
+
+// frames flown before counting, so that the one-time work of the first frames is not counted
+constexpr int WARMUP_FRAMES = 30;
+
+struct CopyCounter {
+  bool enabled = false;
+  size_t calls = 0;
+  size_t bytes = 0;
+  size_t simDataCopies = 0;
+};
+
+CopyCounter copyCounter;
+
+// the power supplies, hydraulics and pushbuttons the computers need to run
+const char* const POWER_UP_VARIABLES[] = {
+    "A32NX_ELEC_DC_2_BUS_IS_POWERED",
+    "A32NX_ELEC_DC_ESS_SHED_BUS_IS_POWERED",
+    "A32NX_ELEC_DC_ESS_BUS_IS_POWERED",
+    "A32NX_ELEC_DC_HOT_1_BUS_IS_POWERED",
+    "A32NX_HYD_YELLOW_SYSTEM_1_SECTION_PRESSURE_SWITCH",
+    "A32NX_HYD_GREEN_SYSTEM_1_SECTION_PRESSURE_SWITCH",
+    "A32NX_HYD_BLUE_SYSTEM_1_SECTION_PRESSURE_SWITCH",
+    "A32NX_ELAC_1_PUSHBUTTON_PRESSED",
+    "A32NX_ELAC_2_PUSHBUTTON_PRESSED",
+    "A32NX_SEC_1_PUSHBUTTON_PRESSED",
+    "A32NX_SEC_2_PUSHBUTTON_PRESSED",
+    "A32NX_SEC_3_PUSHBUTTON_PRESSED",
+    "A32NX_FAC_1_PUSHBUTTON_PRESSED",
+    "A32NX_FAC_2_PUSHBUTTON_PRESSED",
+};
+
+}  // namespace
+
+#ifdef FBWSIM_COUNT_COPIES
+constexpr bool IS_COUNTING_COPIES = true;
+
+// the program is linked with --wrap=memcpy, so that all calls to memcpy come here
+extern "C" void* __real_memcpy(void* destination, const void* source, size_t size);
+
+extern "C" void* __wrap_memcpy(void* destination, const void* source, size_t size) {
+  if (copyCounter.enabled) {
+    copyCounter.calls++;
+    copyCounter.bytes += size;
+    copyCounter.simDataCopies += size == sizeof(SimData) ? 1 : 0;
+  }
+  return __real_memcpy(destination, source, size);
+}
+#else
+constexpr bool IS_COUNTING_COPIES = false;
+#endif
+
+bool runCopyCount(int frames, double sampleTime) {
+  if (!IS_COUNTING_COPIES) {
+    fmt::print("Counting copies needs fbwsim to be built with GCC!\n");
+    return false;
+  }
+
+  for (const char* name : POWER_UP_VARIABLES) {
+    SimulatorStub::setNamedVariable(name, 1);
+  }
+
+  // the interface is large and expects to be zero initialized like a global, so allocate it on the heap
+  auto flyByWireInterface = std::make_unique<FlyByWireInterface>();
+  if (!flyByWireInterface->connect()) {
+    fmt::print("Failed to connect the fly-by-wire interface!\n");
+    return false;
+  }
+
+  // level flight, the sim time must advance or the interface detects a pause
+  SimData simData = {};
+  simData.nz_g = 1;
+  simData.simulationTime = 1;
+  simData.simulation_rate = 1;
+
+  bool result = true;
+  size_t clientDataWriteCountStart = 0;
+  for (int i = -WARMUP_FRAMES; i < frames; i++) {
+    simData.simulationTime += sampleTime;
+    SimulatorStub::setSimObjectData(0, &simData, sizeof(simData));
+
+    if (i == 0) {
+      clientDataWriteCountStart = SimulatorStub::getClientDataWriteCount();
+    }
+    copyCounter.enabled = i >= 0;
+    result &= flyByWireInterface->update(sampleTime);
+    copyCounter.enabled = false;
+  }
+
+  size_t clientDataWrites = SimulatorStub::getClientDataWriteCount() - clientDataWriteCountStart;
+  flyByWireInterface->disconnect();
+
+  fmt::print("frames:            {}\n", frames);
+  fmt::print("memcpy calls:      {:.1f} per frame\n", static_cast<double>(copyCounter.calls) / frames);
+  fmt::print("memcpy bytes:      {:.0f} per frame\n", static_cast<double>(copyCounter.bytes) / frames);
+  fmt::print("SimData copies:    {:.1f} per frame ({} bytes each)\n", static_cast<double>(copyCounter.simDataCopies) / frames,
+             sizeof(SimData));
+  fmt::print("client data writes: {:.1f} per frame\n", static_cast<double>(clientDataWrites) / frames);
+
+  if (!result) {
+    fmt::print("The fly-by-wire interface failed to update!\n");
+  }
+  return result;
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+// Runs the A320 fly-by-wire interface against the simulator stub for the given frames and reports the calls to memcpy
+// and the bytes they copied per frame, and the SimConnect client data writes per frame. Copies the compiler inlines are
+// not counted. Counting needs a GCC build, see CMakeLists.txt. The interface uses the paths of the sim unchanged, so it
+// reads its configuration from and writes its flight data recorder files to the current directory, with names starting
+// with \work\. Returns true if the interface connected and updated all frames.
+bool runCopyCount(int frames, double sampleTime);
@@ -0,0 +1,91 @@
+#include "FlightRecording.h"
+
+#include <cmath>
+#include <fstream>
+#include <memory>
+
+#include "Scenario.h"
+#include "fmt/include/fmt/core.h"
+
+namespace {
+constexpr uint32_t RECORDING_VERSION = 1;
+
+struct RecordingHeader {
+  uint32_t version;
+  uint32_t frameSize;
+  int32_t scenarioIndex;
+  double sampleTime;
+  uint64_t frameCount;
+};
+}  // namespace
+
+bool writeFlightRecording(const std::string& path, const FlightRecording& recording) {
+  std::ofstream out(path, std::ios::out | std::ios::binary);
+  if (!out) {
+    return false;
+  }
+
+  RecordingHeader header = {RECORDING_VERSION, sizeof(RecordedFrame), recording.scenarioIndex, recording.sampleTime,
+                            recording.frames.size()};
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  out.write(reinterpret_cast<const char*>(recording.frames.data()), recording.frames.size() * sizeof(RecordedFrame));
+
+  return out.good();
+}
+
+bool readFlightRecording(const std::string& path, FlightRecording& recording) {
+  std::ifstream in(path, std::ios::in | std::ios::binary);
+  if (!in) {
+    return false;
+  }
+
+  RecordingHeader header = {};
+  in.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!in || header.version != RECORDING_VERSION || header.frameSize != sizeof(RecordedFrame)) {
+    return false;
+  }
+
+  recording.scenarioIndex = header.scenarioIndex;
+  recording.sampleTime = header.sampleTime;
+  recording.frames.resize(header.frameCount);
+  in.read(reinterpret_cast<char*>(recording.frames.data()), header.frameCount * sizeof(RecordedFrame));
+
+  return in.good();
+}
+
+bool replayFlightRecording(const FlightRecording& recording) {
+  constexpr int signalCount = ClosedLoopSimulation::RECORDED_SIGNAL_COUNT;
+
+  Scenario scenario = generateScenarios(recording.scenarioIndex + 1)[recording.scenarioIndex];
+  auto simulation = std::make_unique<ClosedLoopSimulation>();
+  simulation->initialize(scenario);
+
+  double maxDeviation[signalCount] = {};
+  double maxDeviationTime[signalCount] = {};
+  for (const RecordedFrame& frame : recording.frames) {
+    simulation->crewInputs = frame.crewInputs;
+    simulation->replay(recording.sampleTime, frame.state, frame.outputs);
+
+    double signals[signalCount];
+    simulation->getRecordedSignals(signals);
+    for (int i = 0; i < signalCount; i++) {
+      double deviation = std::abs(signals[i] - frame.signals[i]);
+      if (deviation > maxDeviation[i]) {
+        maxDeviation[i] = deviation;
+        maxDeviationTime[i] = simulation->getSimulationTime();
+      }
+    }
+  }
+
+  bool passed = true;
+  fmt::print("replayed {} frames of {}\n", recording.frames.size(), scenario.name);
+  for (int i = 0; i < signalCount; i++) {
+    const RecordedSignal& signal = ClosedLoopSimulation::recordedSignals[i];
+    bool withinTolerance = maxDeviation[i] <= signal.tolerance;
+    passed = passed && withinTolerance;
+    fmt::print("{:<36} max deviation {:10.6f} at {:6.1f} s  tolerance {:6.3f}  {}\n", signal.name, maxDeviation[i], maxDeviationTime[i],
+               signal.tolerance, withinTolerance ? "ok" : "EXCEEDED");
+  }
+
+  return passed;
+}
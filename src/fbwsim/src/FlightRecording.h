@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ClosedLoopSimulation.h"
+
+// One frame of a recorded closed-loop flight: the plant state and crew inputs the computers saw, and their output
+// signals. Only plain doubles are stored, so that the recording does not depend on the precision the computers were
+// built with.
+struct RecordedFrame {
+  PlantState state;
+  PlantOutputs outputs;
+  CrewInputs crewInputs;
+  double signals[ClosedLoopSimulation::RECORDED_SIGNAL_COUNT];
+};
+
+struct FlightRecording {
+  int32_t scenarioIndex = 0;
+  double sampleTime = 0;
+  std::vector<RecordedFrame> frames;
+};
+
+bool writeFlightRecording(const std::string& path, const FlightRecording& recording);
+
+bool readFlightRecording(const std::string& path, FlightRecording& recording);
+
+// Replays the recorded plant states and crew inputs through the computers of this build and prints the maximum
+// deviation of every output signal from the recording. Returns true if all deviations are within their tolerances.
+bool replayFlightRecording(const FlightRecording& recording);
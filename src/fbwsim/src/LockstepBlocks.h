@@ -0,0 +1,81 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+// Experimental structure-of-arrays versions of sub-blocks that recur throughout the generated computer models (1-D
+// lookup tables, lag filters and rate limiters). A block holds the state of all redundant instances of a computer side
+// by side and steps them in lockstep. The loops run over the instances without data dependent branches, so that the
+// compiler can vectorize them. The value type follows real_T of the models they stand in for.
+
+template <typename T, std::size_t N>
+using Lanes = std::array<T, N>;
+
+// Same result as look1_binlxpw (linear interpolation and extrapolation), but the breakpoint search is a linear count
+// evaluated for all instances at once instead of a binary search. Meant for the short tables used by the computers.
+template <typename T, std::size_t N>
+void lookup1Lanes(const Lanes<T, N>& u, const T bp[], const T table[], unsigned int maxIndex, Lanes<T, N>& y) {
+  std::array<unsigned int, N> iLeft = {};
+  for (unsigned int k = 1; k < maxIndex; k++) {
+    for (std::size_t i = 0; i < N; i++) {
+      iLeft[i] += u[i] >= bp[k] ? 1 : 0;
+    }
+  }
+
+  for (std::size_t i = 0; i < N; i++) {
+    T frac = (u[i] - bp[iLeft[i]]) / (bp[iLeft[i] + 1] - bp[iLeft[i]]);
+    y[i] = (table[iLeft[i] + 1] - table[iLeft[i]]) * frac + table[iLeft[i]];
+  }
+}
+
+// Lag filter with the same discretization as the LagFilter blocks of the generated models.
+template <typename T, std::size_t N>
+class LagFilterLanes {
+ public:
+  void reset(std::size_t lane) { initialized[lane] = false; }
+
+  void step(const Lanes<T, N>& u, T c1, T dt, Lanes<T, N>& y) {
+    const T denom = dt * c1;
+    const T ca = denom / (denom + 2.0);
+
+    for (std::size_t i = 0; i < N; i++) {
+      T previousU = initialized[i] ? pU[i] : u[i];
+      T previousY = initialized[i] ? pY[i] : u[i];
+      y[i] = (2.0 - denom) / (denom + 2.0) * previousY + (u[i] * ca + previousU * ca);
+      pY[i] = y[i];
+      pU[i] = u[i];
+      initialized[i] = true;
+    }
+  }
+
+ private:
+  Lanes<T, N> pY = {};
+  Lanes<T, N> pU = {};
+  std::array<bool, N> initialized = {};
+};
+
+// Rate limiter with the same behaviour as the RateLimiter blocks of the generated models. std::min and std::max are
+// used instead of std::fmin and std::fmax so that the loop can be vectorized; they only differ for NaN inputs.
+template <typename T, std::size_t N>
+class RateLimiterLanes {
+ public:
+  void reset(std::size_t lane) { initialized[lane] = false; }
+
+  void step(const Lanes<T, N>& u, T up, T lo, T ts, const Lanes<T, N>& init, Lanes<T, N>& y) {
+    const T maxIncrease = std::abs(up) * ts;
+    const T maxDecrease = -std::abs(lo) * ts;
+
+    for (std::size_t i = 0; i < N; i++) {
+      T previousY = initialized[i] ? pY[i] : init[i];
+      y[i] = previousY + std::max(std::min(u[i] - previousY, maxIncrease), maxDecrease);
+      pY[i] = y[i];
+      initialized[i] = true;
+    }
+  }
+
+ private:
+  Lanes<T, N> pY = {};
+  std::array<bool, N> initialized = {};
+};
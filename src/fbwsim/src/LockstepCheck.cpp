@@ -0,0 +1,140 @@
+#include "LockstepCheck.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include "LockstepBlocks.h"
+#include "fmt/include/fmt/core.h"
+#include "look1_binlxpw.h"
+
+namespace {
+
+// Scalar lag filter and rate limiter, with the same state and arithmetic as the blocks in the generated models (for
+// example ElacComputer_LagFilter and ElacComputer_RateLimiter).
+struct ScalarLagFilter {
+  real_T pY;
+  real_T pU;
+  bool pY_not_empty;
+  bool pU_not_empty;
+
+  real_T step(real_T u, real_T c1, real_T dt) {
+    if (!pY_not_empty || !pU_not_empty) {
+      pU = u;
+      pU_not_empty = true;
+      pY = u;
+      pY_not_empty = true;
+    }
+
+    real_T denom = dt * c1;
+    real_T ca = denom / (denom + 2.0);
+    real_T y = (2.0 - denom) / (denom + 2.0) * pY + (u * ca + pU * ca);
+    pY = y;
+    pU = u;
+    return y;
+  }
+};
+
+struct ScalarRateLimiter {
+  real_T pY;
+  bool pY_not_empty;
+
+  real_T step(real_T u, real_T up, real_T lo, real_T ts, real_T init) {
+    if (!pY_not_empty) {
+      pY = init;
+      pY_not_empty = true;
+    }
+
+    pY += std::fmax(std::fmin(u - pY, std::abs(up) * ts), -std::abs(lo) * ts);
+    return pY;
+  }
+};
+
+// gain schedule over calibrated airspeed, shaped like the ones used by the pitch and roll laws
+const real_T scheduleBreakpoints[] = {0, 100, 140, 180, 220, 260, 300, 350, 400};
+const real_T scheduleTable[] = {1.2, 1.2, 1.0, 0.85, 0.7, 0.6, 0.52, 0.46, 0.42};
+const unsigned int scheduleMaxIndex = 8;
+
+const real_T filterC1 = 2.0;
+const real_T rateUp = 30.0;
+const real_T rateDown = 30.0;
+
+// The redundant computers see nearly the same signals: every instance gets the same airspeed and command with a small
+// offset of its own, as with independent sensors.
+real_T airspeedInput(int frame, double sampleTime, std::size_t lane) {
+  double time = frame * sampleTime;
+  return 210 + 120 * std::sin(0.05 * time) + 0.3 * lane;
+}
+
+real_T commandInput(int frame, double sampleTime, std::size_t lane) {
+  double time = frame * sampleTime;
+  return 15 * std::sin(0.7 * time) + 8 * std::sin(2.3 * time + lane) + 0.1 * lane;
+}
+
+template <std::size_t N>
+bool checkFleet(int frames, double sampleTime) {
+  // precompute the inputs so that only the blocks are timed
+  std::vector<Lanes<real_T, N>> airspeeds(frames);
+  std::vector<Lanes<real_T, N>> commands(frames);
+  for (int frame = 0; frame < frames; frame++) {
+    for (std::size_t lane = 0; lane < N; lane++) {
+      airspeeds[frame][lane] = airspeedInput(frame, sampleTime, lane);
+      commands[frame][lane] = commandInput(frame, sampleTime, lane);
+    }
+  }
+
+  std::vector<Lanes<real_T, N>> scalarOutputs(frames);
+  std::vector<Lanes<real_T, N>> lockstepOutputs(frames);
+  const Lanes<real_T, N> init = {};
+
+  // scalar path: one instance after the other, as the computers are stepped today
+  ScalarLagFilter scalarFilters[N] = {};
+  ScalarRateLimiter scalarLimiters[N] = {};
+  auto scalarStart = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < frames; frame++) {
+    for (std::size_t lane = 0; lane < N; lane++) {
+      real_T airspeed = scalarFilters[lane].step(airspeeds[frame][lane], filterC1, sampleTime);
+      real_T gain = look1_binlxpw(airspeed, scheduleBreakpoints, scheduleTable, scheduleMaxIndex);
+      scalarOutputs[frame][lane] = scalarLimiters[lane].step(gain * commands[frame][lane], rateUp, rateDown, sampleTime, init[lane]);
+    }
+  }
+  double scalarTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - scalarStart).count();
+
+  // lockstep path: all instances at once
+  LagFilterLanes<real_T, N> filter;
+  RateLimiterLanes<real_T, N> limiter;
+  auto lockstepStart = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < frames; frame++) {
+    Lanes<real_T, N> airspeed;
+    Lanes<real_T, N> gain;
+    filter.step(airspeeds[frame], filterC1, sampleTime, airspeed);
+    lookup1Lanes<real_T, N>(airspeed, scheduleBreakpoints, scheduleTable, scheduleMaxIndex, gain);
+    for (std::size_t lane = 0; lane < N; lane++) {
+      gain[lane] *= commands[frame][lane];
+    }
+    limiter.step(gain, rateUp, rateDown, sampleTime, init, lockstepOutputs[frame]);
+  }
+  double lockstepTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - lockstepStart).count();
+
+  double maxError = 0;
+  for (int frame = 0; frame < frames; frame++) {
+    for (std::size_t lane = 0; lane < N; lane++) {
+      maxError = std::max(maxError, static_cast<double>(std::abs(scalarOutputs[frame][lane] - lockstepOutputs[frame][lane])));
+    }
+  }
+
+  bool passed = maxError == 0;
+  fmt::print("lockstep {} instances: {}  max error {:g}  scalar {:.1f} ns/frame  lockstep {:.1f} ns/frame\n", N,
+             passed ? "passed" : "FAILED", maxError, scalarTime * 1e9 / frames, lockstepTime * 1e9 / frames);
+
+  return passed;
+}
+
+}  // namespace
+
+bool runLockstepCheck(int frames, double sampleTime) {
+  bool passed = checkFleet<2>(frames, sampleTime);
+  passed = checkFleet<3>(frames, sampleTime) && passed;
+  return passed;
+}
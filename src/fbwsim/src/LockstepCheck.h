@@ -0,0 +1,6 @@
+#pragma once
+
+// Runs the lockstep blocks of LockstepBlocks.h for fleets of 2 and 3 instances (ELACs and SECs) next to the scalar
+// path of the generated models, checks that both produce the same results and reports the time per frame of each.
+// Returns true if all results match.
+bool runLockstepCheck(int frames, double sampleTime);
@@ -0,0 +1,243 @@
+#include "Plant.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+constexpr double GRAVITY = 9.80665;
+constexpr double DEG_TO_RAD = M_PI / 180.0;
+constexpr double RAD_TO_DEG = 180.0 / M_PI;
+constexpr double MS_TO_KN = 1.943844;
+constexpr double M_TO_FT = 3.280840;
+
+// geometry and inertia
+constexpr double WING_AREA = 122.6;
+constexpr double WING_SPAN = 34.1;
+constexpr double MEAN_CHORD = 4.19;
+constexpr double INERTIA_XX = 2.5e6;
+constexpr double INERTIA_YY = 4.0e6;
+constexpr double INERTIA_ZZ = 6.0e6;
+
+// engines
+constexpr double MAX_THRUST_PER_ENGINE = 120000;
+constexpr double IDLE_N1 = 19;
+constexpr double ENGINE_TIME_CONSTANT = 1.5;
+
+// actuators
+constexpr double ELEVATOR_RATE = 35;
+constexpr double AILERON_RATE = 40;
+constexpr double THS_RATE = 1;
+constexpr double RUDDER_RATE = 40;
+
+constexpr int SUBSTEPS = 4;
+
+double rateLimit(double current, double target, double rate, double deltaTime) {
+  double maxChange = rate * deltaTime;
+  return current + std::clamp(target - current, -maxChange, maxChange);
+}
+
+double densityAtAltitude(double altitude) {
+  return 1.225 * std::pow(1 - 2.25577e-5 * altitude, 4.25588);
+}
+
+double temperatureAtAltitude(double altitude) {
+  return 288.15 - 0.0065 * altitude;
+}
+}  // namespace
+
+void Plant::reset(const PlantState& initialState, double massKg) {
+  state = initialState;
+  mass = massKg;
+  specificForceX = 0;
+  specificForceY = 0;
+  specificForceZ = -GRAVITY;
+  computeOutputs();
+}
+
+void Plant::restore(const PlantState& recordedState, const PlantOutputs& recordedOutputs) {
+  state = recordedState;
+  outputs = recordedOutputs;
+}
+
+void Plant::update(double deltaTime, const PlantCommands& commands) {
+  updateActuators(deltaTime, commands);
+
+  double subStepTime = deltaTime / SUBSTEPS;
+  for (int i = 0; i < SUBSTEPS; i++) {
+    integrate(subStepTime);
+  }
+
+  computeOutputs();
+}
+
+void Plant::updateActuators(double deltaTime, const PlantCommands& commands) {
+  state.leftElevatorDeg = rateLimit(state.leftElevatorDeg, std::clamp(commands.leftElevatorDeg, -30.0, 17.0), ELEVATOR_RATE, deltaTime);
+  state.rightElevatorDeg = rateLimit(state.rightElevatorDeg, std::clamp(commands.rightElevatorDeg, -30.0, 17.0), ELEVATOR_RATE, deltaTime);
+  state.thsDeg = rateLimit(state.thsDeg, std::clamp(commands.thsDeg, -13.5, 4.0), THS_RATE, deltaTime);
+  state.leftAileronDeg = rateLimit(state.leftAileronDeg, std::clamp(commands.leftAileronDeg, -25.0, 25.0), AILERON_RATE, deltaTime);
+  state.rightAileronDeg = rateLimit(state.rightAileronDeg, std::clamp(commands.rightAileronDeg, -25.0, 25.0), AILERON_RATE, deltaTime);
+  state.rudderDeg = rateLimit(state.rudderDeg, std::clamp(commands.rudderDeg, -30.0, 30.0), RUDDER_RATE, deltaTime);
+
+  for (int i = 0; i < 2; i++) {
+    double target = std::clamp(commands.n1Percent[i], IDLE_N1, 104.0);
+    state.n1[i] += (target - state.n1[i]) * std::min(1.0, deltaTime / ENGINE_TIME_CONSTANT);
+  }
+}
+
+void Plant::integrate(double deltaTime) {
+  PlantState& s = state;
+
+  double altitude = -s.down;
+  double rho = densityAtAltitude(altitude);
+  double airspeed = std::max(1.0, std::sqrt(s.u * s.u + s.v * s.v + s.w * s.w));
+  double alpha = std::atan2(s.w, s.u);
+  double beta = std::asin(std::clamp(s.v / airspeed, -1.0, 1.0));
+  double qbar = 0.5 * rho * airspeed * airspeed;
+
+  double pHat = s.p * WING_SPAN / (2 * airspeed);
+  double qHat = s.q * MEAN_CHORD / (2 * airspeed);
+  double rHat = s.r * WING_SPAN / (2 * airspeed);
+
+  double elevator = (s.leftElevatorDeg + s.rightElevatorDeg) / 2;
+  double aileron = (s.leftAileronDeg - s.rightAileronDeg) / 2;
+
+  // aerodynamic coefficients, control derivatives per deg
+  double cl = 1.25 + 5.5 * alpha + 5.0 * qHat + 0.005 * elevator + 0.008 * s.thsDeg;
+  double cd = 0.085 + 0.045 * cl * cl;
+  double cy = -0.9 * beta + 0.003 * s.rudderDeg;
+  double cRoll = -0.08 * beta - 0.5 * pHat + 0.12 * rHat + 0.0035 * aileron + 0.0003 * s.rudderDeg;
+  double cPitch = 0.12 - 2.5 * alpha - 25.0 * qHat - 0.03 * elevator - 0.05 * s.thsDeg;
+  double cYaw = 0.12 * beta - 0.03 * pHat - 0.2 * rHat - 0.0022 * s.rudderDeg;
+
+  double lift = qbar * WING_AREA * cl;
+  double drag = qbar * WING_AREA * cd;
+
+  double thrust = 0;
+  for (int i = 0; i < 2; i++) {
+    double ratio = std::clamp((s.n1[i] - IDLE_N1) / (100 - IDLE_N1), 0.0, 1.0);
+    thrust += MAX_THRUST_PER_ENGINE * (0.03 + 0.97 * std::pow(ratio, 1.5)) * (rho / 1.225);
+  }
+
+  double forceX = -drag * std::cos(alpha) + lift * std::sin(alpha) + thrust;
+  double forceY = qbar * WING_AREA * cy;
+  double forceZ = -drag * std::sin(alpha) - lift * std::cos(alpha);
+
+  double momentL = qbar * WING_AREA * WING_SPAN * cRoll;
+  double momentM = qbar * WING_AREA * MEAN_CHORD * cPitch;
+  double momentN = qbar * WING_AREA * WING_SPAN * cYaw;
+
+  double sinPhi = std::sin(s.phi), cosPhi = std::cos(s.phi);
+  double sinTheta = std::sin(s.theta), cosTheta = std::cos(s.theta);
+  double sinPsi = std::sin(s.psi), cosPsi = std::cos(s.psi);
+
+  if (s.onGround) {
+    // crude ground model: gear carries the weight, wheels brake, attitude rates are damped out
+    double normalForce = std::max(0.0, mass * GRAVITY * cosTheta + forceZ);
+    forceZ += normalForce;
+    forceX -= 0.3 * normalForce * (s.u > 0 ? 1 : 0);
+    forceY = -mass * s.v / std::max(deltaTime, 0.1);
+    momentL = -INERTIA_XX * (s.p + 2 * s.phi);
+    momentN = -INERTIA_ZZ * s.r;
+    if (s.theta <= 0 && momentM < 0) {
+      momentM = -INERTIA_YY * (s.q + s.theta);
+    }
+  }
+
+  specificForceX = forceX / mass;
+  specificForceY = forceY / mass;
+  specificForceZ = forceZ / mass;
+
+  double uDot = s.r * s.v - s.q * s.w - GRAVITY * sinTheta + specificForceX;
+  double vDot = s.p * s.w - s.r * s.u + GRAVITY * cosTheta * sinPhi + specificForceY;
+  double wDot = s.q * s.u - s.p * s.v + GRAVITY * cosTheta * cosPhi + specificForceZ;
+
+  double pDot = (momentL - (INERTIA_ZZ - INERTIA_YY) * s.q * s.r) / INERTIA_XX;
+  double qDot = (momentM - (INERTIA_XX - INERTIA_ZZ) * s.p * s.r) / INERTIA_YY;
+  double rDot = (momentN - (INERTIA_YY - INERTIA_XX) * s.p * s.q) / INERTIA_ZZ;
+
+  double phiDot = s.p + (s.q * sinPhi + s.r * cosPhi) * sinTheta / cosTheta;
+  double thetaDot = s.q * cosPhi - s.r * sinPhi;
+  double psiDot = (s.q * sinPhi + s.r * cosPhi) / cosTheta;
+
+  // body to earth
+  double vNorth = cosTheta * cosPsi * s.u + (sinPhi * sinTheta * cosPsi - cosPhi * sinPsi) * s.v +
+                  (cosPhi * sinTheta * cosPsi + sinPhi * sinPsi) * s.w;
+  double vEast = cosTheta * sinPsi * s.u + (sinPhi * sinTheta * sinPsi + cosPhi * cosPsi) * s.v +
+                 (cosPhi * sinTheta * sinPsi - sinPhi * cosPsi) * s.w;
+  double vDown = -sinTheta * s.u + sinPhi * cosTheta * s.v + cosPhi * cosTheta * s.w;
+
+  s.u += uDot * deltaTime;
+  s.v += vDot * deltaTime;
+  s.w += wDot * deltaTime;
+  s.p += pDot * deltaTime;
+  s.q += qDot * deltaTime;
+  s.r += rDot * deltaTime;
+  s.phi += phiDot * deltaTime;
+  s.theta += thetaDot * deltaTime;
+  s.psi = std::remainder(s.psi + psiDot * deltaTime, 2 * M_PI);
+  s.north += vNorth * deltaTime;
+  s.east += vEast * deltaTime;
+  s.down += vDown * deltaTime;
+
+  // ground contact
+  if (s.down >= 0) {
+    s.down = 0;
+    s.onGround = true;
+    // remove the earth-vertical velocity component
+    double vDownNew = -std::sin(s.theta) * s.u + std::sin(s.phi) * std::cos(s.theta) * s.v + std::cos(s.phi) * std::cos(s.theta) * s.w;
+    if (vDownNew > 0) {
+      s.w -= vDownNew / (std::cos(s.phi) * std::cos(s.theta));
+    }
+  } else if (s.down < -0.5) {
+    s.onGround = false;
+  }
+}
+
+void Plant::computeOutputs() {
+  const PlantState& s = state;
+
+  double altitude = -s.down;
+  double rho = densityAtAltitude(altitude);
+  double temperature = temperatureAtAltitude(altitude);
+  double speedOfSound = std::sqrt(1.4 * 287.05 * temperature);
+  double airspeed = std::sqrt(s.u * s.u + s.v * s.v + s.w * s.w);
+
+  double sinPhi = std::sin(s.phi), cosPhi = std::cos(s.phi);
+  double sinTheta = std::sin(s.theta), cosTheta = std::cos(s.theta);
+  double sinPsi = std::sin(s.psi), cosPsi = std::cos(s.psi);
+
+  double vNorth = cosTheta * cosPsi * s.u + (sinPhi * sinTheta * cosPsi - cosPhi * sinPsi) * s.v +
+                  (cosPhi * sinTheta * cosPsi + sinPhi * sinPsi) * s.w;
+  double vEast = cosTheta * sinPsi * s.u + (sinPhi * sinTheta * sinPsi + cosPhi * cosPsi) * s.v +
+                 (cosPhi * sinTheta * sinPsi - sinPhi * cosPsi) * s.w;
+  double vDown = -sinTheta * s.u + sinPhi * cosTheta * s.v + cosPhi * cosTheta * s.w;
+  double groundSpeed = std::sqrt(vNorth * vNorth + vEast * vEast);
+
+  outputs.altitudeFt = altitude * M_TO_FT;
+  outputs.radioHeightFt = altitude * M_TO_FT;
+  outputs.verticalSpeedFtMin = -vDown * M_TO_FT * 60;
+  outputs.trueAirspeedKn = airspeed * MS_TO_KN;
+  outputs.indicatedAirspeedKn = airspeed * std::sqrt(rho / 1.225) * MS_TO_KN;
+  outputs.groundSpeedKn = groundSpeed * MS_TO_KN;
+  outputs.mach = airspeed / speedOfSound;
+  outputs.alphaDeg = std::atan2(s.w, s.u) * RAD_TO_DEG;
+  outputs.betaDeg = airspeed > 1 ? std::asin(std::clamp(s.v / airspeed, -1.0, 1.0)) * RAD_TO_DEG : 0;
+  outputs.headingDeg = std::fmod(s.psi * RAD_TO_DEG + 360, 360);
+  outputs.trackDeg = std::fmod(std::atan2(vEast, vNorth) * RAD_TO_DEG + 360, 360);
+  outputs.flightPathAngleDeg = std::atan2(-vDown, std::max(groundSpeed, 1.0)) * RAD_TO_DEG;
+  outputs.pitchDeg = s.theta * RAD_TO_DEG;
+  outputs.rollDeg = s.phi * RAD_TO_DEG;
+  outputs.pitchRateDegS = s.q * RAD_TO_DEG;
+  outputs.rollRateDegS = s.p * RAD_TO_DEG;
+  outputs.yawRateDegS = s.r * RAD_TO_DEG;
+  outputs.pitchAttRateDegS = (s.q * cosPhi - s.r * sinPhi) * RAD_TO_DEG;
+  outputs.rollAttRateDegS = (s.p + (s.q * sinPhi + s.r * cosPhi) * sinTheta / cosTheta) * RAD_TO_DEG;
+  outputs.longAccelG = specificForceX / GRAVITY;
+  outputs.latAccelG = specificForceY / GRAVITY;
+  outputs.normalAccelG = -specificForceZ / GRAVITY;
+  outputs.bodyAccelX = specificForceX - GRAVITY * sinTheta;
+  outputs.bodyAccelY = specificForceY + GRAVITY * cosTheta * sinPhi;
+  outputs.bodyAccelZ = -(specificForceZ + GRAVITY * cosTheta * cosPhi);
+  outputs.staticPressureHpa = 1013.25 * std::pow(1 - 2.25577e-5 * altitude, 5.25588);
+  outputs.temperatureDegC = temperature - 273.15;
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+// Simple rigid-body stand-in for the aircraft, used to close the loop around the flight control computers
+// without the simulator. The aerodynamic model is a linear approach-configuration model (slats/flaps full,
+// gear down) and is only meant to provide plausible dynamics, not to match the real aircraft.
+
+struct PlantState {
+  // position relative to the runway threshold (north, east, down) in meters
+  double north = 0;
+  double east = 0;
+  double down = 0;
+
+  // body velocities (forward, right, down) in m/s
+  double u = 0;
+  double v = 0;
+  double w = 0;
+
+  // euler angles in rad (standard aeronautical signs)
+  double phi = 0;
+  double theta = 0;
+  double psi = 0;
+
+  // body rates in rad/s (standard aeronautical signs)
+  double p = 0;
+  double q = 0;
+  double r = 0;
+
+  // engine N1 in percent
+  double n1[2] = {};
+
+  // surface positions in deg, in the convention used by the ELAC/SEC/FAC models
+  double leftElevatorDeg = 0;
+  double rightElevatorDeg = 0;
+  double thsDeg = 0;
+  double leftAileronDeg = 0;
+  double rightAileronDeg = 0;
+  double rudderDeg = 0;
+
+  bool onGround = false;
+};
+
+struct PlantCommands {
+  double leftElevatorDeg = 0;
+  double rightElevatorDeg = 0;
+  double thsDeg = 0;
+  double leftAileronDeg = 0;
+  double rightAileronDeg = 0;
+  double rudderDeg = 0;
+  double n1Percent[2] = {};
+};
+
+struct PlantOutputs {
+  double altitudeFt;
+  double radioHeightFt;
+  double verticalSpeedFtMin;
+  double trueAirspeedKn;
+  double indicatedAirspeedKn;
+  double groundSpeedKn;
+  double mach;
+  double alphaDeg;
+  double betaDeg;
+  double headingDeg;
+  double trackDeg;
+  double flightPathAngleDeg;
+  double pitchDeg;
+  double rollDeg;
+  double pitchRateDegS;
+  double rollRateDegS;
+  double yawRateDegS;
+  double pitchAttRateDegS;
+  double rollAttRateDegS;
+  double longAccelG;
+  double latAccelG;
+  double normalAccelG;
+  double bodyAccelX;
+  double bodyAccelY;
+  double bodyAccelZ;
+  double staticPressureHpa;
+  double temperatureDegC;
+};
+
+class Plant {
+ public:
+  void reset(const PlantState& initialState, double massKg);
+
+  void update(double deltaTime, const PlantCommands& commands);
+
+  // Overwrites state and outputs, used to replay a recorded flight.
+  void restore(const PlantState& recordedState, const PlantOutputs& recordedOutputs);
+
+  const PlantState& getState() const { return state; }
+
+  const PlantOutputs& getOutputs() const { return outputs; }
+
+ private:
+  void updateActuators(double deltaTime, const PlantCommands& commands);
+
+  void integrate(double deltaTime);
+
+  void computeOutputs();
+
+  PlantState state;
+  PlantOutputs outputs = {};
+
+  double mass = 60000;
+
+  // last computed body accelerations (specific force) in m/s^2
+  double specificForceX = 0;
+  double specificForceY = 0;
+  double specificForceZ = -9.80665;
+};
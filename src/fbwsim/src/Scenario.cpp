@@ -0,0 +1,26 @@
+#include "Scenario.h"
+
+// Builds a deterministic set of approach and go-around scenarios by varying mass, start position, intercept heading
+// and go-around height. Every third scenario is a go-around.
+std::vector<Scenario> generateScenarios(int count) {
+  std::vector<Scenario> scenarios;
+  scenarios.reserve(count);
+
+  for (int i = 0; i < count; i++) {
+    Scenario scenario;
+    scenario.type = (i % 3 == 2) ? ScenarioType::GoAround : ScenarioType::Approach;
+    scenario.name = (scenario.type == ScenarioType::GoAround ? "go-around-" : "approach-") + std::to_string(i);
+    scenario.massKg = 52000 + (i % 7) * 3000;
+    scenario.startDistanceNm = 8 + (i % 5);
+    // start below the glide slope so that it is always captured from below
+    scenario.startAltitudeFt = 1800 + (i % 4) * 150;
+    // intercept the localizer from either side, always converging towards the centerline
+    scenario.lateralOffsetM = ((i % 9) - 4) * 100.0;
+    scenario.headingOffsetDeg = scenario.lateralOffsetM > 0 ? -(10 + (i % 3) * 5) : scenario.lateralOffsetM < 0 ? 10 + (i % 3) * 5 : 0;
+    scenario.approachSpeedKn = 135 + (i % 3) * 5;
+    scenario.goAroundHeightFt = 100 + (i % 4) * 100;
+    scenarios.push_back(scenario);
+  }
+
+  return scenarios;
+}
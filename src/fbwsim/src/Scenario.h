@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+enum class ScenarioType {
+  Approach,
+  GoAround,
+};
+
+// Initial conditions and crew actions of a single closed-loop run. The runway threshold is at the origin, the runway
+// is aligned with north and the ILS glide slope is 3 deg.
+struct Scenario {
+  std::string name;
+  ScenarioType type = ScenarioType::Approach;
+
+  double massKg = 62000;
+  double startDistanceNm = 10;
+  double startAltitudeFt = 3000;
+  double lateralOffsetM = 0;
+  double headingOffsetDeg = 0;
+  double approachSpeedKn = 140;
+
+  // radio height at which TOGA is selected for go-around scenarios
+  double goAroundHeightFt = 200;
+  // altitude at which a go-around scenario is considered complete
+  double goAroundTargetAltitudeFt = 2500;
+
+  double maxDuration = 600;
+};
+
+struct ScenarioResult {
+  std::string name;
+  bool completed = false;
+  double simulatedTime = 0;
+  double wallTime = 0;
+  double touchdownDistanceM = 0;
+  double touchdownVerticalSpeedFtMin = 0;
+  double maxLocalizerDeviationDeg = 0;
+  double maxGlideSlopeDeviationDeg = 0;
+  double finalAltitudeFt = 0;
+};
+
+std::vector<Scenario> generateScenarios(int count);
@@ -0,0 +1,204 @@
+#include "SimulatorStub.h"
+
+#include <cstring>
+#include <deque>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+struct Variables {
+  std::unordered_map<std::string, ID> namedVariableIds;
+  std::vector<double> namedVariables;
+
+  // the dispatch messages answering the requests on SimObjects, by request id
+  std::map<SIMCONNECT_DATA_REQUEST_ID, std::vector<unsigned char>> simObjectData;
+  std::deque<SIMCONNECT_DATA_REQUEST_ID> pendingRequests;
+
+  size_t clientDataWriteCount = 0;
+};
+
+Variables variables;
+
+// the data of a SimObject follows the header of the dispatch message, in place of its dwData member
+size_t simObjectDataOffset() {
+  SIMCONNECT_RECV_SIMOBJECT_DATA header = {};
+  return reinterpret_cast<unsigned char*>(&header.dwData) - reinterpret_cast<unsigned char*>(&header);
+}
+
+ID namedVariableId(const std::string& name) {
+  auto [it, inserted] = variables.namedVariableIds.try_emplace(name, static_cast<ID>(variables.namedVariables.size()));
+  if (inserted) {
+    variables.namedVariables.push_back(0);
+  }
+  return it->second;
+}
+
+}  // namespace
+
+namespace SimulatorStub {
+
+void setNamedVariable(const std::string& name, double value) {
+  variables.namedVariables[namedVariableId(name)] = value;
+}
+
+double getNamedVariable(const std::string& name) {
+  return variables.namedVariables[namedVariableId(name)];
+}
+
+void setSimObjectData(SIMCONNECT_DATA_REQUEST_ID requestId, const void* data, size_t size) {
+  std::vector<unsigned char>& message = variables.simObjectData[requestId];
+  message.assign(simObjectDataOffset() + size, 0);
+
+  SIMCONNECT_RECV_SIMOBJECT_DATA header = {};
+  header.dwSize = static_cast<DWORD>(message.size());
+  header.dwID = SIMCONNECT_RECV_ID_SIMOBJECT_DATA;
+  header.dwRequestID = requestId;
+  std::memcpy(message.data(), &header, simObjectDataOffset());
+  std::memcpy(message.data() + simObjectDataOffset(), data, size);
+}
+
+size_t getClientDataWriteCount() {
+  return variables.clientDataWriteCount;
+}
+
+}  // namespace SimulatorStub
+
+ID register_named_variable(PCSTRINGZ name) {
+  return namedVariableId(name);
+}
+
+FLOAT64 get_named_variable_value(ID id) {
+  return id >= 0 && static_cast<size_t>(id) < variables.namedVariables.size() ? variables.namedVariables[id] : 0;
+}
+
+void set_named_variable_value(ID id, FLOAT64 value) {
+  if (id >= 0 && static_cast<size_t>(id) < variables.namedVariables.size()) {
+    variables.namedVariables[id] = value;
+  }
+}
+
+void unregister_all_named_vars() {}
+
+ENUM get_aircraft_var_enum(PCSTRINGZ) {
+  return 0;
+}
+
+ENUM get_units_enum(PCSTRINGZ) {
+  return 0;
+}
+
+FLOAT64 aircraft_varget(ENUM, ENUM, SINT32) {
+  return 0;
+}
+
+BOOL execute_calculator_code(PCSTRINGZ, FLOAT64* floatValue, SINT32* intValue, PCSTRINGZ* stringValue) {
+  if (floatValue) {
+    *floatValue = 0;
+  }
+  if (intValue) {
+    *intValue = 0;
+  }
+  if (stringValue) {
+    *stringValue = "";
+  }
+  return TRUE;
+}
+
+void register_key_event_handler_EX1(GAUGE_KEY_EVENT_HANDLER_EX1, PVOID) {}
+
+void unregister_key_event_handler_EX1(GAUGE_KEY_EVENT_HANDLER_EX1, PVOID) {}
+
+HRESULT SimConnect_Open(HANDLE* phSimConnect, const char*, void*, DWORD, HANDLE, DWORD) {
+  *phSimConnect = &variables;
+  return S_OK;
+}
+
+HRESULT SimConnect_Close(HANDLE) {
+  return S_OK;
+}
+
+HRESULT SimConnect_GetNextDispatch(HANDLE, SIMCONNECT_RECV** ppData, DWORD* pcbData) {
+  while (!variables.pendingRequests.empty()) {
+    auto it = variables.simObjectData.find(variables.pendingRequests.front());
+    variables.pendingRequests.pop_front();
+    if (it != variables.simObjectData.end()) {
+      *ppData = reinterpret_cast<SIMCONNECT_RECV*>(it->second.data());
+      *pcbData = static_cast<DWORD>(it->second.size());
+      return S_OK;
+    }
+  }
+  return E_FAIL;
+}
+
+HRESULT SimConnect_AddToDataDefinition(HANDLE, SIMCONNECT_DATA_DEFINITION_ID, const char*, const char*, SIMCONNECT_DATATYPE, float, DWORD) {
+  return S_OK;
+}
+
+HRESULT SimConnect_RequestDataOnSimObject(HANDLE,
+                                          SIMCONNECT_DATA_REQUEST_ID RequestID,
+                                          SIMCONNECT_DATA_DEFINITION_ID,
+                                          SIMCONNECT_OBJECT_ID,
+                                          SIMCONNECT_PERIOD,
+                                          DWORD,
+                                          DWORD,
+                                          DWORD,
+                                          DWORD) {
+  variables.pendingRequests.push_back(RequestID);
+  return S_OK;
+}
+
+HRESULT SimConnect_SetDataOnSimObject(HANDLE, SIMCONNECT_DATA_DEFINITION_ID, SIMCONNECT_OBJECT_ID, DWORD, DWORD, DWORD, void*) {
+  return S_OK;
+}
+
+HRESULT SimConnect_MapClientEventToSimEvent(HANDLE, SIMCONNECT_CLIENT_EVENT_ID, const char*) {
+  return S_OK;
+}
+
+HRESULT SimConnect_AddClientEventToNotificationGroup(HANDLE, SIMCONNECT_NOTIFICATION_GROUP_ID, SIMCONNECT_CLIENT_EVENT_ID, BOOL) {
+  return S_OK;
+}
+
+HRESULT SimConnect_SetNotificationGroupPriority(HANDLE, SIMCONNECT_NOTIFICATION_GROUP_ID, DWORD) {
+  return S_OK;
+}
+
+HRESULT SimConnect_TransmitClientEvent(HANDLE,
+                                       SIMCONNECT_OBJECT_ID,
+                                       SIMCONNECT_CLIENT_EVENT_ID,
+                                       DWORD,
+                                       SIMCONNECT_NOTIFICATION_GROUP_ID,
+                                       DWORD) {
+  return S_OK;
+}
+
+HRESULT SimConnect_MapClientDataNameToID(HANDLE, const char*, SIMCONNECT_CLIENT_DATA_ID) {
+  return S_OK;
+}
+
+HRESULT SimConnect_CreateClientData(HANDLE, SIMCONNECT_CLIENT_DATA_ID, DWORD, DWORD) {
+  return S_OK;
+}
+
+HRESULT SimConnect_AddToClientDataDefinition(HANDLE, SIMCONNECT_CLIENT_DATA_DEFINITION_ID, DWORD, DWORD, float, DWORD) {
+  return S_OK;
+}
+
+HRESULT SimConnect_RequestClientData(HANDLE,
+                                     SIMCONNECT_CLIENT_DATA_ID,
+                                     SIMCONNECT_DATA_REQUEST_ID,
+                                     SIMCONNECT_CLIENT_DATA_DEFINITION_ID,
+                                     SIMCONNECT_CLIENT_DATA_PERIOD,
+                                     DWORD,
+                                     DWORD,
+                                     DWORD,
+                                     DWORD) {
+  return S_OK;
+}
+
+HRESULT SimConnect_SetClientData(HANDLE, SIMCONNECT_CLIENT_DATA_ID, SIMCONNECT_CLIENT_DATA_DEFINITION_ID, DWORD, DWORD, DWORD, void*) {
+  variables.clientDataWriteCount++;
+  return S_OK;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include <SimConnect.h>
+
+// In-memory stand-in for the simulator behind the MSFS gauge API and SimConnect, to run the fly-by-wire interface on
+// the host. Local variables are kept in memory, aircraft variables and calculator code read 0, and every SimConnect
+// call succeeds. A data request on a SimObject is answered by the next dispatch with the data last set for it.
+namespace SimulatorStub {
+
+void setNamedVariable(const std::string& name, double value);
+double getNamedVariable(const std::string& name);
+
+// Sets the data that answers the requests with the given id. The data is copied here, so that answering a request does
+// not copy it again.
+void setSimObjectData(SIMCONNECT_DATA_REQUEST_ID requestId, const void* data, size_t size);
+
+// Number of client data writes since the start.
+size_t getClientDataWriteCount();
+
+}  // namespace SimulatorStub
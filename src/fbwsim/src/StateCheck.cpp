@@ -0,0 +1,105 @@
+#include "StateCheck.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "ClosedLoopSimulation.h"
+#include "SnapshotArena.h"
+#include "fmt/include/fmt/core.h"
+
+namespace {
+
+// large enough for all models and computers of the A320
+constexpr size_t ARENA_CAPACITY = 16 * 1024 * 1024;
+
+// time flown before the state is saved, the AP, A/THR and approach mode are engaged by then
+constexpr double SAVE_TIME = 20;
+
+// One frame of the run after the snapshot: everything the computers feed back into the plant, and the plant response.
+struct CheckedFrame {
+  PlantState state;
+  PlantOutputs outputs;
+  double signals[ClosedLoopSimulation::RECORDED_SIGNAL_COUNT];
+};
+
+std::vector<CheckedFrame> fly(ClosedLoopSimulation& simulation, int frames, double sampleTime) {
+  std::vector<CheckedFrame> result(frames);
+  for (auto& frame : result) {
+    simulation.update(sampleTime);
+    frame.state = simulation.getPlant().getState();
+    frame.outputs = simulation.getPlant().getOutputs();
+    simulation.getRecordedSignals(frame.signals);
+  }
+  return result;
+}
+
+}  // namespace
+
+bool runStateCheck(int frames, double sampleTime) {
+  Scenario scenario = generateScenarios(1)[0];
+
+  // the computers rely on being zero initialized, so allocate on the heap
+  auto simulation = std::make_unique<ClosedLoopSimulation>();
+  simulation->initialize(scenario);
+
+  // crew actions as in the scenarios
+  while (simulation->getSimulationTime() < SAVE_TIME) {
+    double time = simulation->getSimulationTime();
+    if (std::abs(time - 8.0) < sampleTime / 2) {
+      simulation->crewInputs.AP_1_push = true;
+      simulation->crewInputs.ATHR_push = true;
+    }
+    if (std::abs(time - 10.0) < sampleTime / 2) {
+      simulation->crewInputs.APPR_push = true;
+    }
+    simulation->update(sampleTime);
+  }
+
+  bool passed = true;
+
+  SnapshotArena arena(ARENA_CAPACITY);
+  if (!simulation->saveState(arena)) {
+    fmt::print("save:              FAILED, the snapshot does not fit into {} bytes\n", ARENA_CAPACITY);
+    return false;
+  }
+  fmt::print("snapshot size:     {} bytes\n", arena.size());
+
+  std::vector<CheckedFrame> reference = fly(*simulation, frames, sampleTime);
+
+  // a snapshot that does not fit must be refused when saving and when restoring
+  SnapshotArena truncatedArena(arena.size() - 1);
+  bool truncatedSaveRefused = !simulation->saveState(truncatedArena);
+  bool truncatedRestoreRefused = !simulation->restoreState(truncatedArena);
+  fmt::print("truncated save:    {}\n", truncatedSaveRefused ? "refused" : "FAILED, accepted");
+  fmt::print("truncated restore: {}\n", truncatedRestoreRefused ? "refused" : "FAILED, accepted");
+  passed &= truncatedSaveRefused && truncatedRestoreRefused;
+
+  if (!simulation->restoreState(arena)) {
+    fmt::print("restore:           FAILED\n");
+    return false;
+  }
+
+  std::vector<CheckedFrame> restored = fly(*simulation, frames, sampleTime);
+
+  int firstMismatch = -1;
+  for (int i = 0; i < frames && firstMismatch < 0; i++) {
+    const CheckedFrame& a = reference[i];
+    const CheckedFrame& b = restored[i];
+    if (std::memcmp(&a.state.north, &b.state.north, offsetof(PlantState, onGround)) != 0 || a.state.onGround != b.state.onGround ||
+        std::memcmp(&a.outputs, &b.outputs, sizeof(PlantOutputs)) != 0 || std::memcmp(a.signals, b.signals, sizeof(a.signals)) != 0) {
+      firstMismatch = i;
+    }
+  }
+
+  if (firstMismatch >= 0) {
+    fmt::print("restored run:      FAILED, differs from frame {} on\n", firstMismatch);
+  } else {
+    fmt::print("restored run:      bit-identical over {} frames\n", frames);
+  }
+  passed &= firstMismatch < 0;
+
+  return passed;
+}
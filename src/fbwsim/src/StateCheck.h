@@ -0,0 +1,6 @@
+#pragma once
+
+// Flies into an approach, saves the state of the simulation, flies the given frames, restores the state and flies the
+// same frames again. Checks that both runs produce bit-identical outputs and that a truncated snapshot is refused.
+// Returns true if all checks pass.
+bool runStateCheck(int frames, double sampleTime);
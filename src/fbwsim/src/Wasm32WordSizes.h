@@ -0,0 +1,11 @@
+#pragma once
+
+// The autopilot state machine was generated for the 32-bit WebAssembly target and checks the size of long at compile
+// time. The model does not use long itself, so pretend a 32-bit long for the generated sources on 64-bit hosts.
+
+#include <climits>
+
+#undef ULONG_MAX
+#undef LONG_MAX
+#define ULONG_MAX 0xFFFFFFFFU
+#define LONG_MAX 0x7FFFFFFF
@@ -0,0 +1,239 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ClosedLoopSimulation.h"
+#include "CopyCount.h"
+#include "FlightRecording.h"
+#include "LockstepCheck.h"
+#include "Scenario.h"
+#include "StateCheck.h"
+#include "commandline/CommandLine.hpp"
+#include "fmt/include/fmt/core.h"
+
+// Flies a single scenario as fast as possible (no frame pacing) and collects the result. If a recording is given, the
+// inputs and outputs of the computers are recorded for every frame.
+ScenarioResult runScenario(const Scenario& scenario, double sampleTime, bool trace, FlightRecording* recording) {
+  ScenarioResult result;
+  result.name = scenario.name;
+
+  // the computers rely on being zero initialized, so allocate on the heap instead of the (possibly small) thread stack
+  auto simulation = std::make_unique<ClosedLoopSimulation>();
+  simulation->initialize(scenario);
+
+  auto startTime = std::chrono::steady_clock::now();
+
+  bool goAroundSelected = false;
+  while (simulation->getSimulationTime() < scenario.maxDuration) {
+    double time = simulation->getSimulationTime();
+    const PlantOutputs& outputs = simulation->getPlant().getOutputs();
+
+    // crew actions: engage AP1 and A/THR once the computers are up (the AP can only be engaged after 5 s in the air),
+    // then arm the approach
+    if (std::abs(time - 8.0) < sampleTime / 2) {
+      simulation->crewInputs.AP_1_push = true;
+      simulation->crewInputs.ATHR_push = true;
+    }
+    if (std::abs(time - 10.0) < sampleTime / 2) {
+      simulation->crewInputs.APPR_push = true;
+    }
+    if (scenario.type == ScenarioType::GoAround && !goAroundSelected && time > 15 &&
+        outputs.radioHeightFt < scenario.goAroundHeightFt) {
+      simulation->crewInputs.thrustLeverAngle = 45;
+      goAroundSelected = true;
+    }
+
+    // the plant stops the vertical motion on ground contact, so keep the last airborne value for the touchdown
+    double verticalSpeedFtMin = outputs.verticalSpeedFtMin;
+
+    RecordedFrame frame;
+    if (recording) {
+      frame.state = simulation->getPlant().getState();
+      frame.outputs = outputs;
+      frame.crewInputs = simulation->crewInputs;
+    }
+
+    simulation->update(sampleTime);
+
+    if (recording) {
+      simulation->getRecordedSignals(frame.signals);
+      recording->frames.push_back(frame);
+    }
+
+    if (trace && std::fmod(simulation->getSimulationTime() + sampleTime / 2, 1.0) < sampleTime) {
+      const PlantState& s = simulation->getPlant().getState();
+      const ap_raw_laws_input& ap = simulation->getAutopilotStateMachineOutput();
+      const athr_output& athr = simulation->getAutothrustOutput();
+      fmt::print(
+          "{:6.1f} alt {:7.1f} ias {:6.1f} vs {:7.1f} hdg {:6.1f} pitch {:5.1f} roll {:6.1f} n1 {:5.1f} elev {:5.1f} ths {:5.1f} "
+          "ail {:5.1f} rud {:5.1f} loc {:6.2f} gs {:6.2f} ap {} lat {} vert {} athr {} {}\n",
+          simulation->getSimulationTime(), outputs.altitudeFt, outputs.indicatedAirspeedKn, outputs.verticalSpeedFtMin,
+          outputs.headingDeg, outputs.pitchDeg, outputs.rollDeg, s.n1[0], s.leftElevatorDeg, s.thsDeg, s.leftAileronDeg, s.rudderDeg,
+          simulation->getLocalizerDeviationDeg(), simulation->getGlideSlopeDeviationDeg(), ap.enabled_AP1, ap.lateral_mode,
+          ap.vertical_mode, static_cast<int>(athr.status), static_cast<int>(athr.mode));
+    }
+
+    const PlantState& state = simulation->getPlant().getState();
+    if (simulation->getSimulationTime() > 15 && outputs.radioHeightFt > 50 && !goAroundSelected) {
+      result.maxLocalizerDeviationDeg = std::max(result.maxLocalizerDeviationDeg, std::abs(simulation->getLocalizerDeviationDeg()));
+      result.maxGlideSlopeDeviationDeg = std::max(result.maxGlideSlopeDeviationDeg, std::abs(simulation->getGlideSlopeDeviationDeg()));
+    }
+
+    if (scenario.type == ScenarioType::Approach && state.onGround) {
+      result.completed = true;
+      result.touchdownDistanceM = state.north;
+      result.touchdownVerticalSpeedFtMin = verticalSpeedFtMin;
+      break;
+    }
+    if (scenario.type == ScenarioType::GoAround && goAroundSelected &&
+        simulation->getPlant().getOutputs().altitudeFt > scenario.goAroundTargetAltitudeFt - 100) {
+      result.completed = true;
+      break;
+    }
+    if (state.onGround && goAroundSelected) {
+      break;
+    }
+  }
+
+  result.simulatedTime = simulation->getSimulationTime();
+  result.wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+  result.finalAltitudeFt = simulation->getPlant().getOutputs().altitudeFt;
+
+  return result;
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  int32_t scenarioCount = 100;
+  int32_t threadCount = static_cast<int32_t>(std::max(1u, std::thread::hardware_concurrency()));
+  double sampleTime = 1.0 / 30.0;
+  bool verbose = false;
+  bool trace = false;
+  int32_t lockstepFrames = 0;
+  int32_t stateCheckFrames = 0;
+  int32_t copyCountFrames = 0;
+  std::string recordFilePath;
+  std::string replayFilePath;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args("Flies approach and go-around scenarios against the A320 fly-by-wire computers in closed loop");
+  args.addArgument({"-n", "--scenarios"}, &scenarioCount, "Number of scenarios");
+  args.addArgument({"-j", "--threads"}, &threadCount, "Number of worker threads");
+  args.addArgument({"-t", "--sample-time"}, &sampleTime, "Sample time in seconds");
+  args.addArgument({"-v", "--verbose"}, &verbose, "Print the result of every scenario");
+  args.addArgument({"-r", "--trace"}, &trace, "Print a time history of the first scenario");
+  args.addArgument({"-o", "--record"}, &recordFilePath, "Record the first scenario to the given file");
+  args.addArgument({"-p", "--replay"}, &replayFilePath, "Replay a recorded flight and compare the outputs of the computers");
+  args.addArgument({"-l", "--lockstep-check"}, &lockstepFrames, "Check the lockstep blocks against the scalar path for the given frames");
+  args.addArgument({"-s", "--state-check"}, &stateCheckFrames, "Check that a restored state flies the given frames bit-identically");
+  args.addArgument({"-c", "--copy-count"}, &copyCountFrames, "Count the bytes the A320 interface copies per frame over the given frames");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (std::runtime_error const& e) {
+    fmt::print("{}\n", e.what());
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    std::cout << std::endl;
+    return 0;
+  }
+
+  // check parameters
+  if (scenarioCount < 1 || threadCount < 1 || sampleTime <= 0) {
+    fmt::print("Invalid parameters!\n");
+    return 1;
+  }
+
+  // the lockstep check runs instead of the scenarios
+  if (lockstepFrames > 0) {
+    return runLockstepCheck(lockstepFrames, sampleTime) ? 0 : 2;
+  }
+
+  // the state check runs instead of the scenarios
+  if (stateCheckFrames > 0) {
+    return runStateCheck(stateCheckFrames, sampleTime) ? 0 : 2;
+  }
+
+  // the copy count runs instead of the scenarios
+  if (copyCountFrames > 0) {
+    return runCopyCount(copyCountFrames, sampleTime) ? 0 : 2;
+  }
+
+  // the replay runs instead of the scenarios
+  if (!replayFilePath.empty()) {
+    FlightRecording recording;
+    if (!readFlightRecording(replayFilePath, recording)) {
+      fmt::print("Failed to read recording '{}'!\n", replayFilePath);
+      return 1;
+    }
+    return replayFlightRecording(recording) ? 0 : 2;
+  }
+
+  std::vector<Scenario> scenarios = generateScenarios(scenarioCount);
+  std::vector<ScenarioResult> results(scenarios.size());
+  std::atomic<size_t> nextScenario = 0;
+
+  FlightRecording recording;
+  recording.scenarioIndex = 0;
+  recording.sampleTime = sampleTime;
+
+  // every worker takes the next scenario until all are done
+  auto startTime = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for (int i = 0; i < std::min<int>(threadCount, scenarioCount); i++) {
+    workers.emplace_back([&]() {
+      for (size_t index = nextScenario++; index < scenarios.size(); index = nextScenario++) {
+        results[index] = runScenario(scenarios[index], sampleTime, trace && index == 0,
+                                     !recordFilePath.empty() && index == 0 ? &recording : nullptr);
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  double wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+  // report
+  double simulatedTime = 0;
+  double workerTime = 0;
+  int completed = 0;
+  for (const auto& result : results) {
+    simulatedTime += result.simulatedTime;
+    workerTime += result.wallTime;
+    completed += result.completed ? 1 : 0;
+
+    if (verbose || !result.completed) {
+      fmt::print("{:<16} {:<10} sim {:7.1f} s  touchdown {:7.1f} m {:7.1f} ft/min  max dev loc {:5.2f} gs {:5.2f} deg  alt {:7.1f} ft\n",
+                 result.name, result.completed ? "completed" : "FAILED", result.simulatedTime, result.touchdownDistanceM,
+                 result.touchdownVerticalSpeedFtMin, result.maxLocalizerDeviationDeg, result.maxGlideSlopeDeviationDeg,
+                 result.finalAltitudeFt);
+    }
+  }
+
+  if (!recordFilePath.empty() && !writeFlightRecording(recordFilePath, recording)) {
+    fmt::print("Failed to write recording '{}'!\n", recordFilePath);
+    return 1;
+  }
+
+  fmt::print("scenarios:         {} ({} completed)\n", results.size(), completed);
+  fmt::print("threads:           {}\n", workers.size());
+  fmt::print("simulated time:    {:.1f} s\n", simulatedTime);
+  fmt::print("wall time:         {:.3f} s\n", wallTime);
+  fmt::print("throughput:        {:.1f} simulated s / wall s\n", simulatedTime / wallTime);
+  fmt::print("per thread:        {:.1f} simulated s / wall s\n", simulatedTime / workerTime);
+
+  return completed == static_cast<int>(results.size()) ? 0 : 2;
+}
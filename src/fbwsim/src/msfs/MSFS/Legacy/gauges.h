@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+
+// Types and functions of the MSFS gauge API that the fly-by-wire interface uses, for building it on the host. The
+// functions are implemented in memory by SimulatorStub.cpp.
+using ID = int;
+using ID32 = unsigned int;
+using ENUM = unsigned int;
+using BOOL = int;
+using DWORD = unsigned long;
+using UINT32 = uint32_t;
+using SINT32 = int32_t;
+using INT64 = int64_t;
+using FLOAT64 = double;
+using PVOID = void*;
+using PCSTRINGZ = const char*;
+using FsContext = uint64_t;
+
+#define TRUE 1
+#define FALSE 0
+
+#define PANEL_SERVICE_PRE_INSTALL 0
+#define PANEL_SERVICE_PRE_DRAW 8
+#define PANEL_SERVICE_PRE_KILL 10
+
+#define KEY_AILERON_LEFT 65588
+#define KEY_AILERON_RIGHT 65589
+
+struct sGaugeDrawData {
+  double mx;
+  double my;
+  double t;
+  double dt;
+  int winWidth;
+  int winHeight;
+  int fbWidth;
+  int fbHeight;
+};
+
+using GAUGE_KEY_EVENT_HANDLER_EX1 =
+    void (*)(ID32 event, UINT32 value0, UINT32 value1, UINT32 value2, UINT32 value3, UINT32 value4, PVOID userdata);
+
+ID register_named_variable(PCSTRINGZ name);
+FLOAT64 get_named_variable_value(ID id);
+void set_named_variable_value(ID id, FLOAT64 value);
+void unregister_all_named_vars();
+
+ENUM get_aircraft_var_enum(PCSTRINGZ name);
+ENUM get_units_enum(PCSTRINGZ name);
+FLOAT64 aircraft_varget(ENUM variable, ENUM units, SINT32 index);
+
+BOOL execute_calculator_code(PCSTRINGZ code, FLOAT64* floatValue, SINT32* intValue, PCSTRINGZ* stringValue);
+
+void register_key_event_handler_EX1(GAUGE_KEY_EVENT_HANDLER_EX1 handler, PVOID userdata);
+void unregister_key_event_handler_EX1(GAUGE_KEY_EVENT_HANDLER_EX1 handler, PVOID userdata);
+
+// the fly-by-wire interface calls min and max without qualification and with mixed argument types
+template <typename A, typename B>
+constexpr auto max(A a, B b) {
+  return a > b ? a : b;
+}
+
+template <typename A, typename B>
+constexpr auto min(A a, B b) {
+  return a < b ? a : b;
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+// Host stand-in for the MSFS SDK header of the same name, see Legacy/gauges.h.
+#include "Legacy/gauges.h"
+
+#define MSFS_CALLBACK
@@ -0,0 +1,242 @@
+#pragma once
+
+#include "MSFS/Legacy/gauges.h"
+
+// Types and functions of SimConnect that the fly-by-wire interface uses, for building it on the host. The functions are
+// implemented in memory by SimulatorStub.cpp.
+using HANDLE = void*;
+using HRESULT = long;
+using SIMCONNECT_DATA_DEFINITION_ID = DWORD;
+using SIMCONNECT_DATA_REQUEST_ID = DWORD;
+using SIMCONNECT_CLIENT_EVENT_ID = DWORD;
+using SIMCONNECT_CLIENT_DATA_ID = DWORD;
+using SIMCONNECT_CLIENT_DATA_DEFINITION_ID = DWORD;
+using SIMCONNECT_NOTIFICATION_GROUP_ID = DWORD;
+using SIMCONNECT_OBJECT_ID = DWORD;
+
+#define S_OK 0
+#define E_FAIL -1
+#define SUCCEEDED(result) ((result) >= 0)
+#define FAILED(result) ((result) < 0)
+
+#define SIMCONNECT_UNUSED 0xFFFFFFFF
+#define SIMCONNECT_OBJECT_ID_USER 0
+
+#define SIMCONNECT_CLIENTDATAOFFSET_AUTO (-1)
+#define SIMCONNECT_CLIENTDATATYPE_INT8 (-1)
+#define SIMCONNECT_CLIENTDATATYPE_INT64 (-4)
+#define SIMCONNECT_CLIENTDATATYPE_FLOAT64 (-6)
+
+#define SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT 0
+#define SIMCONNECT_CREATE_CLIENT_DATA_FLAG_DEFAULT 0
+#define SIMCONNECT_EVENT_FLAG_GROUPID_IS_PRIORITY 0x00000010
+
+#define SIMCONNECT_GROUP_PRIORITY_HIGHEST 1
+#define SIMCONNECT_GROUP_PRIORITY_HIGHEST_MASKABLE 10000000
+#define SIMCONNECT_GROUP_PRIORITY_DEFAULT 2000000000
+
+enum SIMCONNECT_DATATYPE {
+  SIMCONNECT_DATATYPE_INVALID,
+  SIMCONNECT_DATATYPE_INT32,
+  SIMCONNECT_DATATYPE_INT64,
+  SIMCONNECT_DATATYPE_FLOAT32,
+  SIMCONNECT_DATATYPE_FLOAT64,
+  SIMCONNECT_DATATYPE_STRING8,
+  SIMCONNECT_DATATYPE_STRING32,
+  SIMCONNECT_DATATYPE_STRING64,
+  SIMCONNECT_DATATYPE_STRING128,
+  SIMCONNECT_DATATYPE_STRING256,
+  SIMCONNECT_DATATYPE_STRING260,
+  SIMCONNECT_DATATYPE_STRINGV,
+  SIMCONNECT_DATATYPE_INITPOSITION,
+  SIMCONNECT_DATATYPE_MARKERSTATE,
+  SIMCONNECT_DATATYPE_WAYPOINT,
+  SIMCONNECT_DATATYPE_LATLONALT,
+  SIMCONNECT_DATATYPE_XYZ,
+};
+
+enum SIMCONNECT_PERIOD {
+  SIMCONNECT_PERIOD_NEVER,
+  SIMCONNECT_PERIOD_ONCE,
+  SIMCONNECT_PERIOD_VISUAL_FRAME,
+  SIMCONNECT_PERIOD_SIM_FRAME,
+  SIMCONNECT_PERIOD_SECOND,
+};
+
+enum SIMCONNECT_CLIENT_DATA_PERIOD {
+  SIMCONNECT_CLIENT_DATA_PERIOD_NEVER,
+  SIMCONNECT_CLIENT_DATA_PERIOD_ONCE,
+  SIMCONNECT_CLIENT_DATA_PERIOD_VISUAL_FRAME,
+  SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET,
+  SIMCONNECT_CLIENT_DATA_PERIOD_SECOND,
+};
+
+enum SIMCONNECT_RECV_ID {
+  SIMCONNECT_RECV_ID_NULL,
+  SIMCONNECT_RECV_ID_EXCEPTION,
+  SIMCONNECT_RECV_ID_OPEN,
+  SIMCONNECT_RECV_ID_QUIT,
+  SIMCONNECT_RECV_ID_EVENT,
+  SIMCONNECT_RECV_ID_EVENT_OBJECT_ADDREMOVE,
+  SIMCONNECT_RECV_ID_EVENT_FILENAME,
+  SIMCONNECT_RECV_ID_EVENT_FRAME,
+  SIMCONNECT_RECV_ID_SIMOBJECT_DATA,
+  SIMCONNECT_RECV_ID_SIMOBJECT_DATA_BYTYPE,
+  SIMCONNECT_RECV_ID_WEATHER_OBSERVATION,
+  SIMCONNECT_RECV_ID_CLOUD_STATE,
+  SIMCONNECT_RECV_ID_ASSIGNED_OBJECT_ID,
+  SIMCONNECT_RECV_ID_RESERVED_KEY,
+  SIMCONNECT_RECV_ID_CUSTOM_ACTION,
+  SIMCONNECT_RECV_ID_SYSTEM_STATE,
+  SIMCONNECT_RECV_ID_CLIENT_DATA,
+};
+
+enum SIMCONNECT_EXCEPTION {
+  SIMCONNECT_EXCEPTION_NONE,
+  SIMCONNECT_EXCEPTION_ERROR,
+  SIMCONNECT_EXCEPTION_SIZE_MISMATCH,
+  SIMCONNECT_EXCEPTION_UNRECOGNIZED_ID,
+  SIMCONNECT_EXCEPTION_UNOPENED,
+  SIMCONNECT_EXCEPTION_VERSION_MISMATCH,
+  SIMCONNECT_EXCEPTION_TOO_MANY_GROUPS,
+  SIMCONNECT_EXCEPTION_NAME_UNRECOGNIZED,
+  SIMCONNECT_EXCEPTION_TOO_MANY_EVENT_NAMES,
+  SIMCONNECT_EXCEPTION_EVENT_ID_DUPLICATE,
+  SIMCONNECT_EXCEPTION_TOO_MANY_MAPS,
+  SIMCONNECT_EXCEPTION_TOO_MANY_OBJECTS,
+  SIMCONNECT_EXCEPTION_TOO_MANY_REQUESTS,
+  SIMCONNECT_EXCEPTION_WEATHER_INVALID_PORT,
+  SIMCONNECT_EXCEPTION_WEATHER_INVALID_METAR,
+  SIMCONNECT_EXCEPTION_WEATHER_UNABLE_TO_GET_OBSERVATION,
+  SIMCONNECT_EXCEPTION_WEATHER_UNABLE_TO_CREATE_STATION,
+  SIMCONNECT_EXCEPTION_WEATHER_UNABLE_TO_REMOVE_STATION,
+  SIMCONNECT_EXCEPTION_INVALID_DATA_TYPE,
+  SIMCONNECT_EXCEPTION_INVALID_DATA_SIZE,
+  SIMCONNECT_EXCEPTION_DATA_ERROR,
+  SIMCONNECT_EXCEPTION_INVALID_ARRAY,
+  SIMCONNECT_EXCEPTION_CREATE_OBJECT_FAILED,
+  SIMCONNECT_EXCEPTION_LOAD_FLIGHTPLAN_FAILED,
+  SIMCONNECT_EXCEPTION_OPERATION_INVALID_FOR_OBJECT_TYPE,
+  SIMCONNECT_EXCEPTION_ILLEGAL_OPERATION,
+  SIMCONNECT_EXCEPTION_ALREADY_SUBSCRIBED,
+  SIMCONNECT_EXCEPTION_INVALID_ENUM,
+  SIMCONNECT_EXCEPTION_DEFINITION_ERROR,
+  SIMCONNECT_EXCEPTION_DUPLICATE_ID,
+  SIMCONNECT_EXCEPTION_DATUM_ID,
+  SIMCONNECT_EXCEPTION_OUT_OF_BOUNDS,
+  SIMCONNECT_EXCEPTION_ALREADY_CREATED,
+  SIMCONNECT_EXCEPTION_OBJECT_OUTSIDE_REALITY_BUBBLE,
+  SIMCONNECT_EXCEPTION_OBJECT_CONTAINER,
+  SIMCONNECT_EXCEPTION_OBJECT_AI,
+  SIMCONNECT_EXCEPTION_OBJECT_ATC,
+  SIMCONNECT_EXCEPTION_OBJECT_SCHEDULE,
+};
+
+struct SIMCONNECT_RECV {
+  DWORD dwSize;
+  DWORD dwVersion;
+  DWORD dwID;
+};
+
+struct SIMCONNECT_RECV_EXCEPTION : SIMCONNECT_RECV {
+  DWORD dwException;
+  DWORD dwSendID;
+  DWORD dwIndex;
+};
+
+struct SIMCONNECT_RECV_EVENT : SIMCONNECT_RECV {
+  DWORD uGroupID;
+  DWORD uEventID;
+  DWORD dwData;
+};
+
+struct SIMCONNECT_RECV_SIMOBJECT_DATA : SIMCONNECT_RECV {
+  DWORD dwRequestID;
+  DWORD dwObjectID;
+  DWORD dwDefineID;
+  DWORD dwFlags;
+  DWORD dwentrynumber;
+  DWORD dwoutof;
+  DWORD dwDefineCount;
+  DWORD dwData;
+};
+
+struct SIMCONNECT_RECV_CLIENT_DATA : SIMCONNECT_RECV_SIMOBJECT_DATA {};
+
+struct SIMCONNECT_DATA_LATLONALT {
+  double Latitude;
+  double Longitude;
+  double Altitude;
+};
+
+struct SIMCONNECT_DATA_XYZ {
+  double x;
+  double y;
+  double z;
+};
+
+HRESULT SimConnect_Open(HANDLE* phSimConnect, const char* szName, void* hWnd, DWORD UserEventWin32, HANDLE hEventHandle, DWORD ConfigIndex);
+HRESULT SimConnect_Close(HANDLE hSimConnect);
+HRESULT SimConnect_GetNextDispatch(HANDLE hSimConnect, SIMCONNECT_RECV** ppData, DWORD* pcbData);
+
+HRESULT SimConnect_AddToDataDefinition(HANDLE hSimConnect,
+                                       SIMCONNECT_DATA_DEFINITION_ID DefineID,
+                                       const char* DatumName,
+                                       const char* UnitsName,
+                                       SIMCONNECT_DATATYPE DatumType = SIMCONNECT_DATATYPE_FLOAT64,
+                                       float fEpsilon = 0,
+                                       DWORD DatumID = SIMCONNECT_UNUSED);
+HRESULT SimConnect_RequestDataOnSimObject(HANDLE hSimConnect,
+                                          SIMCONNECT_DATA_REQUEST_ID RequestID,
+                                          SIMCONNECT_DATA_DEFINITION_ID DefineID,
+                                          SIMCONNECT_OBJECT_ID ObjectID,
+                                          SIMCONNECT_PERIOD Period,
+                                          DWORD Flags = 0,
+                                          DWORD origin = 0,
+                                          DWORD interval = 0,
+                                          DWORD limit = 0);
+HRESULT SimConnect_SetDataOnSimObject(HANDLE hSimConnect,
+                                      SIMCONNECT_DATA_DEFINITION_ID DefineID,
+                                      SIMCONNECT_OBJECT_ID ObjectID,
+                                      DWORD Flags,
+                                      DWORD ArrayCount,
+                                      DWORD cbUnitSize,
+                                      void* pDataSet);
+
+HRESULT SimConnect_MapClientEventToSimEvent(HANDLE hSimConnect, SIMCONNECT_CLIENT_EVENT_ID EventID, const char* EventName = "");
+HRESULT SimConnect_AddClientEventToNotificationGroup(HANDLE hSimConnect,
+                                                     SIMCONNECT_NOTIFICATION_GROUP_ID GroupID,
+                                                     SIMCONNECT_CLIENT_EVENT_ID EventID,
+                                                     BOOL bMaskable = FALSE);
+HRESULT SimConnect_SetNotificationGroupPriority(HANDLE hSimConnect, SIMCONNECT_NOTIFICATION_GROUP_ID GroupID, DWORD uPriority);
+HRESULT SimConnect_TransmitClientEvent(HANDLE hSimConnect,
+                                       SIMCONNECT_OBJECT_ID ObjectID,
+                                       SIMCONNECT_CLIENT_EVENT_ID EventID,
+                                       DWORD dwData,
+                                       SIMCONNECT_NOTIFICATION_GROUP_ID GroupID,
+                                       DWORD Flags);
+
+HRESULT SimConnect_MapClientDataNameToID(HANDLE hSimConnect, const char* szClientDataName, SIMCONNECT_CLIENT_DATA_ID ClientDataID);
+HRESULT SimConnect_CreateClientData(HANDLE hSimConnect, SIMCONNECT_CLIENT_DATA_ID ClientDataID, DWORD dwSize, DWORD Flags);
+HRESULT SimConnect_AddToClientDataDefinition(HANDLE hSimConnect,
+                                             SIMCONNECT_CLIENT_DATA_DEFINITION_ID DefineID,
+                                             DWORD dwOffset,
+                                             DWORD dwSizeOrType,
+                                             float fEpsilon = 0,
+                                             DWORD DatumID = SIMCONNECT_UNUSED);
+HRESULT SimConnect_RequestClientData(HANDLE hSimConnect,
+                                     SIMCONNECT_CLIENT_DATA_ID ClientDataID,
+                                     SIMCONNECT_DATA_REQUEST_ID RequestID,
+                                     SIMCONNECT_CLIENT_DATA_DEFINITION_ID DefineID,
+                                     SIMCONNECT_CLIENT_DATA_PERIOD Period = SIMCONNECT_CLIENT_DATA_PERIOD_ONCE,
+                                     DWORD Flags = 0,
+                                     DWORD origin = 0,
+                                     DWORD interval = 0,
+                                     DWORD limit = 0);
+HRESULT SimConnect_SetClientData(HANDLE hSimConnect,
+                                 SIMCONNECT_CLIENT_DATA_ID ClientDataID,
+                                 SIMCONNECT_CLIENT_DATA_DEFINITION_ID DefineID,
+                                 DWORD Flags,
+                                 DWORD dwReserved,
+                                 DWORD cbUnitSize,
+                                 void* pDataSet);